@@ -40,6 +40,9 @@ public class SVG4FNA
 	public class Image
 	{
 		internal IntPtr svg;
+		private IntPtr view;
+		private Dictionary<string, NSVGshapeRange> parts;
+		private List<SVG4FNA> renderers; // Those with geometry or a bake of this
 
 		public float Width
 		{
@@ -67,25 +70,484 @@ public class SVG4FNA
 
 		public Image(string svgPath, string units = "px", float dpi = 96.0f)
 		{
-			svg = nsvgParseFromFile(svgPath, units, dpi);
+			svg = nsvgParseFromFileMapped(svgPath, units, dpi);
 			if (svg == IntPtr.Zero)
 			{
 				throw new FileNotFoundException(svgPath);
 			}
 		}
 
+		/* Parses SVG text straight from memory, e.g. a byte[] from a content
+		 * archive. The data is not modified or copied. gzip compressed data
+		 * (.svgz) is detected and inflated.
+		 */
+		public Image(ReadOnlySpan<byte> svgData, string units = "px", float dpi = 96.0f)
+		{
+			bool compressed = (
+				svgData.Length >= 2 &&
+				svgData[0] == 0x1F &&
+				svgData[1] == 0x8B
+			);
+			unsafe
+			{
+				fixed (byte* data = svgData)
+				{
+					if (compressed)
+					{
+						svg = nsvgParseCompressed(
+							(IntPtr) data,
+							(UIntPtr) svgData.Length,
+							units,
+							dpi
+						);
+					}
+					else
+					{
+						svg = nsvgParseConst(
+							(IntPtr) data,
+							(UIntPtr) svgData.Length,
+							units,
+							dpi
+						);
+					}
+				}
+			}
+			if (svg == IntPtr.Zero)
+			{
+				if (compressed)
+				{
+					throw new InvalidDataException("Invalid .svgz data");
+				}
+				throw new OutOfMemoryException();
+			}
+		}
+
+		/* Reads the rest of the stream, e.g. from TitleContainer.OpenStream,
+		 * so shipped assets can stay compressed as .svgz.
+		 */
+		public Image(Stream svgStream, string units = "px", float dpi = 96.0f)
+			: this(ReadAll(svgStream), units, dpi)
+		{
+		}
+
+		internal Image(IntPtr svg)
+		{
+			this.svg = svg;
+		}
+
+		internal static byte[] ReadAll(Stream stream)
+		{
+			if (!stream.CanSeek)
+			{
+				using (MemoryStream copy = new MemoryStream())
+				{
+					stream.CopyTo(copy);
+					return copy.ToArray();
+				}
+			}
+			byte[] data = new byte[stream.Length - stream.Position];
+			int offset = 0;
+			while (offset < data.Length)
+			{
+				int read = stream.Read(data, offset, data.Length - offset);
+				if (read == 0)
+				{
+					throw new EndOfStreamException();
+				}
+				offset += read;
+			}
+			return data;
+		}
+
+		/* See NSVGparseStats in nanosvg.h */
+		[StructLayout(LayoutKind.Sequential)]
+		public struct ParseStats
+		{
+			public int StyleLookups;
+			public int StyleHits;
+			public int TransformLookups;
+			public int TransformHits;
+			public int DedupedPaths;
+			public int DedupedBytes;
+			public int QuantizedPaths;
+			public int QuantizedBytes;
+			public float QuantizeError;
+			public int GradientLookups;
+			public int GradientHits;
+			public int CulledShapes;
+		}
+
+		/* How often parsing reused an identical style, transform or gradient
+		 * it had already made, i.e. the hit rate is StyleHits / StyleLookups
+		 */
+		public ParseStats ParseStatistics
+		{
+			get
+			{
+				unsafe
+				{
+					NSVGimage *i = (NSVGimage*) svg;
+					return i->stats;
+				}
+			}
+		}
+
+		/* Makes paths with the same points, up to a translation, share one
+		 * copy of them, e.g. repeated icons or glyphs. Rendering is unchanged.
+		 * Returns the bytes freed, see also ParseStats.DedupedBytes.
+		 */
+		public long DedupePaths()
+		{
+			// The view points at the paths' old points
+			DeleteView();
+			long freed = (long) nsvgDedupePaths(svg).ToUInt64();
+			NotifyChanged();
+			return freed;
+		}
+
+		/* Stores path points as 16-bit coordinates, about halving their
+		 * memory. ParseStats.QuantizeError is the farthest any point moved,
+		 * in pixels at the image's native size. Call DedupePaths first, if at
+		 * all. Returns the bytes freed.
+		 */
+		public long QuantizePaths()
+		{
+			// The view points at the paths' old points
+			DeleteView();
+			long freed = (long) nsvgQuantizePaths(svg).ToUInt64();
+			NotifyChanged();
+			return freed;
+		}
+
+		/* Removes shapes that can't change what's drawn: hidden, transparent
+		 * or unpainted ones. With occlusion, shapes entirely under a later
+		 * opaque rectangle go too, but those only stay hidden while the image
+		 * is drawn with an opaque color and normal blending, at or above its
+		 * native size. Returns the shapes removed.
+		 */
+		public int CullShapes(bool occlusion = false)
+		{
+			// The view and the found parts point at the removed shapes
+			DeleteView();
+			parts = null;
+			int culled = nsvgCullShapes(svg, occlusion ? 1 : 0);
+			NotifyChanged();
+			return culled;
+		}
+
+		/* The shapes drawn by the element with this id: a shape, a <use>, or
+		 * a <g> with everything inside it. Looked up natively once, then
+		 * kept until the image changes.
+		 */
+		internal NSVGshapeRange FindPart(string id)
+		{
+			NSVGshapeRange range;
+			if (parts == null)
+			{
+				parts = new Dictionary<string, NSVGshapeRange>();
+			}
+			if (!parts.TryGetValue(id, out range))
+			{
+				if (nsvgFindShapes(svg, id, out range) == 0)
+				{
+					throw new KeyNotFoundException(id);
+				}
+				parts[id] = range;
+			}
+			return range;
+		}
+
+		/* Native bytes held by the parsed shapes, paths and gradients */
+		public long MemoryUsage
+		{
+			get
+			{
+				return (long) nsvgImageMemoryUsage(svg).ToUInt64();
+			}
+		}
+
+		/* The compact copy of the image that drawing reads, made on first
+		 * draw and kept until the image changes or is disposed
+		 */
+		internal IntPtr View
+		{
+			get
+			{
+				if (view == IntPtr.Zero)
+				{
+					view = nvgCreateSVGView(svg);
+					if (view == IntPtr.Zero)
+					{
+						throw new OutOfMemoryException();
+					}
+				}
+				return view;
+			}
+		}
+
+		private void DeleteView()
+		{
+			if (view != IntPtr.Zero)
+			{
+				nvgDeleteSVGView(view);
+				view = IntPtr.Zero;
+			}
+		}
+
+		/* Renderers register while they cache geometry or a bake made from
+		 * the image, so changing or disposing it drops those too
+		 */
+		internal void AddRenderer(SVG4FNA renderer)
+		{
+			if (renderers == null)
+			{
+				renderers = new List<SVG4FNA>();
+			}
+			renderers.Add(renderer);
+		}
+
+		internal void RemoveRenderer(SVG4FNA renderer)
+		{
+			renderers.Remove(renderer);
+		}
+
+		private void NotifyChanged()
+		{
+			if (renderers != null)
+			{
+				foreach (SVG4FNA renderer in renderers)
+				{
+					renderer.ImageChanged(this);
+				}
+			}
+		}
+
 		public void Dispose()
 		{
+			if (renderers != null)
+			{
+				// Each renderer removes itself
+				while (renderers.Count > 0)
+				{
+					renderers[renderers.Count - 1].ImageDisposed(this);
+				}
+			}
+			DeleteView();
 			nsvgDelete(svg);
 		}
 
+		/* Rasterizes on the CPU into non-premultiplied RGBA, width * height
+		 * pixels. Safe to call from worker threads, no GraphicsDevice needed.
+		 * threads = 0 uses one thread per CPU.
+		 */
+		public void Rasterize(
+			byte[] rgba,
+			int width,
+			int height,
+			float scale = 1.0f,
+			float tX = 0.0f,
+			float tY = 0.0f,
+			int threads = 0
+		) {
+			if (rgba.Length < width * height * 4)
+			{
+				throw new ArgumentException("rgba is too small", "rgba");
+			}
+			IntPtr r = nsvgCpuCreate(threads);
+			nsvgCpuRasterize(r, svg, tX, tY, scale, rgba, width, height, width * 4);
+			nsvgCpuDelete(r);
+		}
+
 		[StructLayout(LayoutKind.Sequential)]
 		private struct NSVGimage
 		{
 			public float width;
 			public float height;
 			public IntPtr shapes; /* NSVGShape* */
+			public ParseStats stats;
+			public IntPtr symbols; /* NSVGsymbol* */
+			public IntPtr gradients; /* NSVGgradient* */
+			public IntPtr ids; /* NSVGshapeIndex* */
+		}
+
+		/* See NSVGshapeRange in nanosvg.h */
+		[StructLayout(LayoutKind.Sequential)]
+		internal struct NSVGshapeRange
+		{
+			public IntPtr first; /* NSVGshape* */
+			public int index;
+			public int count;
+		}
+	}
+
+	/* Parses a little at a time on the calling thread, for spreading a load
+	 * across frames when a worker thread isn't an option. Call Step once per
+	 * frame until it returns true, then Finish. Each Step stops at the first
+	 * element or shape boundary after the budget is spent.
+	 */
+	public class ImageLoader
+	{
+		private IntPtr parser;
+		private GCHandle data;
+
+		public ImageLoader(byte[] svgData, string units = "px", float dpi = 96.0f)
+		{
+			/* The parser reads svgData in place until Finish/Dispose */
+			data = GCHandle.Alloc(svgData, GCHandleType.Pinned);
+			parser = nsvgParserCreate(
+				data.AddrOfPinnedObject(),
+				(UIntPtr) svgData.Length,
+				units,
+				dpi
+			);
+			if (parser == IntPtr.Zero)
+			{
+				data.Free();
+				if (svgData.Length >= 2 && svgData[0] == 0x1F && svgData[1] == 0x8B)
+				{
+					throw new InvalidDataException("Invalid .svgz data");
+				}
+				throw new OutOfMemoryException();
+			}
+		}
+
+		public ImageLoader(string svgPath, string units = "px", float dpi = 96.0f)
+			: this(File.ReadAllBytes(svgPath), units, dpi)
+		{
+		}
+
+		public ImageLoader(Stream svgStream, string units = "px", float dpi = 96.0f)
+			: this(Image.ReadAll(svgStream), units, dpi)
+		{
 		}
+
+		/* Returns true once the image is ready for Finish */
+		public bool Step(TimeSpan budget)
+		{
+			if (parser == IntPtr.Zero)
+			{
+				throw new ObjectDisposedException("ImageLoader");
+			}
+			return nsvgParserStep(
+				parser,
+				(int) Math.Min(budget.Ticks / 10, int.MaxValue)
+			) != 0;
+		}
+
+		/* Does any remaining work, even if Step never returned true */
+		public Image Finish()
+		{
+			if (parser == IntPtr.Zero)
+			{
+				throw new ObjectDisposedException("ImageLoader");
+			}
+			IntPtr svg = nsvgParserFinish(parser);
+			parser = IntPtr.Zero;
+			data.Free();
+			if (svg == IntPtr.Zero)
+			{
+				throw new OutOfMemoryException();
+			}
+			return new Image(svg);
+		}
+
+		public void Dispose()
+		{
+			if (parser != IntPtr.Zero)
+			{
+				nsvgParserDelete(parser);
+				parser = IntPtr.Zero;
+				data.Free();
+			}
+		}
+	}
+
+	#endregion
+
+	#region Frame Statistics
+
+	/* Renderer cost of the last EndBatch, see NVGframeStats in nanovg_gpu.h.
+	 * Times are CPU milliseconds.
+	 */
+	[StructLayout(LayoutKind.Sequential)]
+	public struct FrameStats
+	{
+		public int DrawCalls;
+		public int FillTriangles;
+		public int StrokeTriangles;
+		public int TextTriangles;
+
+		public int FillCalls;
+		public int ConvexFillCalls;
+		public int StrokeCalls;
+		public int TriangleCalls;
+		public int GeometryCalls;
+		public int TargetCalls;
+
+		public int BackendDrawCalls;
+		public int StencilPasses;
+		public int VerticesUploaded;
+		public int VertexBytesUploaded;
+		public int UniformBytesUploaded;
+		public int TextureBytesUploaded;
+
+		public float FlattenTime;
+		public float ExpandTime;
+		public float FlushTime;
+	}
+
+	/* Per frame buffer sizes in elements, see NVGgpuBufferSizes in
+	 * nanovg_gpu.h. Used for capacities, last frame use and Reserve hints.
+	 */
+	[StructLayout(LayoutKind.Sequential)]
+	public struct BufferSizes
+	{
+		public int Calls;
+		public int Paths;
+		public int Verts;
+		public int Uniforms;
+		public int InstanceCalls;
+
+		public int Commands;
+		public int CachePoints;
+		public int CachePaths;
+		public int CacheVerts;
+	}
+
+	#endregion
+
+	#region Memory Statistics
+
+	/* See SVG4FNA_MemoryTag in svg4fna.h */
+	public enum MemoryTag
+	{
+		Other,
+		Parser,
+		Image,
+		PathCache,
+		Renderer,
+		FontAtlas
+	}
+
+	/* Native bytes currently allocated for tag, across every context */
+	public static long GetLiveBytes(MemoryTag tag)
+	{
+		SVG4FNA_MemoryStats stats;
+		SVG4FNA_GetMemoryStats(out stats);
+		return (long) stats.live[(int) tag].ToUInt64();
+	}
+
+	/* Highest live bytes for tag since startup or ResetMemoryPeaks */
+	public static long GetPeakBytes(MemoryTag tag)
+	{
+		SVG4FNA_MemoryStats stats;
+		SVG4FNA_GetMemoryStats(out stats);
+		return (long) stats.peak[(int) tag].ToUInt64();
+	}
+
+	public static void ResetMemoryPeaks()
+	{
+		SVG4FNA_ResetMemoryPeaks();
 	}
 
 	#endregion
@@ -96,19 +558,45 @@ public class SVG4FNA
 	private Effect effect;
 	private EffectTechnique[,,] techniques;
 	private EffectParameter inverseViewSize;
+	private EffectParameter vertexXform;
+	private Vector4[] vertexXformValues;
 	private IntPtr frag;
 
-	private DynamicVertexBuffer vertexBuffer;
+	private Dictionary<long, DynamicVertexBuffer> vertexBuffers;
+	private long vertexBufferAlias;
+
+	private Dictionary<Image, int> geometryCache;
+	private float[] instanceXforms;
 
 	private class TextureHandle
 	{
 		public Texture2D texture;
 		public SamplerState samplerState;
 		public int bpp;
+		public bool cleared;
 	}
 	private Dictionary<long, TextureHandle> textures;
 	private long textureAlias;
 
+	private RenderTargetBinding[] previousTargets;
+	private Viewport previousViewport;
+
+	private class BakedImage
+	{
+		public int x;
+		public int y;
+		public int width;
+		public int height;
+		public float scale;
+	}
+	private Dictionary<Image, BakedImage> bakeCache;
+	private const int BakeAtlasSize = 2048;
+	private int bakeAtlas;
+	private int bakeShelfX;
+	private int bakeShelfY;
+	private int bakeShelfHeight;
+	private bool bakeAtlasLost;
+
 	private int enableColorWrite;
 	private Blend srcRGB;
 	private Blend srcAlpha;
@@ -140,6 +628,7 @@ public class SVG4FNA
 	private nvg_gpu_pfn_updateShader updateShader;
 	private nvg_gpu_pfn_updateSampler updateSampler;
 	private nvg_gpu_pfn_setViewport setViewport;
+	private nvg_gpu_pfn_updateVertexTransform updateVertexTransform;
 	private nvg_gpu_pfn_resetState resetState;
 	private nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask;
 	private nvg_gpu_pfn_updateBlendFunction updateBlendFunction;
@@ -148,8 +637,11 @@ public class SVG4FNA
 	private nvg_gpu_pfn_toggleCullMode toggleCullMode;
 	private nvg_gpu_pfn_applyState applyState;
 	private nvg_gpu_pfn_drawPrimitives drawPrimitives;
+	private nvg_gpu_pfn_createRenderTarget createRenderTarget;
+	private nvg_gpu_pfn_setRenderTarget setRenderTarget;
 
 	private float batchScale;
+	private float batchPixelRatio;
 
 	#endregion
 
@@ -159,9 +651,17 @@ public class SVG4FNA
 	{
 		this.device = device;
 
+		vertexBuffers = new Dictionary<long, DynamicVertexBuffer>();
+		vertexBufferAlias = 1;
+		vertexXformValues = new Vector4[2];
+
 		textures = new Dictionary<long, TextureHandle>();
 		textureAlias = 1;
 
+		geometryCache = new Dictionary<Image, int>();
+		bakeCache = new Dictionary<Image, BakedImage>();
+		BakeTolerance = 0.25f;
+
 		blendCache = new Dictionary<uint, BlendState>();
 		depthStencilCache = new Dictionary<uint, DepthStencilState>();
 
@@ -177,6 +677,7 @@ public class SVG4FNA
 		updateShader = UpdateShader;
 		updateSampler = UpdateSampler;
 		setViewport = SetViewport;
+		updateVertexTransform = UpdateVertexTransform;
 		resetState = ResetState;
 		toggleColorWriteMask = ToggleColorWriteMask;
 		updateBlendFunction = UpdateBlendFunction;
@@ -185,6 +686,8 @@ public class SVG4FNA
 		toggleCullMode = ToggleCullMode;
 		applyState = ApplyState;
 		drawPrimitives = DrawPrimitives;
+		createRenderTarget = CreateRenderTarget;
+		setRenderTarget = SetRenderTarget;
 
 		nvg = nvgGpuCreate(
 			IntPtr.Zero,
@@ -200,6 +703,7 @@ public class SVG4FNA
 			updateShader,
 			updateSampler,
 			setViewport,
+			updateVertexTransform,
 			resetState,
 			toggleColorWriteMask,
 			updateBlendFunction,
@@ -207,18 +711,82 @@ public class SVG4FNA
 			updateStencilFunction,
 			toggleCullMode,
 			applyState,
-			drawPrimitives
+			drawPrimitives,
+			createRenderTarget,
+			setRenderTarget
 		);
 	}
 
 	#endregion
 
+	#region Public Properties
+
+	/* How far the pixel scale of a baked image may drift from the scale it
+	 * was baked at before it gets baked again, 0.25 means +/- 25%.
+	 */
+	public float BakeTolerance
+	{
+		get;
+		set;
+	}
+
+	public FrameStats LastFrameStats
+	{
+		get
+		{
+			FrameStats stats;
+			nvgGetFrameStats(nvg, out stats);
+			return stats;
+		}
+	}
+
+	public BufferSizes BufferCapacity
+	{
+		get
+		{
+			BufferSizes capacity, used;
+			nvgGpuGetBufferSizes(nvg, out capacity, out used);
+			return capacity;
+		}
+	}
+
+	/* The most of each buffer used by the last frame */
+	public BufferSizes LastBufferUse
+	{
+		get
+		{
+			BufferSizes capacity, used;
+			nvgGpuGetBufferSizes(nvg, out capacity, out used);
+			return used;
+		}
+	}
+
+	#endregion
+
 	#region Public Methods
 
 	public void Dispose()
 	{
 		nvgGpuDelete(nvg);
 
+		foreach (Image svg in geometryCache.Keys)
+		{
+			svg.RemoveRenderer(this);
+		}
+		foreach (Image svg in bakeCache.Keys)
+		{
+			if (!geometryCache.ContainsKey(svg))
+			{
+				svg.RemoveRenderer(this);
+			}
+		}
+
+		geometryCache.Clear();
+		geometryCache = null;
+
+		bakeCache.Clear();
+		bakeCache = null;
+
 		blendCache.Clear();
 		blendCache = null;
 
@@ -227,6 +795,106 @@ public class SVG4FNA
 
 		textures.Clear();
 		textures = null;
+
+		vertexBuffers.Clear();
+		vertexBuffers = null;
+	}
+
+	/* Keeps the image's tessellated geometry in GPU memory, in image space.
+	 * Future Draw calls for this image only update the vertex transform.
+	 * The geometry is tessellated at the image's native size during the next
+	 * Draw, so this is best for images drawn at roughly 1:1 scale. If there
+	 * is no room left for it, the image keeps drawing as vectors instead.
+	 * Changing the image, e.g. with DedupePaths, tessellates it again, and
+	 * disposing it uncaches it.
+	 */
+	public void CacheGeometry(Image svg)
+	{
+		if (!geometryCache.ContainsKey(svg))
+		{
+			if (!bakeCache.ContainsKey(svg))
+			{
+				svg.AddRenderer(this);
+			}
+			geometryCache.Add(svg, 0);
+		}
+	}
+
+	public void UncacheGeometry(Image svg)
+	{
+		int geometry;
+		if (geometryCache.TryGetValue(svg, out geometry))
+		{
+			nvgGpuDeleteGeometry(nvg, geometry);
+			geometryCache.Remove(svg);
+			if (!bakeCache.ContainsKey(svg))
+			{
+				svg.RemoveRenderer(this);
+			}
+		}
+	}
+
+	/* Draws the image from a texture instead of as vectors. The image is
+	 * rasterized into a shared atlas at the pixel size it is drawn at, during
+	 * the next Draw, and is re-baked when that size drifts past BakeTolerance.
+	 * This is best for images drawn at a fixed size every frame.
+	 * Changing the image, e.g. with DedupePaths, bakes it again, and
+	 * disposing it unbakes it.
+	 */
+	public void Bake(Image svg)
+	{
+		if (!bakeCache.ContainsKey(svg))
+		{
+			if (!geometryCache.ContainsKey(svg))
+			{
+				svg.AddRenderer(this);
+			}
+			bakeCache.Add(svg, new BakedImage());
+		}
+	}
+
+	public void Unbake(Image svg)
+	{
+		/* The atlas space is reclaimed the next time the atlas fills up */
+		if (bakeCache.Remove(svg) && !geometryCache.ContainsKey(svg))
+		{
+			svg.RemoveRenderer(this);
+		}
+	}
+
+	/* Writes every GPU command SVG4FNA makes to path until EndCapture, for
+	 * replaying later with replay_native or example_native. Call this outside
+	 * of BeginBatch/EndBatch. Textures and geometry that already exist are
+	 * replayed empty, so start capturing before loading the scene.
+	 */
+	public void BeginCapture(string path)
+	{
+		if (nvgGpuBeginCapture(nvg, path) == 0)
+		{
+			throw new IOException("Could not start capture: " + path);
+		}
+	}
+
+	public void EndCapture()
+	{
+		nvgGpuEndCapture(nvg);
+	}
+
+	/* Shrinks the per frame buffers once they have used less than fraction
+	 * of their capacity for frames batches in a row. 0 frames never shrinks,
+	 * which is the default.
+	 */
+	public void SetTrimPolicy(int frames, float fraction)
+	{
+		nvgGpuSetTrimPolicy(nvg, frames, fraction);
+	}
+
+	/* Grows the per frame buffers up front, and keeps trimming from going
+	 * below them. LastBufferUse from a typical frame makes a good hint.
+	 */
+	public void Reserve(BufferSizes hint)
+	{
+		nvgGpuReserve(nvg, ref hint);
 	}
 
 	public void BeginBatch(
@@ -238,9 +906,111 @@ public class SVG4FNA
 		nvgBeginFrame(nvg, frameWidth, frameHeight, fbScale);
 		nvgScale(nvg, vpScale, vpScale);
 		batchScale = vpScale;
+		batchPixelRatio = fbScale;
 	}
 
 	public void Draw(Image svg, float tX = 0, float tY = 0, float sX = 1, float sY = 1, float a = 0)
+	{
+		bool reset = PushTransform(tX, tY, sX, sY, a);
+		int geometry;
+		BakedImage baked;
+		if (bakeCache.TryGetValue(svg, out baked))
+		{
+			DrawBaked(svg, baked, Math.Max(Math.Abs(sX), Math.Abs(sY)));
+		}
+		else
+		{
+			if (geometryCache.TryGetValue(svg, out geometry))
+			{
+				geometry = GetGeometry(svg, geometry);
+			}
+			if (geometry > 0)
+			{
+				nvgGpuDrawGeometry(nvg, geometry);
+			}
+			else
+			{
+				nvgDrawSVGView(nvg, svg.View);
+			}
+		}
+		if (reset)
+		{
+			PopTransform();
+		}
+	}
+
+	/* Draws only the shapes of the element with this id, e.g. one sprite of
+	 * a sheet, where it sits in the image. Throws KeyNotFoundException if no
+	 * element has the id. Parts always draw from the image's view, never
+	 * from a bake or cached geometry of the whole image.
+	 */
+	public void DrawPart(Image svg, string id, float tX = 0, float tY = 0, float sX = 1, float sY = 1, float a = 0)
+	{
+		Image.NSVGshapeRange range = svg.FindPart(id);
+		bool reset = PushTransform(tX, tY, sX, sY, a);
+		nvgDrawSVGViewSubset(nvg, svg.View, ref range);
+		if (reset)
+		{
+			PopTransform();
+		}
+	}
+
+	/* Draws the image once per transform, but only tessellates and uploads
+	 * it once. The transforms are 2D, only M11/M12/M21/M22/M41/M42 are read.
+	 */
+	public void DrawInstances(Image svg, ReadOnlySpan<Matrix> transforms)
+	{
+		if (transforms.Length == 0)
+		{
+			return;
+		}
+
+		int len = transforms.Length * 6;
+		if (instanceXforms == null || instanceXforms.Length < len)
+		{
+			instanceXforms = new float[len];
+		}
+		for (int i = 0, j = 0; i < transforms.Length; i += 1, j += 6)
+		{
+			ref readonly Matrix m = ref transforms[i];
+			instanceXforms[j + 0] = m.M11;
+			instanceXforms[j + 1] = m.M12;
+			instanceXforms[j + 2] = m.M21;
+			instanceXforms[j + 3] = m.M22;
+			instanceXforms[j + 4] = m.M41;
+			instanceXforms[j + 5] = m.M42;
+		}
+
+		int geometry;
+		if (geometryCache.TryGetValue(svg, out geometry))
+		{
+			geometry = GetGeometry(svg, geometry);
+		}
+		if (geometry > 0)
+		{
+			nvgGpuDrawGeometryInstanced(
+				nvg,
+				geometry,
+				instanceXforms,
+				transforms.Length
+			);
+		}
+		else
+		{
+			nvgDrawSVGViewInstanced(nvg, svg.View, instanceXforms, transforms.Length);
+		}
+	}
+
+	public void EndBatch()
+	{
+		nvgEndFrame(nvg);
+	}
+
+	#endregion
+
+	#region Private Methods
+
+	private bool PushTransform(float tX, float tY, float sX, float sY, float a)
 	{
 		bool reset = false;
 		if (tX != 0 || tY != 0)
@@ -258,17 +1028,152 @@ public class SVG4FNA
 			nvgRotate(nvg, a);
 			reset = true;
 		}
-		nvgDrawSVG(nvg, svg.svg);
-		if (reset)
+		return reset;
+	}
+
+	private void PopTransform()
+	{
+		nvgResetTransform(nvg);
+		nvgScale(nvg, batchScale, batchScale);
+	}
+
+	/* Returns the cached geometry id, or -1 if the image could not be cached */
+	private int GetGeometry(Image svg, int geometry)
+	{
+		if (geometry == 0)
 		{
-			nvgResetTransform(nvg);
-			nvgScale(nvg, batchScale, batchScale);
+			nvgGpuBeginGeometry(nvg);
+			nvgDrawSVGView(nvg, svg.View);
+			geometry = nvgGpuEndGeometry(nvg);
+			if (geometry == 0)
+			{
+				/* Out of geometry slots or vertex memory. The recording
+				 * was rolled back, so draw this image as vectors from
+				 * now on instead of retrying every frame.
+				 */
+				geometry = -1;
+			}
+			geometryCache[svg] = geometry;
 		}
+		return geometry;
 	}
 
-	public void EndBatch()
+	private void DrawBaked(Image svg, BakedImage baked, float scale)
 	{
-		nvgEndFrame(nvg);
+		if (bakeAtlasLost)
+		{
+			InvalidateBakes();
+			bakeAtlasLost = false;
+		}
+
+		float pixelScale = batchScale * batchPixelRatio * scale;
+		if (	baked.scale == 0.0f ||
+			Math.Abs(pixelScale - baked.scale) > baked.scale * BakeTolerance	)
+		{
+			if (!BakeImage(svg, baked, pixelScale))
+			{
+				nvgDrawSVGView(nvg, svg.View);
+				return;
+			}
+		}
+
+		nvgImageQuad(
+			nvg,
+			bakeAtlas,
+			baked.x,
+			baked.y,
+			baked.width,
+			baked.height,
+			0,
+			0,
+			svg.Width,
+			svg.Height,
+			1.0f
+		);
+	}
+
+	private bool BakeImage(Image svg, BakedImage baked, float pixelScale)
+	{
+		int width = (int) Math.Ceiling(svg.Width * pixelScale);
+		int height = (int) Math.Ceiling(svg.Height * pixelScale);
+
+		/* 1px of padding on each side keeps linear filtering from bleeding */
+		if (	width <= 0 ||
+			height <= 0 ||
+			width + 2 > BakeAtlasSize ||
+			height + 2 > BakeAtlasSize	)
+		{
+			return false;
+		}
+
+		if (bakeAtlas == 0)
+		{
+			bakeAtlas = nvgGpuCreateRenderTarget(nvg, BakeAtlasSize, BakeAtlasSize);
+			if (bakeAtlas == 0)
+			{
+				return false;
+			}
+		}
+
+		/* Shelf packing, start over when the atlas is full. Quads already
+		 * drawn this frame still read the old contents, draws are in order.
+		 */
+		if (bakeShelfX + width + 2 > BakeAtlasSize)
+		{
+			bakeShelfX = 0;
+			bakeShelfY += bakeShelfHeight;
+			bakeShelfHeight = 0;
+		}
+		if (bakeShelfY + height + 2 > BakeAtlasSize)
+		{
+			InvalidateBakes();
+		}
+
+		baked.x = bakeShelfX + 1;
+		baked.y = bakeShelfY + 1;
+		baked.width = width;
+		baked.height = height;
+		baked.scale = pixelScale;
+		bakeShelfX += width + 2;
+		bakeShelfHeight = Math.Max(bakeShelfHeight, height + 2);
+
+		nvgBakeSVGView(nvg, svg.View, bakeAtlas, baked.x, baked.y, width, height);
+		return true;
+	}
+
+	/* Geometry and bakes made from the image's old shapes are made again
+	 * on its next Draw
+	 */
+	private void ImageChanged(Image svg)
+	{
+		int geometry;
+		if (geometryCache.TryGetValue(svg, out geometry))
+		{
+			nvgGpuDeleteGeometry(nvg, geometry);
+			geometryCache[svg] = 0;
+		}
+		BakedImage baked;
+		if (bakeCache.TryGetValue(svg, out baked))
+		{
+			baked.scale = 0.0f;
+		}
+	}
+
+	private void ImageDisposed(Image svg)
+	{
+		UncacheGeometry(svg);
+		Unbake(svg);
+	}
+
+	private void InvalidateBakes()
+	{
+		foreach (BakedImage baked in bakeCache.Values)
+		{
+			baked.scale = 0.0f;
+		}
+		bakeShelfX = 0;
+		bakeShelfY = 0;
+		bakeShelfHeight = 0;
 	}
 
 	#endregion
@@ -280,6 +1185,7 @@ public class SVG4FNA
 
 		effect = new Effect(device, File.ReadAllBytes("../../../../shaders/nanovg.fxb"));
 		inverseViewSize = effect.Parameters["inverseViewSize"];
+		vertexXform = effect.Parameters["vertexXform"];
 		frag = (IntPtr) typeof(EffectParameter).GetField(
 			"values",
 			BindingFlags.Instance | BindingFlags.NonPublic
@@ -314,50 +1220,63 @@ public class SVG4FNA
 
 	private void DeleteContext(IntPtr userdata)
 	{
-		if (vertexBuffer != null)
+		foreach (DynamicVertexBuffer vertexBuffer in vertexBuffers.Values)
 		{
 			vertexBuffer.Dispose();
-			vertexBuffer = null;
 		}
+		vertexBuffers.Clear();
 		effect.Dispose();
 		inverseViewSize = null;
+		vertexXform = null;
 		frag = IntPtr.Zero;
 		techniques = null;
 	}
 
 	private IntPtr CreateVertexBuffer(IntPtr userdata, IntPtr size)
 	{
-		vertexBuffer = new DynamicVertexBuffer(
+		DynamicVertexBuffer vertexBuffer = new DynamicVertexBuffer(
 			device,
 			NVGvertex.VertexDeclaration,
 			size.ToInt32() / NVGvertex.VertexDeclaration.VertexStride,
 			BufferUsage.WriteOnly
 		);
-		return new IntPtr(1);
+
+		long alias = vertexBufferAlias++;
+		vertexBuffers.Add(alias, vertexBuffer);
+		return new IntPtr(alias);
 	}
 
 	private void DeleteVertexBuffer(IntPtr userdata, IntPtr buffer)
 	{
-		if (buffer.ToInt64() != 1)
+		DynamicVertexBuffer vertexBuffer;
+		long alias = buffer.ToInt64();
+		if (vertexBuffers.TryGetValue(alias, out vertexBuffer))
+		{
+			vertexBuffer.Dispose();
+			vertexBuffers.Remove(alias);
+		}
+		else
 		{
 			throw new InvalidOperationException();
 		}
-		vertexBuffer.Dispose();
-		vertexBuffer = null;
 	}
 
 	private void UpdateVertexBuffer(IntPtr userdata, IntPtr buffer, IntPtr ptr, int count, IntPtr stride)
 	{
-		if (buffer.ToInt64() != 1)
+		DynamicVertexBuffer vertexBuffer;
+		if (vertexBuffers.TryGetValue(buffer.ToInt64(), out vertexBuffer))
+		{
+			vertexBuffer.SetDataPointerEXT(
+				0,
+				ptr,
+				count * stride.ToInt32(),
+				SetDataOptions.Discard
+			);
+		}
+		else
 		{
 			throw new InvalidOperationException();
 		}
-		vertexBuffer.SetDataPointerEXT(
-			0,
-			ptr,
-			count * stride.ToInt32(),
-			SetDataOptions.Discard
-		);
 	}
 
 	private IntPtr CreateTexture(
@@ -390,6 +1309,7 @@ public class SVG4FNA
 			TextureAddressMode.Clamp;
 		textureHandle.samplerState.AddressW = TextureAddressMode.Clamp;
 		textureHandle.bpp = (isRGBA > 0) ? 4 : 1;
+		textureHandle.cleared = true;
 
 		long alias = textureAlias++;
 		textures.Add(alias, textureHandle);
@@ -461,6 +1381,83 @@ public class SVG4FNA
 		inverseViewSize.SetValue(new Vector2(1.0f / width, 1.0f / height));
 	}
 
+	private IntPtr CreateRenderTarget(IntPtr userdata, int width, int height)
+	{
+		TextureHandle textureHandle = new TextureHandle();
+
+		RenderTarget2D target = new RenderTarget2D(
+			device,
+			width,
+			height,
+			false,
+			SurfaceFormat.Color,
+			DepthFormat.Depth24Stencil8,
+			0,
+			RenderTargetUsage.PreserveContents
+		);
+		target.ContentLost += (sender, e) =>
+		{
+			textureHandle.cleared = false;
+			bakeAtlasLost = true;
+		};
+		textureHandle.texture = target;
+		textureHandle.samplerState = SamplerState.LinearClamp;
+		textureHandle.bpp = 4;
+		textureHandle.cleared = false;
+
+		long alias = textureAlias++;
+		textures.Add(alias, textureHandle);
+		return new IntPtr(alias);
+	}
+
+	private void SetRenderTarget(IntPtr userdata, IntPtr texture)
+	{
+		if (texture == IntPtr.Zero)
+		{
+			device.SetRenderTargets(previousTargets);
+			device.Viewport = previousViewport;
+			previousTargets = null;
+			return;
+		}
+
+		TextureHandle textureHandle;
+		if (!textures.TryGetValue(texture.ToInt64(), out textureHandle))
+		{
+			throw new InvalidOperationException();
+		}
+
+		if (previousTargets == null)
+		{
+			previousTargets = device.GetRenderTargets();
+			previousViewport = device.Viewport;
+		}
+
+		/* The target may still be bound from drawing it earlier */
+		device.Textures[0] = null;
+		device.SetRenderTarget((RenderTarget2D) textureHandle.texture);
+		if (!textureHandle.cleared)
+		{
+			device.Clear(
+				ClearOptions.Target | ClearOptions.Stencil,
+				Color.Transparent,
+				0.0f,
+				0
+			);
+			textureHandle.cleared = true;
+		}
+	}
+
+	private void UpdateVertexTransform(IntPtr userdata, IntPtr xform)
+	{
+		unsafe
+		{
+			float *t = (float*) xform;
+			vertexXformValues[0] = new Vector4(t[0], t[1], t[2], t[3]);
+			vertexXformValues[1] = new Vector4(t[4], t[5], 0.0f, 0.0f);
+		}
+		vertexXform.SetValue(vertexXformValues);
+	}
+
 	private void ResetState(IntPtr userdata)
 	{
 		device.BlendState = BlendState.Opaque;
@@ -533,7 +1530,8 @@ public class SVG4FNA
 
 	private void ApplyState(IntPtr userdata, IntPtr buffer)
 	{
-		if (buffer.ToInt64() != 1)
+		DynamicVertexBuffer vertexBuffer;
+		if (!vertexBuffers.TryGetValue(buffer.ToInt64(), out vertexBuffer))
 		{
 			throw new InvalidOperationException();
 		}
@@ -626,15 +1624,101 @@ public class SVG4FNA
 	#region Native Interop
 
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
-	private static extern IntPtr nsvgParseFromFile(
+	private static extern IntPtr nsvgParseFromFileMapped(
 		string filename,
 		string units,
 		float dpi
 	);
 
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nsvgParseConst(
+		IntPtr data,
+		UIntPtr len,
+		string units,
+		float dpi
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nsvgParseCompressed(
+		IntPtr data,
+		UIntPtr len,
+		string units,
+		float dpi
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nsvgParserCreate(
+		IntPtr data,
+		UIntPtr len,
+		string units,
+		float dpi
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nsvgParserStep(IntPtr parser, int budgetUs);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nsvgParserFinish(IntPtr parser);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nsvgParserDelete(IntPtr parser);
+
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
 	private static extern void nsvgDelete(IntPtr svg);
 
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern UIntPtr nsvgImageMemoryUsage(IntPtr svg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern UIntPtr nsvgDedupePaths(IntPtr svg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern UIntPtr nsvgQuantizePaths(IntPtr svg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nsvgCullShapes(IntPtr svg, int occlusion);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nsvgFindShapes(
+		IntPtr svg,
+		string id,
+		out Image.NSVGshapeRange range
+	);
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct SVG4FNA_MemoryStats
+	{
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = 6)]
+		public UIntPtr[] live;
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = 6)]
+		public UIntPtr[] peak;
+	}
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void SVG4FNA_GetMemoryStats(out SVG4FNA_MemoryStats stats);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void SVG4FNA_ResetMemoryPeaks();
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nsvgCpuCreate(int threads);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nsvgCpuDelete(IntPtr r);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nsvgCpuRasterize(
+		IntPtr r,
+		IntPtr svg,
+		float tx,
+		float ty,
+		float scale,
+		byte[] dst,
+		int w,
+		int h,
+		int stride
+	);
+
 	const int NVG_ZERO = 1 << 0;
 	const int NVG_ONE = 1<<1;
 	const int NVG_SRC_COLOR = 1 << 2;
@@ -749,6 +1833,9 @@ public class SVG4FNA
 	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 	private delegate void nvg_gpu_pfn_setViewport(IntPtr userdata, float width, float height);
 
+	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+	private delegate void nvg_gpu_pfn_updateVertexTransform(IntPtr userdata, IntPtr xform);
+
 	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 	private delegate void nvg_gpu_pfn_resetState(IntPtr userdata);
 
@@ -782,6 +1869,12 @@ public class SVG4FNA
 	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 	private delegate void nvg_gpu_pfn_drawPrimitives(IntPtr userdata, int triStrip, int vertexOffset, int vertexCount);
 
+	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+	private delegate IntPtr nvg_gpu_pfn_createRenderTarget(IntPtr userdata, int width, int height);
+
+	[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+	private delegate void nvg_gpu_pfn_setRenderTarget(IntPtr userdata, IntPtr texture);
+
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
 	private static extern IntPtr nvgGpuCreate(
 		IntPtr userdata,
@@ -797,6 +1890,7 @@ public class SVG4FNA
 		nvg_gpu_pfn_updateShader updateShader,
 		nvg_gpu_pfn_updateSampler updateSampler,
 		nvg_gpu_pfn_setViewport setViewport,
+		nvg_gpu_pfn_updateVertexTransform updateVertexTransform,
 		nvg_gpu_pfn_resetState resetState,
 		nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask,
 		nvg_gpu_pfn_updateBlendFunction updateBlendFunction,
@@ -804,12 +1898,63 @@ public class SVG4FNA
 		nvg_gpu_pfn_updateStencilFunction updateStencilFunction,
 		nvg_gpu_pfn_toggleCullMode toggleCullMode,
 		nvg_gpu_pfn_applyState applyState,
-		nvg_gpu_pfn_drawPrimitives drawPrimitives
+		nvg_gpu_pfn_drawPrimitives drawPrimitives,
+		nvg_gpu_pfn_createRenderTarget createRenderTarget,
+		nvg_gpu_pfn_setRenderTarget setRenderTarget
 	);
 
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
 	private static extern void nvgGpuDelete(IntPtr nvg);
 
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuBeginGeometry(IntPtr nvg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nvgGpuEndGeometry(IntPtr nvg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuDrawGeometry(IntPtr nvg, int geometry);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuDeleteGeometry(IntPtr nvg, int geometry);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuDrawGeometryInstanced(
+		IntPtr nvg,
+		int geometry,
+		float[] xforms,
+		int count
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nvgGpuCreateRenderTarget(IntPtr nvg, int width, int height);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGetFrameStats(IntPtr nvg, out FrameStats stats);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuSetTrimPolicy(
+		IntPtr nvg,
+		int frames,
+		float fraction
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuReserve(IntPtr nvg, ref BufferSizes hint);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuGetBufferSizes(
+		IntPtr nvg,
+		out BufferSizes capacity,
+		out BufferSizes used
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int nvgGpuBeginCapture(IntPtr nvg, string path);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgGpuEndCapture(IntPtr nvg);
+
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
 	private static extern void nvgBeginFrame(IntPtr nvg, float width, float height, float ratio);
 
@@ -829,7 +1974,54 @@ public class SVG4FNA
 	private static extern void nvgScale(IntPtr nvg, float x, float y);
 
 	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
-	private static extern void nvgDrawSVG(IntPtr nvg, IntPtr svg);
+	private static extern void nvgImageQuad(
+		IntPtr nvg,
+		int image,
+		float sx,
+		float sy,
+		float sw,
+		float sh,
+		float dx,
+		float dy,
+		float dw,
+		float dh,
+		float alpha
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr nvgCreateSVGView(IntPtr svg);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgDeleteSVGView(IntPtr view);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgDrawSVGView(IntPtr nvg, IntPtr view);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgDrawSVGViewSubset(
+		IntPtr nvg,
+		IntPtr view,
+		ref Image.NSVGshapeRange range
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgDrawSVGViewInstanced(
+		IntPtr nvg,
+		IntPtr view,
+		float[] xforms,
+		int count
+	);
+
+	[DllImport("libsvg4fna", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void nvgBakeSVGView(
+		IntPtr nvg,
+		IntPtr view,
+		int image,
+		int x,
+		int y,
+		int w,
+		int h
+	);
 
 	#endregion
 }
@@ -0,0 +1,289 @@
+/* SVG4FNA - SVG Container and Renderer for FNA
+ *
+ * Copyright (c) 2024 Ethan Lee
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software in a
+ * product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ * Ethan "flibitijibibo" Lee <flibitijibibo@flibitijibibo.com>
+ *
+ */
+
+#include <SDL.h>
+#include <stdio.h>
+
+#include "svg4fna.c"
+
+// Headless benchmarks, no GPU or window needed.
+// Usage: bench_native [-frames N] [-raster SIZE] [-cull] [-occlude] [-dedupe] [-quantize] [-trace out.json] [file.svg...]
+//
+// By default, each SVG is parsed N times, then drawn for N frames with
+// an NVGsvgView against the null backend, reporting per-stage CPU time.
+// With -raster, each SVG is rasterized at SIZE x SIZE with nsvgCpuRasterize
+// instead, reporting pixels/sec versus thread count.
+// -cull runs nsvgCullShapes after parsing, reporting the shapes it removed.
+// -occlude does the same, also removing shapes under opaque rectangles.
+// -dedupe runs nsvgDedupePaths after that, reporting the memory it saved.
+// -quantize runs nsvgQuantizePaths after that, also reporting the largest
+// error in pixels at the image's native size.
+// -trace needs a build with SVG4FNA_TRACE defined, and writes a Chrome trace
+// of the run.
+
+#define RASTER_ITERATIONS 10
+
+static double seconds(Uint64 ticks)
+{
+	return (double) ticks / SDL_GetPerformanceFrequency();
+}
+
+static NSVGimage* parse(const char *file, int iterations, double *parseTime)
+{
+	NSVGimage *svg = NULL;
+	Uint64 total = 0;
+	for (int i = 0; i < iterations; i += 1) {
+		if (svg != NULL) {
+			nsvgDelete(svg);
+		}
+		Uint64 start = SDL_GetPerformanceCounter();
+		svg = nsvgParseFromFileMapped(file, "px", 96);
+		total += SDL_GetPerformanceCounter() - start;
+		if (svg == NULL) {
+			return NULL;
+		}
+	}
+	*parseTime = seconds(total) / iterations;
+	return svg;
+}
+
+static void benchFrames(NVGcontext *vg, NSVGimage *svg, const char *file, int frames, double parseTime)
+{
+	unsigned long long flatten, expand, flush;
+	double flattenTime = 0.0, expandTime = 0.0, flushTime = 0.0;
+	NVGgpuNullCounters counters;
+	NVGsvgView *view = nvgCreateSVGView(svg);
+
+	nvgGpuResetNullCounters(vg);
+	Uint64 start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < frames; i += 1) {
+		nvgBeginFrame(vg, svg->width, svg->height, 1.0f);
+		nvgDrawSVGView(vg, view);
+		nvgEndFrame(vg);
+
+		nvgGetStageTicks(vg, &flatten, &expand, &flush);
+		flattenTime += seconds(flatten);
+		expandTime += seconds(expand);
+		flushTime += seconds(flush);
+	}
+	double frameTime = seconds(SDL_GetPerformanceCounter() - start) / frames;
+	nvgGpuGetNullCounters(vg, &counters);
+	nvgDeleteSVGView(view);
+
+	printf(
+		"%-24.24s %9.3f %9.3f %9.3f %9.3f %9.3f %7d %8d %8d\n",
+		file,
+		parseTime * 1000.0,
+		flattenTime * 1000.0 / frames,
+		expandTime * 1000.0 / frames,
+		flushTime * 1000.0 / frames,
+		frameTime * 1000.0,
+		counters.drawCalls / frames,
+		counters.verticesUploaded / frames,
+		(int) (counters.uniformBytesUploaded / frames)
+	);
+	printf(
+		"%24s state changes per frame: shader %d, sampler %d, blend %d, "
+		"stencil %d/%d, cull %d, color mask %d, apply %d\n",
+		"",
+		counters.shaderChanges / frames,
+		counters.samplerChanges / frames,
+		counters.blendFunctionChanges / frames,
+		counters.stencilToggles / frames,
+		counters.stencilFunctionChanges / frames,
+		counters.cullModeChanges / frames,
+		counters.colorWriteMaskChanges / frames,
+		counters.stateApplies / frames
+	);
+}
+
+static double rasterize(
+	NSVGcpuRasterizer *r,
+	NSVGimage *svg,
+	unsigned char *pixels,
+	int size,
+	int iterations
+) {
+	float scale = size / SDL_max(svg->width, svg->height);
+	Uint64 start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i += 1) {
+		nsvgCpuRasterize(r, svg, 0.0f, 0.0f, scale, pixels, size, size, size * 4);
+	}
+	return seconds(SDL_GetPerformanceCounter() - start);
+}
+
+static void benchRaster(NSVGimage *svg, const char *file, int size)
+{
+	unsigned char *pixels = (unsigned char*) SDL_malloc(size * size * 4);
+	NSVGcpuRasterizer *r = nsvgCpuCreate(1);
+
+	// Warm up the scratch memory before timing anything
+	rasterize(r, svg, pixels, size, 1);
+
+	int cpus = SDL_GetCPUCount();
+	double base = 0.0;
+	printf("%s, %dx%d, %d iterations\n", file, size, size, RASTER_ITERATIONS);
+	printf("threads   Mpixels/s   speedup\n");
+
+	// Powers of 2, always ending on the actual CPU count
+	for (int threads = 1; threads <= cpus; threads = (threads < cpus && threads * 2 > cpus) ? cpus : threads * 2) {
+		nsvgCpuSetThreads(r, threads);
+		double time = rasterize(r, svg, pixels, size, RASTER_ITERATIONS);
+		double mpps = ((double) size * size * RASTER_ITERATIONS) / time / 1000000.0;
+		if (threads == 1) {
+			base = mpps;
+		}
+		printf("%7d %11.2f %8.2fx\n", threads, mpps, mpps / base);
+	}
+
+	nsvgCpuDelete(r);
+	SDL_free(pixels);
+}
+
+int main(int argc, char **argv) {
+	const char *defaultFile = "23.svg";
+	const char **files = &defaultFile;
+	int nfiles = 1;
+	int frames = 100;
+	int rasterSize = 0;
+	int cull = 0;
+	int dedupe = 0;
+	int quantize = 0;
+	const char *traceFile = NULL;
+	int arg = 1;
+
+	for (; arg < argc; arg += 1) {
+		if (SDL_strcmp(argv[arg], "-frames") == 0 && arg + 1 < argc) {
+			arg += 1;
+			frames = SDL_max(1, SDL_atoi(argv[arg]));
+		} else if (SDL_strcmp(argv[arg], "-raster") == 0 && arg + 1 < argc) {
+			arg += 1;
+			rasterSize = SDL_max(1, SDL_atoi(argv[arg]));
+		} else if (SDL_strcmp(argv[arg], "-cull") == 0) {
+			cull = 1;
+		} else if (SDL_strcmp(argv[arg], "-occlude") == 0) {
+			cull = 2;
+		} else if (SDL_strcmp(argv[arg], "-dedupe") == 0) {
+			dedupe = 1;
+		} else if (SDL_strcmp(argv[arg], "-quantize") == 0) {
+			quantize = 1;
+		} else if (SDL_strcmp(argv[arg], "-trace") == 0 && arg + 1 < argc) {
+			arg += 1;
+			traceFile = argv[arg];
+		} else {
+			break;
+		}
+	}
+	if (arg < argc) {
+		files = (const char**) &argv[arg];
+		nfiles = argc - arg;
+	}
+
+	if (traceFile != NULL) {
+#ifdef SVG4FNA_TRACE
+		SVG4FNA_StartTrace(1 << 20);
+#else
+		printf("-trace needs a build with SVG4FNA_TRACE defined\n");
+		return -1;
+#endif
+	}
+
+	NVGcontext *vg = NULL;
+	if (rasterSize == 0) {
+		vg = nvgGpuCreateNull();
+		if (vg == NULL) {
+			printf("NVGcontext creation failed\n");
+			return -1;
+		}
+		printf("%d frames, null backend, times in ms (parse per parse, others per frame)\n", frames);
+		printf(
+			"%-24s %9s %9s %9s %9s %9s %7s %8s %8s\n",
+			"file", "parse", "flatten", "expand", "flush", "frame",
+			"draws", "verts", "uniforms"
+		);
+	}
+
+	for (int i = 0; i < nfiles; i += 1) {
+		double parseTime;
+		NSVGimage *svg = parse(files[i], (rasterSize == 0) ? frames : 1, &parseTime);
+		if (svg == NULL || svg->width <= 0.0f || svg->height <= 0.0f) {
+			printf("Could not load %s\n", files[i]);
+			if (svg != NULL) {
+				nsvgDelete(svg);
+			}
+			continue;
+		}
+
+		if (cull) {
+			int removed = nsvgCullShapes(svg, cull == 2);
+			printf("%-24.24s cull: %d shapes removed\n", files[i], removed);
+		}
+		if (dedupe) {
+			size_t before = nsvgImageMemoryUsage(svg);
+			size_t saved = nsvgDedupePaths(svg);
+			printf(
+				"%-24.24s dedupe: %d paths shared, %d of %d bytes saved\n",
+				files[i],
+				svg->stats.dedupedPaths,
+				(int) saved,
+				(int) before
+			);
+		}
+		if (quantize) {
+			size_t before = nsvgImageMemoryUsage(svg);
+			size_t saved = nsvgQuantizePaths(svg);
+			printf(
+				"%-24.24s quantize: %d paths packed, %d of %d bytes saved, %.4f px max error\n",
+				files[i],
+				svg->stats.quantizedPaths,
+				(int) saved,
+				(int) before,
+				svg->stats.quantizeError
+			);
+		}
+
+		if (rasterSize == 0) {
+			benchFrames(vg, svg, files[i], frames, parseTime);
+		} else {
+			benchRaster(svg, files[i], rasterSize);
+		}
+		nsvgDelete(svg);
+	}
+
+	if (vg != NULL) {
+		nvgGpuDelete(vg);
+	}
+
+#ifdef SVG4FNA_TRACE
+	if (traceFile != NULL) {
+		if (!SVG4FNA_WriteTrace(traceFile)) {
+			printf("Could not write %s\n", traceFile);
+		}
+		SVG4FNA_StopTrace();
+	}
+#endif
+	return 0;
+}
@@ -38,6 +38,12 @@ typedef struct FNA3D_TextureUserData
 	FNA3D_Texture *texture;
 	FNA3D_SamplerState samplerState;
 	int bpp;
+
+	// Render targets only
+	FNA3D_Renderbuffer *stencil;
+	int width;
+	int height;
+	int cleared;
 } FNA3D_TextureUserData;
 
 typedef struct FNA3D_UserData
@@ -48,11 +54,14 @@ typedef struct FNA3D_UserData
 	MOJOSHADER_effect *effectData;
 	MOJOSHADER_effectTechnique *techniques[2][4][3];
 	MOJOSHADER_effectParam *inverseViewSize;
+	MOJOSHADER_effectParam *vertexXform;
 	MOJOSHADER_effectParam *frag;
 
 	FNA3D_BlendState blendState;
 	FNA3D_DepthStencilState depthStencilState;
 	FNA3D_RasterizerState rasterizerState;
+
+	FNA3D_Viewport *backbufferViewport;
 } FNA3D_UserData;
 
 void CALLBACK_createContext(void* userdata)
@@ -105,6 +114,10 @@ void CALLBACK_createContext(void* userdata)
 		{
 			ctx->inverseViewSize = &ctx->effectData->params[i];
 		}
+		else if (SDL_strcmp(ctx->effectData->params[i].value.name, "vertexXform") == 0)
+		{
+			ctx->vertexXform = &ctx->effectData->params[i];
+		}
 		else if (SDL_strcmp(ctx->effectData->params[i].value.name, "frag") == 0)
 		{
 			ctx->frag = &ctx->effectData->params[i];
@@ -119,9 +132,8 @@ void CALLBACK_deleteContext(void* userdata)
 	FNA3D_AddDisposeEffect(ctx->device, ctx->effect);
 }
 
-void* CALLBACK_createTexture(void* userdata, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY)
+static FNA3D_TextureUserData* createTextureUserData(FNA3D_UserData *ctx, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY, int isRenderTarget)
 {
-	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
 	FNA3D_TextureUserData *tex = (FNA3D_TextureUserData*) SDL_malloc(sizeof(FNA3D_TextureUserData));
 
 	tex->texture = FNA3D_CreateTexture2D(
@@ -132,7 +144,7 @@ void* CALLBACK_createTexture(void* userdata, int isRGBA, int width, int height,
 		width,
 		height,
 		1,
-		0
+		isRenderTarget
 	);
 
 	tex->samplerState.filter = nearest ?
@@ -150,15 +162,29 @@ void* CALLBACK_createTexture(void* userdata, int isRGBA, int width, int height,
 	tex->samplerState.maxMipLevel = 0;
 
 	tex->bpp = (isRGBA) ? 4 : 1;
+	tex->stencil = NULL;
+	tex->width = width;
+	tex->height = height;
+	tex->cleared = 0;
 
 	return tex;
 }
 
+void* CALLBACK_createTexture(void* userdata, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY)
+{
+	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
+	return createTextureUserData(ctx, isRGBA, width, height, nearest, repeatX, repeatY, 0);
+}
+
 void CALLBACK_deleteTexture(void* userdata, void* texture)
 {
 	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
 	FNA3D_TextureUserData *tex = (FNA3D_TextureUserData*) texture;
 
+	if (tex->stencil != NULL)
+	{
+		FNA3D_AddDisposeRenderbuffer(ctx->device, tex->stencil);
+	}
 	FNA3D_AddDisposeTexture(
 		ctx->device,
 		tex->texture
@@ -251,6 +277,13 @@ void CALLBACK_setViewport(void* userdata, float width, float height)
 	ctx->inverseViewSize->value.valuesF[0] = 1.0f / width;
 	ctx->inverseViewSize->value.valuesF[1] = 1.0f / height;
 }
+
+void CALLBACK_updateVertexTransform(void* userdata, float* xform)
+{
+	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
+	SDL_memcpy(ctx->vertexXform->value.valuesF, xform, sizeof(float) * 6);
+}
+
 void CALLBACK_resetState(void* userdata)
 {
 	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
@@ -437,14 +470,95 @@ void CALLBACK_drawPrimitives(void* userdata, int triStrip, int vertexOffset, int
 	);
 }
 
+void* CALLBACK_createRenderTarget(void* userdata, int width, int height)
+{
+	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
+	FNA3D_TextureUserData *tex = createTextureUserData(ctx, 1, width, height, 0, 0, 0, 1);
+
+	// nanovg fills need a stencil buffer on every target
+	tex->stencil = FNA3D_GenDepthStencilRenderbuffer(
+		ctx->device,
+		width,
+		height,
+		FNA3D_DEPTHFORMAT_D24S8,
+		0
+	);
+	return tex;
+}
+
+void CALLBACK_setRenderTarget(void* userdata, void* texture)
+{
+	FNA3D_UserData *ctx = (FNA3D_UserData*) userdata;
+	FNA3D_TextureUserData *tex = (FNA3D_TextureUserData*) texture;
+	FNA3D_RenderTargetBinding binding;
+	FNA3D_Viewport viewport;
+	FNA3D_Vec4 clearColor;
+
+	if (tex == NULL)
+	{
+		FNA3D_SetRenderTargets(ctx->device, NULL, 0, NULL, FNA3D_DEPTHFORMAT_D24S8, 0);
+		FNA3D_SetViewport(ctx->device, ctx->backbufferViewport);
+		return;
+	}
+
+	SDL_memset(&binding, '\0', sizeof(binding));
+	binding.type = FNA3D_RENDERTARGET_TYPE_2D;
+	binding.twod.width = tex->width;
+	binding.twod.height = tex->height;
+	binding.levelCount = 1;
+	binding.multiSampleCount = 0;
+	binding.texture = tex->texture;
+	FNA3D_SetRenderTargets(ctx->device, &binding, 1, tex->stencil, FNA3D_DEPTHFORMAT_D24S8, 1);
+
+	viewport.x = 0;
+	viewport.y = 0;
+	viewport.w = tex->width;
+	viewport.h = tex->height;
+	viewport.minDepth = 0;
+	viewport.maxDepth = 1;
+	FNA3D_SetViewport(ctx->device, &viewport);
+
+	// New targets start out with garbage in them
+	if (!tex->cleared)
+	{
+		clearColor.x = 0;
+		clearColor.y = 0;
+		clearColor.z = 0;
+		clearColor.w = 0;
+		FNA3D_Clear(
+			ctx->device,
+			FNA3D_CLEAROPTIONS_TARGET | FNA3D_CLEAROPTIONS_STENCIL,
+			&clearColor,
+			0.0f,
+			0
+		);
+		tex->cleared = 1;
+	}
+}
+
 // Main loop, finally
 
+/* Usage: example_native [-capture out.nvgcap] [-replay in.nvgcap]
+ * -capture records every frame until exit, -replay loops a capture instead
+ * of drawing the SVG, logging the average replay time of each pass.
+ */
 int main(int argc, char **argv) {
+	const char *captureFile = NULL;
+	const char *replayFile = NULL;
+	for (int i = 1; i + 1 < argc; i += 1) {
+		if (SDL_strcmp(argv[i], "-capture") == 0) {
+			captureFile = argv[++i];
+		} else if (SDL_strcmp(argv[i], "-replay") == 0) {
+			replayFile = argv[++i];
+		}
+	}
+
 	NSVGimage *svg = nsvgParseFromFile("23.svg", "px", 96);
 	if (svg == NULL) {
 		printf("Could not load SVG.\n");
 		return -1;
 	}
+	NVGsvgView *view = nvgCreateSVGView(svg);
 
 	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 		SDL_Log("SDL_Init failed");
@@ -509,6 +623,7 @@ int main(int argc, char **argv) {
 	FNA3D_UserData fna3d;
 	SDL_memset(&fna3d, '\0', sizeof(fna3d));
 	fna3d.device = device;
+	fna3d.backbufferViewport = &viewport;
 
 	NVGcontext *vg = nvgGpuCreate(
 		&fna3d,
@@ -524,6 +639,7 @@ int main(int argc, char **argv) {
 		CALLBACK_updateShader,
 		CALLBACK_updateSampler,
 		CALLBACK_setViewport,
+		CALLBACK_updateVertexTransform,
 		CALLBACK_resetState,
 		CALLBACK_toggleColorWriteMask,
 		CALLBACK_updateBlendFunction,
@@ -531,13 +647,31 @@ int main(int argc, char **argv) {
 		CALLBACK_updateStencilFunction,
 		CALLBACK_toggleCullMode,
 		CALLBACK_applyState,
-		CALLBACK_drawPrimitives
+		CALLBACK_drawPrimitives,
+		CALLBACK_createRenderTarget,
+		CALLBACK_setRenderTarget
 	);
 	if (vg == NULL) {
 		SDL_Log("NVGcontext creation failed");
 		return -1;
 	}
 
+	NVGgpuReplay *replay = NULL;
+	int replayFrames = 0;
+	Uint64 replayTicks = 0;
+	if (replayFile != NULL) {
+		replay = nvgGpuReplayOpen(vg, replayFile);
+		if (replay == NULL) {
+			SDL_Log("Could not open capture %s", replayFile);
+			return -1;
+		}
+	} else if (captureFile != NULL) {
+		if (!nvgGpuBeginCapture(vg, captureFile)) {
+			SDL_Log("Could not start capture %s", captureFile);
+			return -1;
+		}
+	}
+
 	int running = 1;
 	while (running) {
 		SDL_Event event;
@@ -584,13 +718,38 @@ int main(int argc, char **argv) {
 			0
 		);
 
-		nvgBeginFrame(vg, winWidth, winHeight, pxRatio);
-		nvgDrawSVG(vg, svg);
-		nvgEndFrame(vg);
+		if (replay != NULL) {
+			Uint64 start = SDL_GetPerformanceCounter();
+			if (nvgGpuReplayFrame(replay)) {
+				replayTicks += SDL_GetPerformanceCounter() - start;
+				replayFrames += 1;
+			} else {
+				if (replayFrames > 0) {
+					SDL_Log(
+						"Replayed %d frames, %.3f ms average",
+						replayFrames,
+						(double) replayTicks * 1000.0 / SDL_GetPerformanceFrequency() / replayFrames
+					);
+				}
+				replayFrames = 0;
+				replayTicks = 0;
+				nvgGpuReplayRewind(replay);
+				continue;
+			}
+		} else {
+			nvgBeginFrame(vg, winWidth, winHeight, pxRatio);
+			nvgDrawSVGView(vg, view);
+			nvgEndFrame(vg);
+		}
 
 		FNA3D_SwapBuffers(device, NULL, NULL, window);
 	}
 
+	if (replay != NULL) {
+		nvgGpuReplayClose(replay);
+	}
+	nvgGpuEndCapture(vg);
+	nvgDeleteSVGView(view);
 	nsvgDelete(svg);
 	nvgGpuDelete(vg);
 	FNA3D_DestroyDevice(device);
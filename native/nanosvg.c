@@ -30,9 +30,44 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <limits.h> /* SVG4FNA change! */
 
 #include "nanosvg.h"
 
+#if defined(_WIN32) /* SVG4FNA change! */
+#define WIN32_LEAN_AND_MEAN /* SVG4FNA change! */
+#define NOMINMAX /* SVG4FNA change! */
+#include <windows.h> /* SVG4FNA change! */
+#elif defined(__unix__) || defined(__APPLE__) /* SVG4FNA change! */
+#include <fcntl.h> /* SVG4FNA change! */
+#include <sys/mman.h> /* SVG4FNA change! */
+#include <sys/stat.h> /* SVG4FNA change! */
+#include <unistd.h> /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+#ifndef NSVG_IMAGE_MALLOC /* SVG4FNA change! */
+#define NSVG_IMAGE_MALLOC malloc /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+// Raw deflate into a fixed buffer, returns the inflated size or -1 /* SVG4FNA change! */
+#ifndef NSVG_INFLATE /* SVG4FNA change! */
+#define NSVG_INFLATE(out, outlen, in, inlen) (-1) /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+// Clock for nsvgParserStep's budget /* SVG4FNA change! */
+#ifndef NSVG_TICKS /* SVG4FNA change! */
+#include <time.h> /* SVG4FNA change! */
+#define NSVG_TICKS() ((unsigned long long)clock()) /* SVG4FNA change! */
+#define NSVG_TICKS_FREQUENCY() ((unsigned long long)CLOCKS_PER_SEC) /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+#ifndef NSVG_TRACE_BEGIN /* SVG4FNA change! */
+#define NSVG_TRACE_BEGIN(name, detail) /* SVG4FNA change! */
+#define NSVG_TRACE_END() /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+#include "nanosvg_tokens.h" /* SVG4FNA change! */
+
 #define NSVG_PI (3.14159265358979323846264338327f)
 #define NSVG_KAPPA90 (0.5522847493f)	// Length proportional to radius of a cubic bezier handle for 90deg arcs.
 
@@ -91,7 +126,88 @@ static void nsvg__parseContent(char* s,
 		(*contentCb)(ud, s);
 }
 
-static void nsvg__parseElement(char* s,
+static int nsvg__token(const char* s); /* SVG4FNA change! */
+
+// Editor metadata, text, fonts, filters and scripts can be large and nothing /* SVG4FNA change! */
+// inside them is drawn, so their subtrees are skipped without being parsed /* SVG4FNA change! */
+static int nsvg__isSkippedElement(const char* name) /* SVG4FNA change! */
+{
+	switch (nsvg__token(name)) {
+	case NSVG_TOKEN_DESC:
+	case NSVG_TOKEN_FILTER:
+	case NSVG_TOKEN_FONT:
+	case NSVG_TOKEN_FONT_FACE:
+	case NSVG_TOKEN_FOREIGNOBJECT:
+	case NSVG_TOKEN_METADATA:
+	case NSVG_TOKEN_SCRIPT:
+	case NSVG_TOKEN_STYLE:
+	case NSVG_TOKEN_TITLE:
+		return 1;
+	}
+	return	strncmp(name, "sodipodi:", 9) == 0 ||
+			strncmp(name, "inkscape:", 9) == 0 ||
+			strncmp(name, "rdf:", 4) == 0;
+}
+
+// Finds pattern in [s, end), or returns NULL /* SVG4FNA change! */
+static const char* nsvg__findSpan(const char* s, const char* end, const char* pattern, size_t n) /* SVG4FNA change! */
+{
+	while ((s = (const char*)memchr(s, pattern[0], end - s)) != NULL) {
+		if ((size_t)(end - s) < n)
+			return NULL;
+		if (memcmp(s, pattern, n) == 0)
+			return s;
+		s++;
+	}
+	return NULL;
+}
+
+// Finds the end of the subtree whose start tag ended just before s, only /* SVG4FNA change! */
+// counting tags. Comments, CDATA and quoted values can't end it early. /* SVG4FNA change! */
+static const char* nsvg__skipSubtree(const char* s, const char* end) /* SVG4FNA change! */
+{
+	int depth = 1;
+	while (depth > 0) {
+		s = (const char*)memchr(s, '<', end - s);
+		if (s == NULL || end - s < 2)
+			return end;
+		if (end - s >= 4 && memcmp(s, "<!--", 4) == 0) {
+			s = nsvg__findSpan(s + 4, end, "-->", 3);
+			if (s == NULL)
+				return end;
+			s += 3;
+		} else if (end - s >= 9 && memcmp(s, "<![CDATA[", 9) == 0) {
+			s = nsvg__findSpan(s + 9, end, "]]>", 3);
+			if (s == NULL)
+				return end;
+			s += 3;
+		} else if (s[1] == '\0' || nsvg__isspace(s[1]) || nsvg__isdigit(s[1])) {
+			// Not a tag, just a stray '<' in some text
+			s++;
+		} else {
+			char quote = 0;
+			int close = (s[1] == '/');
+			int other = (s[1] == '!' || s[1] == '?');
+			for (s++; s < end && (quote || *s != '>'); s++) {
+				if (quote && *s == quote)
+					quote = 0;
+				else if (!quote && (*s == '\"' || *s == '\''))
+					quote = *s;
+			}
+			if (s == end)
+				return end;
+			if (close)
+				depth--;
+			else if (!other && s[-1] != '/')
+				depth++;
+			s++;
+		}
+	}
+	return s;
+}
+
+// Returns 1 if the element's subtree should be skipped /* SVG4FNA change! */
+static int nsvg__parseElement(char* s, /* SVG4FNA change! */
 							   void (*startelCb)(void* ud, const char* el, const char** attr),
 							   void (*endelCb)(void* ud, const char* el),
 							   void* ud)
@@ -116,13 +232,19 @@ static void nsvg__parseElement(char* s,
 
 	// Skip comments, data and preprocessor stuff.
 	if (!*s || *s == '?' || *s == '!')
-		return;
+		return 0; /* SVG4FNA change! */
 
 	// Get tag name
 	name = s;
 	while (*s && !nsvg__isspace(*s)) s++;
 	if (*s) { *s++ = '\0'; }
 
+	// Skip before tokenizing any attributes, unless the tag closes itself /* SVG4FNA change! */
+	if (start && nsvg__isSkippedElement(name)) { /* SVG4FNA change! */
+		size_t len = strlen(s); /* SVG4FNA change! */
+		return len == 0 || s[len - 1] != '/'; /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+
 	// Get attribs
 	while (!end && *s && nattr < NSVG_XML_MAX_ATTRIBS-3) {
 		char* name = NULL;
@@ -165,36 +287,119 @@ static void nsvg__parseElement(char* s,
 		(*startelCb)(ud, name, attr);
 	if (end && endelCb)
 		(*endelCb)(ud, name);
+	return 0; /* SVG4FNA change! */
 }
 
-int nsvg__parseXML(char* input,
+// Returns [s, e) as a C string. In place, e is overwritten with the /* SVG4FNA change! */
+// terminator, otherwise the span is copied into the growing scratch buffer. /* SVG4FNA change! */
+static char* nsvg__terminateSpan(const char* s, const char* e, int inPlace, char** scratch, size_t* cscratch) /* SVG4FNA change! */
+{
+	size_t n = (size_t)(e - s);
+	if (inPlace) {
+		*(char*)e = '\0';
+		return (char*)s;
+	}
+	if (n + 1 > *cscratch) {
+		size_t size = *cscratch ? *cscratch : 256;
+		char* buf;
+		while (n + 1 > size)
+			size *= 2;
+		buf = (char*)realloc(*scratch, size);
+		if (buf == NULL)
+			return NULL;
+		*scratch = buf;
+		*cscratch = size;
+	}
+	memcpy(*scratch, s, n);
+	(*scratch)[n] = '\0';
+	return *scratch;
+}
+
+// Where the tokenizer is in [pos, end). With inPlace the input is written to /* SVG4FNA change! */
+// like nsvgParse always did, otherwise it is left alone and only one tag at a /* SVG4FNA change! */
+// time is copied, so the input needs no terminator and can be read-only. /* SVG4FNA change! */
+typedef struct NSVGxmlSpan  /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	const char* pos; /* SVG4FNA change! */
+	const char* end; /* SVG4FNA change! */
+	int inPlace; /* SVG4FNA change! */
+	char* scratch; /* SVG4FNA change! */
+	size_t cscratch; /* SVG4FNA change! */
+} NSVGxmlSpan; /* SVG4FNA change! */
+
+static int nsvg__pastDeadline(unsigned long long deadline) /* SVG4FNA change! */
+{
+	return deadline != 0 && NSVG_TICKS() >= deadline;
+}
+
+// Tokenizes until the span is done, or until a tag ends after the deadline (0 /* SVG4FNA change! */
+// for none). Returns 0 if a tag could not be copied. /* SVG4FNA change! */
+static int nsvg__parseXMLTags(NSVGxmlSpan* x, unsigned long long deadline, /* SVG4FNA change! */
 				   void (*startelCb)(void* ud, const char* el, const char** attr),
 				   void (*endelCb)(void* ud, const char* el),
 				   void (*contentCb)(void* ud, const char* s),
 				   void* ud)
 {
-	char* s = input;
-	char* mark = s;
-	int state = NSVG_XML_CONTENT;
-	while (*s) {
-		if (*s == '<' && state == NSVG_XML_CONTENT) {
-			// Start of a tag
-			*s++ = '\0';
-			nsvg__parseContent(mark, contentCb, ud);
-			mark = s;
-			state = NSVG_XML_TAG;
-		} else if (*s == '>' && state == NSVG_XML_TAG) {
-			// Start of a content or new tag.
-			*s++ = '\0';
-			nsvg__parseElement(mark, startelCb, endelCb, ud);
-			mark = s;
-			state = NSVG_XML_CONTENT;
-		} else {
-			s++;
+	const char* s = x->pos;
+	const char* end = x->end;
+	int ok = 1;
+
+	while (s < end) {
+		const char* lt = (const char*)memchr(s, '<', end - s);
+		const char* gt;
+		const char* text;
+		char* tag;
+		if (lt == NULL)
+			break;
+
+		// Content, unless it is only white space
+		for (text = s; text < lt && nsvg__isspace(*text); text++);
+		if (text < lt && contentCb) {
+			char* content = nsvg__terminateSpan(text, lt, x->inPlace, &x->scratch, &x->cscratch);
+			if (content == NULL) {
+				ok = 0;
+				break;
+			}
+			nsvg__parseContent(content, contentCb, ud);
+		}
+
+		// Tag
+		gt = (const char*)memchr(lt + 1, '>', end - (lt + 1));
+		if (gt == NULL)
+			break;
+		tag = nsvg__terminateSpan(lt + 1, gt, x->inPlace, &x->scratch, &x->cscratch);
+		if (tag == NULL) {
+			ok = 0;
+			break;
+		}
+		s = gt + 1;
+		if (nsvg__parseElement(tag, startelCb, endelCb, ud))
+			s = nsvg__skipSubtree(s, end);
+		if (nsvg__pastDeadline(deadline)) {
+			x->pos = s;
+			return 1;
 		}
 	}
 
-	return 1;
+	x->pos = end;
+	return ok;
+}
+
+int nsvg__parseXML(char* input,
+				   void (*startelCb)(void* ud, const char* el, const char** attr),
+				   void (*endelCb)(void* ud, const char* el),
+				   void (*contentCb)(void* ud, const char* s),
+				   void* ud)
+{
+	NSVGxmlSpan x; /* SVG4FNA change! */
+	int ok; /* SVG4FNA change! */
+	memset(&x, 0, sizeof(x)); /* SVG4FNA change! */
+	x.pos = input; /* SVG4FNA change! */
+	x.end = input + strlen(input); /* SVG4FNA change! */
+	x.inPlace = 1; /* SVG4FNA change! */
+	ok = nsvg__parseXMLTags(&x, 0, startelCb, endelCb, contentCb, ud); /* SVG4FNA change! */
+	free(x.scratch); /* SVG4FNA change! */
+	return ok; /* SVG4FNA change! */
 }
 
 
@@ -252,20 +457,68 @@ typedef struct NSVGgradientData
 	struct NSVGgradientData* next;
 } NSVGgradientData;
 
+typedef struct NSVGsymbolData /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	NSVGsymbol* symbol; /* SVG4FNA change! */
+	float viewBox[4]; // Width and height are 0 without a viewBox /* SVG4FNA change! */
+	int alignX, alignY, alignType; /* SVG4FNA change! */
+	struct NSVGsymbolData* next; /* SVG4FNA change! */
+} NSVGsymbolData; /* SVG4FNA change! */
+
+// A <use> waiting for the end of the document, when every symbol is known /* SVG4FNA change! */
+typedef struct NSVGuseData /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	NSVGshape* shape; /* SVG4FNA change! */
+	char href[64]; /* SVG4FNA change! */
+	float width, height; // 0 if not set /* SVG4FNA change! */
+	struct NSVGuseData* next; /* SVG4FNA change! */
+} NSVGuseData; /* SVG4FNA change! */
+
+// An element with an id, by the positions of the shapes it drew in the image /* SVG4FNA change! */
+typedef struct NSVGshapeIdData /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	char id[64]; /* SVG4FNA change! */
+	int index; /* SVG4FNA change! */
+	int count; // -1 while a <g> is still open /* SVG4FNA change! */
+} NSVGshapeIdData; /* SVG4FNA change! */
+
+typedef struct NSVGshapeIndexEntry /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	NSVGshapeRange range; /* SVG4FNA change! */
+	unsigned int hash; /* SVG4FNA change! */
+	int id; // Offset into the index's strings /* SVG4FNA change! */
+} NSVGshapeIndexEntry; /* SVG4FNA change! */
+
+// Open addressing over the entries, all in one allocation /* SVG4FNA change! */
+typedef struct NSVGshapeIndex /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	NSVGshapeIndexEntry* entries; /* SVG4FNA change! */
+	int* slots; // Entry index + 1, 0 is empty /* SVG4FNA change! */
+	char* strings; /* SVG4FNA change! */
+	int nentries; /* SVG4FNA change! */
+	int nslots; /* SVG4FNA change! */
+	size_t size; /* SVG4FNA change! */
+} NSVGshapeIndex; /* SVG4FNA change! */
+
+// The id, gradient and dash fields live in per-depth chunks that a child /* SVG4FNA change! */
+// shares with its parent until it writes them, so pushing copies far less. /* SVG4FNA change! */
+typedef char NSVGattribName[64]; /* SVG4FNA change! */
+typedef float NSVGattribDash[NSVG_MAX_DASHES]; /* SVG4FNA change! */
+
 typedef struct NSVGattrib
 {
-	char id[64];
+	char* id; /* SVG4FNA change! */
 	float xform[6];
 	unsigned int fillColor;
 	unsigned int strokeColor;
 	float opacity;
 	float fillOpacity;
 	float strokeOpacity;
-	char fillGradient[64];
-	char strokeGradient[64];
+	char* fillGradient; /* SVG4FNA change! */
+	char* strokeGradient; /* SVG4FNA change! */
 	float strokeWidth;
 	float strokeDashOffset;
-	float strokeDashArray[NSVG_MAX_DASHES];
+	float* strokeDashArray; /* SVG4FNA change! */
 	int strokeDashCount;
 	char strokeLineJoin;
 	char strokeLineCap;
@@ -278,12 +531,99 @@ typedef struct NSVGattrib
 	char hasFill;
 	char hasStroke;
 	char visible;
+	unsigned int inherit; // NSVG_FIELD_* left for each <use> to set, in a <symbol> /* SVG4FNA change! */
 } NSVGattrib;
 
-typedef struct NSVGparser
+// Exporters repeat the same style and transform strings thousands of times, /* SVG4FNA change! */
+// so each parse memoizes their results by exact text. /* SVG4FNA change! */
+#define NSVG_MAX_MEMO 4096 /* SVG4FNA change! */
+
+// The attributes a style wrote, so a memoized style only touches those /* SVG4FNA change! */
+enum NSVGstyleFields { /* SVG4FNA change! */
+	NSVG_FIELD_VISIBLE = 1 << 0, /* SVG4FNA change! */
+	NSVG_FIELD_FILL = 1 << 1, /* SVG4FNA change! */
+	NSVG_FIELD_OPACITY = 1 << 2, /* SVG4FNA change! */
+	NSVG_FIELD_FILL_OPACITY = 1 << 3, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE = 1 << 4, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_WIDTH = 1 << 5, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_DASHARRAY = 1 << 6, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_DASHOFFSET = 1 << 7, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_OPACITY = 1 << 8, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_LINECAP = 1 << 9, /* SVG4FNA change! */
+	NSVG_FIELD_STROKE_LINEJOIN = 1 << 10, /* SVG4FNA change! */
+	NSVG_FIELD_MITERLIMIT = 1 << 11, /* SVG4FNA change! */
+	NSVG_FIELD_FILL_RULE = 1 << 12, /* SVG4FNA change! */
+	NSVG_FIELD_FONT_SIZE = 1 << 13, /* SVG4FNA change! */
+	NSVG_FIELD_TRANSFORM = 1 << 14, /* SVG4FNA change! */
+	NSVG_FIELD_STOP_COLOR = 1 << 15, /* SVG4FNA change! */
+	NSVG_FIELD_STOP_OPACITY = 1 << 16, /* SVG4FNA change! */
+	NSVG_FIELD_OFFSET = 1 << 17 /* SVG4FNA change! */
+}; /* SVG4FNA change! */
+
+typedef struct NSVGmemoKey { /* SVG4FNA change! */
+	int str; // Offset into NSVGmemo's strings, the input may not outlive the tag /* SVG4FNA change! */
+	int len; /* SVG4FNA change! */
+	unsigned int hash; /* SVG4FNA change! */
+} NSVGmemoKey; /* SVG4FNA change! */
+
+typedef struct NSVGstyleMemo { /* SVG4FNA change! */
+	NSVGmemoKey key; /* SVG4FNA change! */
+	unsigned int fields; /* SVG4FNA change! */
+	NSVGattrib attr; // Only the listed fields are valid, and not the pointers /* SVG4FNA change! */
+	float xform[6]; /* SVG4FNA change! */
+	NSVGattribName fillGradient; /* SVG4FNA change! */
+	NSVGattribName strokeGradient; /* SVG4FNA change! */
+	NSVGattribDash strokeDashArray; /* SVG4FNA change! */
+} NSVGstyleMemo; /* SVG4FNA change! */
+
+typedef struct NSVGtransformMemo { /* SVG4FNA change! */
+	NSVGmemoKey key; /* SVG4FNA change! */
+	float xform[6]; /* SVG4FNA change! */
+} NSVGtransformMemo; /* SVG4FNA change! */
+
+// Everything a gradient depends on besides its data, any later shape that /* SVG4FNA change! */
+// matches it shares the gradient made for the first one /* SVG4FNA change! */
+typedef struct NSVGgradientKey { /* SVG4FNA change! */
+	NSVGgradientData* data; /* SVG4FNA change! */
+	float xform[6]; /* SVG4FNA change! */
+	float bounds[4]; // All 0 for userSpaceOnUse, which does not use them /* SVG4FNA change! */
+	int symbol; // Symbol space is never scaled to the viewBox /* SVG4FNA change! */
+} NSVGgradientKey; /* SVG4FNA change! */
+
+typedef struct NSVGgradientMemo { /* SVG4FNA change! */
+	NSVGmemoKey key; /* SVG4FNA change! */
+	NSVGgradient* gradient; /* SVG4FNA change! */
+} NSVGgradientMemo; /* SVG4FNA change! */
+
+// Open addressing over an array of entries, each starting with an NSVGmemoKey /* SVG4FNA change! */
+typedef struct NSVGmemo { /* SVG4FNA change! */
+	int* slots; // Entry index + 1, 0 is empty /* SVG4FNA change! */
+	int nslots; /* SVG4FNA change! */
+	unsigned char* entries; /* SVG4FNA change! */
+	int nentries; /* SVG4FNA change! */
+	int centries; /* SVG4FNA change! */
+	int entrySize; /* SVG4FNA change! */
+	char* strings; /* SVG4FNA change! */
+	int nstrings; /* SVG4FNA change! */
+	int cstrings; /* SVG4FNA change! */
+} NSVGmemo; /* SVG4FNA change! */
+
+enum NSVGparsePhase { /* SVG4FNA change! */
+	NSVG_PHASE_XML, /* SVG4FNA change! */
+	NSVG_PHASE_SYMBOLS, /* SVG4FNA change! */
+	NSVG_PHASE_GRADIENTS, /* SVG4FNA change! */
+	NSVG_PHASE_VIEWBOX, /* SVG4FNA change! */
+	NSVG_PHASE_DONE /* SVG4FNA change! */
+}; /* SVG4FNA change! */
+
+struct NSVGparser /* SVG4FNA change! */
 {
 	NSVGattrib attr[NSVG_MAX_ATTR];
 	int attrHead;
+	NSVGattribName attrIds[NSVG_MAX_ATTR]; /* SVG4FNA change! */
+	NSVGattribName attrFillGradients[NSVG_MAX_ATTR]; /* SVG4FNA change! */
+	NSVGattribName attrStrokeGradients[NSVG_MAX_ATTR]; /* SVG4FNA change! */
+	NSVGattribDash attrDashes[NSVG_MAX_ATTR]; /* SVG4FNA change! */
 	float* pts;
 	int npts;
 	int cpts;
@@ -296,7 +636,36 @@ typedef struct NSVGparser
 	float dpi;
 	char pathFlag;
 	char defsFlag;
-} NSVGparser;
+	NSVGmemo styleMemo; /* SVG4FNA change! */
+	NSVGmemo transformMemo; /* SVG4FNA change! */
+	NSVGmemo gradientMemo; /* SVG4FNA change! */
+	NSVGgradient* symbolGradients; // Gradients from here on are in symbol space /* SVG4FNA change! */
+	unsigned int styleFields; // NSVG_FIELD_* written since the style began /* SVG4FNA change! */
+	float styleXform[6]; /* SVG4FNA change! */
+	char styleDynamic; // The style depends on the current state, don't memoize it /* SVG4FNA change! */
+	char styleRecording; /* SVG4FNA change! */
+	NSVGxmlSpan xml; /* SVG4FNA change! */
+	char* inflated; // The input, if we own it /* SVG4FNA change! */
+	int phase; /* SVG4FNA change! */
+	NSVGshape* phaseShape; // Where the current phase resumes /* SVG4FNA change! */
+	float bounds[4]; // Of all shapes, gathered while creating gradients /* SVG4FNA change! */
+	float viewXform[5]; // tx, ty, sx, sy and their average /* SVG4FNA change! */
+	char units[8]; /* SVG4FNA change! */
+	NSVGsymbolData* symbols; /* SVG4FNA change! */
+	NSVGsymbolData* symbol; // The <symbol> being parsed, if any /* SVG4FNA change! */
+	NSVGshape* symbolTail; /* SVG4FNA change! */
+	int symbolDepth; // <symbol>s inside it, which are parsed like <g> /* SVG4FNA change! */
+	NSVGuseData* uses; // In document order, resolved as their shapes are reached /* SVG4FNA change! */
+	NSVGuseData* usesTail; /* SVG4FNA change! */
+	NSVGsymbolData* phaseSymbol; /* SVG4FNA change! */
+	char boundsValid; /* SVG4FNA change! */
+	NSVGshapeIdData* ids; // In document order, hashed into the image at the end /* SVG4FNA change! */
+	int nids; /* SVG4FNA change! */
+	int cids; /* SVG4FNA change! */
+	int groupIds[NSVG_MAX_ATTR]; // The <g> opened at each attribute depth, as ids index + 1 /* SVG4FNA change! */
+	int nimageShapes; /* SVG4FNA change! */
+	char elementId; // The element being parsed has an id of its own /* SVG4FNA change! */
+}; /* SVG4FNA change! */
 
 static void nsvg__xformIdentity(float* t)
 {
@@ -358,7 +727,7 @@ static void nsvg__xformInverse(float* inv, float* t)
 {
 	double invdet, det = (double)t[0] * t[3] - (double)t[2] * t[1];
 	if (det > -1e-6 && det < 1e-6) {
-		nsvg__xformIdentity(t);
+		nsvg__xformIdentity(inv); /* SVG4FNA change! */
 		return;
 	}
 	invdet = 1.0 / det;
@@ -462,13 +831,17 @@ static NSVGparser* nsvg__createParser(void)
 	if (p == NULL) goto error;
 	memset(p, 0, sizeof(NSVGparser));
 
-	p->image = (NSVGimage*)malloc(sizeof(NSVGimage));
+	p->image = (NSVGimage*)NSVG_IMAGE_MALLOC(sizeof(NSVGimage)); /* SVG4FNA change! */
 	if (p->image == NULL) goto error;
 	memset(p->image, 0, sizeof(NSVGimage));
 
 	// Init style
 	nsvg__xformIdentity(p->attr[0].xform);
-	memset(p->attr[0].id, 0, sizeof p->attr[0].id);
+	p->attr[0].id = p->attrIds[0]; /* SVG4FNA change! */
+	p->attr[0].fillGradient = p->attrFillGradients[0]; /* SVG4FNA change! */
+	p->attr[0].strokeGradient = p->attrStrokeGradients[0]; /* SVG4FNA change! */
+	p->attr[0].strokeDashArray = p->attrDashes[0]; /* SVG4FNA change! */
+	memset(p->attr[0].id, 0, sizeof(NSVGattribName)); /* SVG4FNA change! */
 	p->attr[0].fillColor = NSVG_RGB(0,0,0);
 	p->attr[0].strokeColor = NSVG_RGB(0,0,0);
 	p->attr[0].opacity = 1;
@@ -483,6 +856,10 @@ static NSVGparser* nsvg__createParser(void)
 	p->attr[0].hasFill = 1;
 	p->attr[0].visible = 1;
 
+	p->styleMemo.entrySize = sizeof(NSVGstyleMemo); /* SVG4FNA change! */
+	p->transformMemo.entrySize = sizeof(NSVGtransformMemo); /* SVG4FNA change! */
+	p->gradientMemo.entrySize = sizeof(NSVGgradientMemo); /* SVG4FNA change! */
+
 	return p;
 
 error:
@@ -497,19 +874,21 @@ static void nsvg__deletePaths(NSVGpath* path)
 {
 	while (path) {
 		NSVGpath *next = path->next;
-		if (path->pts != NULL)
-			free(path->pts);
+		if (path->ptsRefs != NULL) { /* SVG4FNA change! */
+			if (--(*path->ptsRefs) == 0) { /* SVG4FNA change! */
+				free(path->pts); /* SVG4FNA change! */
+				free(path->packed); /* SVG4FNA change! */
+				free(path->ptsRefs); /* SVG4FNA change! */
+			} /* SVG4FNA change! */
+		} else { /* SVG4FNA change! */
+			free(path->pts); /* SVG4FNA change! */
+			free(path->packed); /* SVG4FNA change! */
+		} /* SVG4FNA change! */
 		free(path);
 		path = next;
 	}
 }
 
-static void nsvg__deletePaint(NSVGpaint* paint)
-{
-	if (paint->type == NSVG_PAINT_LINEAR_GRADIENT || paint->type == NSVG_PAINT_RADIAL_GRADIENT)
-		free(paint->gradient);
-}
-
 static void nsvg__deleteGradientData(NSVGgradientData* grad)
 {
 	NSVGgradientData* next;
@@ -521,12 +900,46 @@ static void nsvg__deleteGradientData(NSVGgradientData* grad)
 	}
 }
 
+static void nsvg__deleteSymbolData(NSVGsymbolData* data) /* SVG4FNA change! */
+{
+	NSVGsymbolData* next;
+	while (data != NULL) {
+		next = data->next;
+		free(data);
+		data = next;
+	}
+}
+
+static void nsvg__deleteUseData(NSVGuseData* use) /* SVG4FNA change! */
+{
+	NSVGuseData* next;
+	while (use != NULL) {
+		next = use->next;
+		free(use);
+		use = next;
+	}
+}
+
 static void nsvg__deleteParser(NSVGparser* p)
 {
 	if (p != NULL) {
 		nsvg__deletePaths(p->plist);
 		nsvg__deleteGradientData(p->gradients);
 		nsvgDelete(p->image);
+		free(p->styleMemo.slots); /* SVG4FNA change! */
+		free(p->styleMemo.entries); /* SVG4FNA change! */
+		free(p->styleMemo.strings); /* SVG4FNA change! */
+		free(p->transformMemo.slots); /* SVG4FNA change! */
+		free(p->transformMemo.entries); /* SVG4FNA change! */
+		free(p->transformMemo.strings); /* SVG4FNA change! */
+		free(p->gradientMemo.slots); /* SVG4FNA change! */
+		free(p->gradientMemo.entries); /* SVG4FNA change! */
+		free(p->gradientMemo.strings); /* SVG4FNA change! */
+		free(p->xml.scratch); /* SVG4FNA change! */
+		free(p->inflated); /* SVG4FNA change! */
+		nsvg__deleteSymbolData(p->symbols); /* SVG4FNA change! */
+		nsvg__deleteUseData(p->uses); /* SVG4FNA change! */
+		free(p->ids); /* SVG4FNA change! */
 		free(p->pts);
 		free(p);
 	}
@@ -595,6 +1008,15 @@ static void nsvg__pushAttr(NSVGparser* p)
 	}
 }
 
+// Gives the current attribute its own copy of a shared chunk before writing it /* SVG4FNA change! */
+static void* nsvg__ownAttrChunk(NSVGparser* p, void* chunk, void* slots, size_t size) /* SVG4FNA change! */
+{
+	void* own = (unsigned char*)slots + size*p->attrHead;
+	if (chunk != own)
+		memcpy(own, chunk, size);
+	return own;
+}
+
 static void nsvg__popAttr(NSVGparser* p)
 {
 	if (p->attrHead > 0)
@@ -630,6 +1052,8 @@ static float nsvg__actualLength(NSVGparser* p)
 static float nsvg__convertToPixels(NSVGparser* p, NSVGcoordinate c, float orig, float length)
 {
 	NSVGattrib* attr = nsvg__getAttr(p);
+	if (c.units == NSVG_UNITS_EM || c.units == NSVG_UNITS_EX || c.units == NSVG_UNITS_PERCENT) /* SVG4FNA change! */
+		p->styleDynamic = 1; /* SVG4FNA change! */
 	switch (c.units) {
 		case NSVG_UNITS_USER:		return c.value;
 		case NSVG_UNITS_PX:			return c.value;
@@ -690,7 +1114,7 @@ static NSVGgradient* nsvg__createGradient(NSVGparser* p, const char* id, const f
 	}
 	if (stops == NULL) return NULL;
 
-	grad = (NSVGgradient*)malloc(sizeof(NSVGgradient) + sizeof(NSVGgradientStop)*(nstops-1));
+	grad = (NSVGgradient*)NSVG_IMAGE_MALLOC(sizeof(NSVGgradient) + sizeof(NSVGgradientStop)*(nstops-1)); /* SVG4FNA change! */
 	if (grad == NULL) return NULL;
 
 	// The shape width and height.
@@ -783,6 +1207,73 @@ static void nsvg__getLocalBounds(float* bounds, NSVGshape *shape, float* xform)
 	}
 }
 
+// Remembers the shapes the element being parsed draws from here on, if it has /* SVG4FNA change! */
+// an id and is not in a symbol. Returns the index in ids, or -1. /* SVG4FNA change! */
+static int nsvg__addShapeId(NSVGparser* p, int count) /* SVG4FNA change! */
+{
+	NSVGattrib* attr = nsvg__getAttr(p);
+	NSVGshapeIdData* id;
+
+	if (!p->elementId || attr->id[0] == '\0' || p->symbol != NULL || p->symbolDepth > 0)
+		return -1;
+	if (p->nids+1 > p->cids) {
+		int cids = p->cids ? p->cids*2 : 16;
+		NSVGshapeIdData* ids = (NSVGshapeIdData*)realloc(p->ids, cids*sizeof(NSVGshapeIdData));
+		if (ids == NULL)
+			return -1;
+		p->ids = ids;
+		p->cids = cids;
+	}
+	id = &p->ids[p->nids];
+	memcpy(id->id, attr->id, sizeof id->id);
+	id->index = p->nimageShapes;
+	id->count = count;
+	return p->nids++;
+}
+
+static void nsvg__endGroup(NSVGparser* p) /* SVG4FNA change! */
+{
+	int i = p->groupIds[p->attrHead] - 1;
+	if (i >= 0)
+		p->ids[i].count = p->nimageShapes - p->ids[i].index;
+	p->groupIds[p->attrHead] = 0;
+}
+
+// Adds to the image, or to the symbol being parsed /* SVG4FNA change! */
+static void nsvg__appendShape(NSVGparser* p, NSVGshape* shape) /* SVG4FNA change! */
+{
+	if (p->symbol != NULL) {
+		if (p->symbol->symbol->shapes == NULL)
+			p->symbol->symbol->shapes = shape;
+		else
+			p->symbolTail->next = shape;
+		p->symbolTail = shape;
+	} else {
+		if (p->image->shapes == NULL)
+			p->image->shapes = shape;
+		else
+			p->shapesTail->next = shape;
+		p->shapesTail = shape;
+		nsvg__addShapeId(p, 1); /* SVG4FNA change! */
+		p->nimageShapes++; /* SVG4FNA change! */
+	}
+}
+
+// Sets a paint that a <use> passes down, or a symbol's shape takes from one. /* SVG4FNA change! */
+// The opacity stays in color even when there is no color. /* SVG4FNA change! */
+static void nsvg__setInheritablePaint(NSVGpaint* paint, char hasPaint, unsigned int color, float opacity) /* SVG4FNA change! */
+{
+	unsigned int alpha = (unsigned int)(opacity*255) << 24;
+	if (hasPaint == 1) {
+		paint->type = NSVG_PAINT_COLOR;
+		paint->color = color | alpha;
+	} else {
+		// A gradient replaces the opacity once it is found
+		paint->type = (hasPaint == 2) ? NSVG_PAINT_UNDEF : NSVG_PAINT_NONE;
+		paint->color = alpha;
+	}
+}
+
 static void nsvg__addShape(NSVGparser* p)
 {
 	NSVGattrib* attr = nsvg__getAttr(p);
@@ -794,7 +1285,14 @@ static void nsvg__addShape(NSVGparser* p)
 	if (p->plist == NULL)
 		return;
 
-	shape = (NSVGshape*)malloc(sizeof(NSVGshape));
+	// Nested <symbol>s can't be used, so nothing inside them is drawn /* SVG4FNA change! */
+	if (p->symbolDepth > 0) { /* SVG4FNA change! */
+		nsvg__deletePaths(p->plist); /* SVG4FNA change! */
+		p->plist = NULL; /* SVG4FNA change! */
+		return; /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+
+	shape = (NSVGshape*)NSVG_IMAGE_MALLOC(sizeof(NSVGshape)); /* SVG4FNA change! */
 	if (shape == NULL) goto error;
 	memset(shape, 0, sizeof(NSVGshape));
 
@@ -854,12 +1352,22 @@ static void nsvg__addShape(NSVGparser* p)
 	// Set flags
 	shape->flags = (attr->visible ? NSVG_FLAGS_VISIBLE : 0x00);
 
+	// Paints a symbol leaves unset come from each <use> of it /* SVG4FNA change! */
+	if (attr->inherit & NSVG_FIELD_FILL) { /* SVG4FNA change! */
+		shape->flags |= NSVG_FLAGS_INHERIT_FILL; /* SVG4FNA change! */
+		nsvg__setInheritablePaint(&shape->fill, 0, 0, attr->fillOpacity); /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+	if (attr->inherit & NSVG_FIELD_FILL_OPACITY) /* SVG4FNA change! */
+		shape->flags |= NSVG_FLAGS_INHERIT_FILL_OPACITY; /* SVG4FNA change! */
+	if (attr->inherit & NSVG_FIELD_STROKE) { /* SVG4FNA change! */
+		shape->flags |= NSVG_FLAGS_INHERIT_STROKE; /* SVG4FNA change! */
+		nsvg__setInheritablePaint(&shape->stroke, 0, 0, attr->strokeOpacity); /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+	if (attr->inherit & NSVG_FIELD_STROKE_OPACITY) /* SVG4FNA change! */
+		shape->flags |= NSVG_FLAGS_INHERIT_STROKE_OPACITY; /* SVG4FNA change! */
+
 	// Add to tail
-	if (p->image->shapes == NULL)
-		p->image->shapes = shape;
-	else
-		p->shapesTail->next = shape;
-	p->shapesTail = shape;
+	nsvg__appendShape(p, shape); /* SVG4FNA change! */
 
 	return;
 
@@ -885,11 +1393,11 @@ static void nsvg__addPath(NSVGparser* p, char closed)
 	if ((p->npts % 3) != 1)
 		return;
 
-	path = (NSVGpath*)malloc(sizeof(NSVGpath));
+	path = (NSVGpath*)NSVG_IMAGE_MALLOC(sizeof(NSVGpath)); /* SVG4FNA change! */
 	if (path == NULL) goto error;
 	memset(path, 0, sizeof(NSVGpath));
 
-	path->pts = (float*)malloc(p->npts*2*sizeof(float));
+	path->pts = (float*)NSVG_IMAGE_MALLOC(p->npts*2*sizeof(float)); /* SVG4FNA change! */
 	if (path->pts == NULL) goto error;
 	path->closed = closed;
 	path->npts = p->npts;
@@ -1289,14 +1797,36 @@ NSVGNamedColor nsvg__colors[] = {
 #endif
 };
 
+#ifdef NANOSVG_ALL_COLOR_KEYWORDS /* SVG4FNA change! */
+// nanosvg_tokens.h is stale if this fails, run `make tokens` /* SVG4FNA change! */
+typedef char nsvg__colorTableCheck[(sizeof(nsvg__colors) / sizeof(NSVGNamedColor) == NSVG_COLOR_NAMES) ? 1 : -1]; /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+// Perfect hash lookups, see nanosvg_tokens.c for how the tables are built /* SVG4FNA change! */
+static int nsvg__lookupName(const char* s, const unsigned short* displace, int nbuckets, const unsigned char* slots, int bits) /* SVG4FNA change! */
+{
+	unsigned int h = 2166136261u;
+	while (*s)
+		h = (h ^ (unsigned char)*s++) * 16777619u;
+	h ^= displace[h % nbuckets];
+	return slots[(h * 2654435761u) >> (32 - bits)];
+}
+
+static int nsvg__token(const char* s) /* SVG4FNA change! */
+{
+	int token = nsvg__lookupName(s, nsvg__tokenDisplace, NSVG_TOKEN_BUCKETS, nsvg__tokenSlots, NSVG_TOKEN_BITS);
+	if (token != NSVG_TOKEN_UNKNOWN && strcmp(nsvg__tokenNames[token], s) == 0)
+		return token;
+	return NSVG_TOKEN_UNKNOWN;
+}
+
 static unsigned int nsvg__parseColorName(const char* str)
 {
 	int i, ncolors = sizeof(nsvg__colors) / sizeof(NSVGNamedColor);
 
-	for (i = 0; i < ncolors; i++) {
-		if (strcmp(nsvg__colors[i].name, str) == 0) {
-			return nsvg__colors[i].color;
-		}
+	i = nsvg__lookupName(str, nsvg__colorDisplace, NSVG_COLOR_BUCKETS, nsvg__colorSlots, NSVG_COLOR_BITS) - 1; /* SVG4FNA change! */
+	if (i >= 0 && i < ncolors && strcmp(nsvg__colors[i].name, str) == 0) { /* SVG4FNA change! */
+		return nsvg__colors[i].color;
 	}
 
 	return NSVG_RGB(128, 128, 128);
@@ -1531,6 +2061,124 @@ static void nsvg__parseTransform(float* xform, const char* str)
 	}
 }
 
+static unsigned int nsvg__memoHash(const char* str, int* len) /* SVG4FNA change! */
+{
+	const char* s = str;
+	unsigned int h = 2166136261u;
+	while (*s)
+		h = (h ^ (unsigned char)*s++) * 16777619u;
+	*len = (int)(s - str);
+	return h;
+}
+
+static unsigned int nsvg__memoHashBytes(const void* data, int len) /* SVG4FNA change! */
+{
+	const unsigned char* s = (const unsigned char*)data;
+	unsigned int h = 2166136261u;
+	while (len-- > 0)
+		h = (h ^ *s++) * 16777619u;
+	return h;
+}
+
+static NSVGmemoKey* nsvg__memoEntry(NSVGmemo* memo, int i) /* SVG4FNA change! */
+{
+	return (NSVGmemoKey*)(memo->entries + (size_t)i * memo->entrySize);
+}
+
+// Returns the entry for str, or NULL if there is none yet
+static void* nsvg__memoFind(NSVGmemo* memo, const char* str, int len, unsigned int hash) /* SVG4FNA change! */
+{
+	int i, mask = memo->nslots - 1;
+	if (memo->nslots == 0)
+		return NULL;
+	for (i = hash & mask; memo->slots[i] != 0; i = (i + 1) & mask) {
+		NSVGmemoKey* other = nsvg__memoEntry(memo, memo->slots[i] - 1);
+		if (other->hash == hash && other->len == len && memcmp(memo->strings + other->str, str, len) == 0)
+			return other;
+	}
+	return NULL;
+}
+
+// Adds an entry for str, which must not be in the memo yet. Returns NULL when
+// the memo is full or out of memory, the caller just doesn't memoize then.
+static void* nsvg__memoAdd(NSVGmemo* memo, const char* str, int len, unsigned int hash) /* SVG4FNA change! */
+{
+	NSVGmemoKey* entry;
+	int i, mask;
+
+	if (memo->nentries >= NSVG_MAX_MEMO)
+		return NULL;
+
+	if (memo->nstrings + len > memo->cstrings) {
+		int cstrings = memo->cstrings ? memo->cstrings : 1024;
+		char* strings;
+		while (memo->nstrings + len > cstrings)
+			cstrings *= 2;
+		strings = (char*)realloc(memo->strings, cstrings);
+		if (strings == NULL)
+			return NULL;
+		memo->strings = strings;
+		memo->cstrings = cstrings;
+	}
+
+	// Keep the slots at most half full
+	if ((memo->nentries + 1) * 2 > memo->nslots) {
+		int nslots = memo->nslots ? memo->nslots * 2 : 64;
+		int* slots = (int*)malloc(nslots * sizeof(int));
+		if (slots == NULL)
+			return NULL;
+		memset(slots, 0, nslots * sizeof(int));
+		for (i = 0; i < memo->nentries; i++) {
+			int j = nsvg__memoEntry(memo, i)->hash & (nslots - 1);
+			while (slots[j] != 0)
+				j = (j + 1) & (nslots - 1);
+			slots[j] = i + 1;
+		}
+		free(memo->slots);
+		memo->slots = slots;
+		memo->nslots = nslots;
+	}
+	if (memo->nentries + 1 > memo->centries) {
+		int centries = memo->centries ? memo->centries * 2 : 32;
+		unsigned char* entries = (unsigned char*)realloc(memo->entries, (size_t)centries * memo->entrySize);
+		if (entries == NULL)
+			return NULL;
+		memo->entries = entries;
+		memo->centries = centries;
+	}
+
+	entry = nsvg__memoEntry(memo, memo->nentries);
+	entry->str = memo->nstrings;
+	entry->len = len;
+	entry->hash = hash;
+	memcpy(memo->strings + memo->nstrings, str, len);
+	memo->nstrings += len;
+	mask = memo->nslots - 1;
+	for (i = hash & mask; memo->slots[i] != 0; i = (i + 1) & mask);
+	memo->slots[i] = ++memo->nentries;
+	return entry;
+}
+
+static void nsvg__parseTransformMemo(NSVGparser* p, float* xform, const char* str) /* SVG4FNA change! */
+{
+	NSVGtransformMemo* memo;
+	int len;
+	unsigned int hash = nsvg__memoHash(str, &len);
+
+	p->image->stats.transformLookups++;
+	memo = (NSVGtransformMemo*)nsvg__memoFind(&p->transformMemo, str, len, hash);
+	if (memo != NULL) {
+		p->image->stats.transformHits++;
+		memcpy(xform, memo->xform, sizeof(float)*6);
+		return;
+	}
+
+	nsvg__parseTransform(xform, str);
+	memo = (NSVGtransformMemo*)nsvg__memoAdd(&p->transformMemo, str, len, hash);
+	if (memo != NULL)
+		memcpy(memo->xform, xform, sizeof(float)*6);
+}
+
 static void nsvg__parseUrl(char* id, const char* str)
 {
 	int i = 0;
@@ -1622,79 +2270,137 @@ static int nsvg__parseStrokeDashArray(NSVGparser* p, const char* str, float* str
 
 static void nsvg__parseStyle(NSVGparser* p, const char* str);
 
-static int nsvg__parseAttr(NSVGparser* p, const char* name, const char* value)
+static int nsvg__parseTokenAttr(NSVGparser* p, int token, const char* value) /* SVG4FNA change! */
 {
 	float xform[6];
 	NSVGattrib* attr = nsvg__getAttr(p);
 	if (!attr) return 0;
 
-	if (strcmp(name, "style") == 0) {
+	switch (token) { /* SVG4FNA change! */
+	case NSVG_TOKEN_STYLE: /* SVG4FNA change! */
 		nsvg__parseStyle(p, value);
-	} else if (strcmp(name, "display") == 0) {
-		if (strcmp(value, "none") == 0)
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_DISPLAY: /* SVG4FNA change! */
+		if (strcmp(value, "none") == 0) { /* SVG4FNA change! */
 			attr->visible = 0;
+			p->styleFields |= NSVG_FIELD_VISIBLE; /* SVG4FNA change! */
+		} /* SVG4FNA change! */
 		// Don't reset ->visible on display:inline, one display:none hides the whole subtree
-
-	} else if (strcmp(name, "fill") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_FILL: /* SVG4FNA change! */
 		if (strcmp(value, "none") == 0) {
 			attr->hasFill = 0;
 		} else if (strncmp(value, "url(", 4) == 0) {
 			attr->hasFill = 2;
+			attr->fillGradient = (char*)nsvg__ownAttrChunk(p, attr->fillGradient, p->attrFillGradients, sizeof(NSVGattribName)); /* SVG4FNA change! */
 			nsvg__parseUrl(attr->fillGradient, value);
 		} else {
 			attr->hasFill = 1;
 			attr->fillColor = nsvg__parseColor(value);
 		}
-	} else if (strcmp(name, "opacity") == 0) {
+		attr->inherit &= ~NSVG_FIELD_FILL; /* SVG4FNA change! */
+		p->styleFields |= NSVG_FIELD_FILL; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_OPACITY: /* SVG4FNA change! */
 		attr->opacity = nsvg__parseOpacity(value);
-	} else if (strcmp(name, "fill-opacity") == 0) {
+		p->styleFields |= NSVG_FIELD_OPACITY; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_FILL_OPACITY: /* SVG4FNA change! */
 		attr->fillOpacity = nsvg__parseOpacity(value);
-	} else if (strcmp(name, "stroke") == 0) {
+		attr->inherit &= ~NSVG_FIELD_FILL_OPACITY; /* SVG4FNA change! */
+		p->styleFields |= NSVG_FIELD_FILL_OPACITY; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE: /* SVG4FNA change! */
 		if (strcmp(value, "none") == 0) {
 			attr->hasStroke = 0;
 		} else if (strncmp(value, "url(", 4) == 0) {
 			attr->hasStroke = 2;
+			attr->strokeGradient = (char*)nsvg__ownAttrChunk(p, attr->strokeGradient, p->attrStrokeGradients, sizeof(NSVGattribName)); /* SVG4FNA change! */
 			nsvg__parseUrl(attr->strokeGradient, value);
 		} else {
 			attr->hasStroke = 1;
 			attr->strokeColor = nsvg__parseColor(value);
 		}
-	} else if (strcmp(name, "stroke-width") == 0) {
+		attr->inherit &= ~NSVG_FIELD_STROKE; /* SVG4FNA change! */
+		p->styleFields |= NSVG_FIELD_STROKE; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_WIDTH: /* SVG4FNA change! */
 		attr->strokeWidth = nsvg__parseCoordinate(p, value, 0.0f, nsvg__actualLength(p));
-	} else if (strcmp(name, "stroke-dasharray") == 0) {
+		p->styleFields |= NSVG_FIELD_STROKE_WIDTH; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_DASHARRAY: /* SVG4FNA change! */
+		attr->strokeDashArray = (float*)nsvg__ownAttrChunk(p, attr->strokeDashArray, p->attrDashes, sizeof(NSVGattribDash)); /* SVG4FNA change! */
 		attr->strokeDashCount = nsvg__parseStrokeDashArray(p, value, attr->strokeDashArray);
-	} else if (strcmp(name, "stroke-dashoffset") == 0) {
+		p->styleFields |= NSVG_FIELD_STROKE_DASHARRAY; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_DASHOFFSET: /* SVG4FNA change! */
 		attr->strokeDashOffset = nsvg__parseCoordinate(p, value, 0.0f, nsvg__actualLength(p));
-	} else if (strcmp(name, "stroke-opacity") == 0) {
+		p->styleFields |= NSVG_FIELD_STROKE_DASHOFFSET; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_OPACITY: /* SVG4FNA change! */
 		attr->strokeOpacity = nsvg__parseOpacity(value);
-	} else if (strcmp(name, "stroke-linecap") == 0) {
+		attr->inherit &= ~NSVG_FIELD_STROKE_OPACITY; /* SVG4FNA change! */
+		p->styleFields |= NSVG_FIELD_STROKE_OPACITY; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_LINECAP: /* SVG4FNA change! */
 		attr->strokeLineCap = nsvg__parseLineCap(value);
-	} else if (strcmp(name, "stroke-linejoin") == 0) {
+		p->styleFields |= NSVG_FIELD_STROKE_LINECAP; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_LINEJOIN: /* SVG4FNA change! */
 		attr->strokeLineJoin = nsvg__parseLineJoin(value);
-	} else if (strcmp(name, "stroke-miterlimit") == 0) {
+		p->styleFields |= NSVG_FIELD_STROKE_LINEJOIN; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STROKE_MITERLIMIT: /* SVG4FNA change! */
 		attr->miterLimit = nsvg__parseMiterLimit(value);
-	} else if (strcmp(name, "fill-rule") == 0) {
+		p->styleFields |= NSVG_FIELD_MITERLIMIT; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_FILL_RULE: /* SVG4FNA change! */
 		attr->fillRule = nsvg__parseFillRule(value);
-	} else if (strcmp(name, "font-size") == 0) {
+		p->styleFields |= NSVG_FIELD_FILL_RULE; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_FONT_SIZE: /* SVG4FNA change! */
 		attr->fontSize = nsvg__parseCoordinate(p, value, 0.0f, nsvg__actualLength(p));
-	} else if (strcmp(name, "transform") == 0) {
-		nsvg__parseTransform(xform, value);
+		p->styleFields |= NSVG_FIELD_FONT_SIZE; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_TRANSFORM: /* SVG4FNA change! */
+		nsvg__parseTransformMemo(p, xform, value); /* SVG4FNA change! */
 		nsvg__xformPremultiply(attr->xform, xform);
-	} else if (strcmp(name, "stop-color") == 0) {
+		// A second transform would have to be multiplied in, rare enough to skip /* SVG4FNA change! */
+		if (p->styleFields & NSVG_FIELD_TRANSFORM) /* SVG4FNA change! */
+			p->styleDynamic = 1; /* SVG4FNA change! */
+		memcpy(p->styleXform, xform, sizeof(float)*6); /* SVG4FNA change! */
+		p->styleFields |= NSVG_FIELD_TRANSFORM; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STOP_COLOR: /* SVG4FNA change! */
 		attr->stopColor = nsvg__parseColor(value);
-	} else if (strcmp(name, "stop-opacity") == 0) {
+		p->styleFields |= NSVG_FIELD_STOP_COLOR; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STOP_OPACITY: /* SVG4FNA change! */
 		attr->stopOpacity = nsvg__parseOpacity(value);
-	} else if (strcmp(name, "offset") == 0) {
+		p->styleFields |= NSVG_FIELD_STOP_OPACITY; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_OFFSET: /* SVG4FNA change! */
 		attr->stopOffset = nsvg__parseCoordinate(p, value, 0.0f, 1.0f);
-	} else if (strcmp(name, "id") == 0) {
+		p->styleFields |= NSVG_FIELD_OFFSET; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_ID: /* SVG4FNA change! */
+		attr->id = (char*)nsvg__ownAttrChunk(p, attr->id, p->attrIds, sizeof(NSVGattribName)); /* SVG4FNA change! */
 		strncpy(attr->id, value, 63);
 		attr->id[63] = '\0';
-	} else {
+		p->styleDynamic = 1; // Not worth memoizing, ids are unique /* SVG4FNA change! */
+		p->elementId = 1; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	default: /* SVG4FNA change! */
 		return 0;
 	}
 	return 1;
 }
 
+static int nsvg__parseAttr(NSVGparser* p, const char* name, const char* value)
+{
+	return nsvg__parseTokenAttr(p, nsvg__token(name), value); /* SVG4FNA change! */
+}
+
 static int nsvg__parseNameValue(NSVGparser* p, const char* start, const char* end)
 {
 	const char* str;
@@ -1727,7 +2433,7 @@ static int nsvg__parseNameValue(NSVGparser* p, const char* start, const char* en
 	return nsvg__parseAttr(p, name, value);
 }
 
-static void nsvg__parseStyle(NSVGparser* p, const char* str)
+static void nsvg__parseStyleText(NSVGparser* p, const char* str) /* SVG4FNA change! */
 {
 	const char* start;
 	const char* end;
@@ -1748,15 +2454,120 @@ static void nsvg__parseStyle(NSVGparser* p, const char* str)
 	}
 }
 
+static void nsvg__mergeStyle(NSVGparser* p, NSVGattrib* attr, NSVGstyleMemo* memo) /* SVG4FNA change! */
+{
+	unsigned int fields = memo->fields;
+	attr->inherit &= ~fields;
+	if (fields & NSVG_FIELD_VISIBLE)
+		attr->visible = 0;
+	if (fields & NSVG_FIELD_FILL) {
+		attr->hasFill = memo->attr.hasFill;
+		if (attr->hasFill == 1) {
+			attr->fillColor = memo->attr.fillColor;
+		} else if (attr->hasFill == 2) {
+			attr->fillGradient = (char*)nsvg__ownAttrChunk(p, attr->fillGradient, p->attrFillGradients, sizeof(NSVGattribName));
+			memcpy(attr->fillGradient, memo->fillGradient, sizeof(NSVGattribName));
+		}
+	}
+	if (fields & NSVG_FIELD_OPACITY)
+		attr->opacity = memo->attr.opacity;
+	if (fields & NSVG_FIELD_FILL_OPACITY)
+		attr->fillOpacity = memo->attr.fillOpacity;
+	if (fields & NSVG_FIELD_STROKE) {
+		attr->hasStroke = memo->attr.hasStroke;
+		if (attr->hasStroke == 1) {
+			attr->strokeColor = memo->attr.strokeColor;
+		} else if (attr->hasStroke == 2) {
+			attr->strokeGradient = (char*)nsvg__ownAttrChunk(p, attr->strokeGradient, p->attrStrokeGradients, sizeof(NSVGattribName));
+			memcpy(attr->strokeGradient, memo->strokeGradient, sizeof(NSVGattribName));
+		}
+	}
+	if (fields & NSVG_FIELD_STROKE_WIDTH)
+		attr->strokeWidth = memo->attr.strokeWidth;
+	if (fields & NSVG_FIELD_STROKE_DASHARRAY) {
+		attr->strokeDashArray = (float*)nsvg__ownAttrChunk(p, attr->strokeDashArray, p->attrDashes, sizeof(NSVGattribDash));
+		memcpy(attr->strokeDashArray, memo->strokeDashArray, memo->attr.strokeDashCount * sizeof(float));
+		attr->strokeDashCount = memo->attr.strokeDashCount;
+	}
+	if (fields & NSVG_FIELD_STROKE_DASHOFFSET)
+		attr->strokeDashOffset = memo->attr.strokeDashOffset;
+	if (fields & NSVG_FIELD_STROKE_OPACITY)
+		attr->strokeOpacity = memo->attr.strokeOpacity;
+	if (fields & NSVG_FIELD_STROKE_LINECAP)
+		attr->strokeLineCap = memo->attr.strokeLineCap;
+	if (fields & NSVG_FIELD_STROKE_LINEJOIN)
+		attr->strokeLineJoin = memo->attr.strokeLineJoin;
+	if (fields & NSVG_FIELD_MITERLIMIT)
+		attr->miterLimit = memo->attr.miterLimit;
+	if (fields & NSVG_FIELD_FILL_RULE)
+		attr->fillRule = memo->attr.fillRule;
+	if (fields & NSVG_FIELD_FONT_SIZE)
+		attr->fontSize = memo->attr.fontSize;
+	if (fields & NSVG_FIELD_TRANSFORM)
+		nsvg__xformPremultiply(attr->xform, memo->xform);
+	if (fields & NSVG_FIELD_STOP_COLOR)
+		attr->stopColor = memo->attr.stopColor;
+	if (fields & NSVG_FIELD_STOP_OPACITY)
+		attr->stopOpacity = memo->attr.stopOpacity;
+	if (fields & NSVG_FIELD_OFFSET)
+		attr->stopOffset = memo->attr.stopOffset;
+}
+
+static void nsvg__parseStyle(NSVGparser* p, const char* str) /* SVG4FNA change! */
+{
+	NSVGattrib* attr = nsvg__getAttr(p);
+	NSVGstyleMemo* memo;
+	int len;
+	unsigned int hash;
+
+	if (p->styleRecording) {
+		// A style inside a style, just parse it and give up on the outer one
+		p->styleDynamic = 1;
+		nsvg__parseStyleText(p, str);
+		return;
+	}
+
+	hash = nsvg__memoHash(str, &len);
+	p->image->stats.styleLookups++;
+	memo = (NSVGstyleMemo*)nsvg__memoFind(&p->styleMemo, str, len, hash);
+	if (memo != NULL) {
+		p->image->stats.styleHits++;
+		nsvg__mergeStyle(p, attr, memo);
+		return;
+	}
+
+	p->styleFields = 0;
+	p->styleDynamic = 0;
+	p->styleRecording = 1;
+	nsvg__parseStyleText(p, str);
+	p->styleRecording = 0;
+	if (p->styleDynamic)
+		return;
+
+	memo = (NSVGstyleMemo*)nsvg__memoAdd(&p->styleMemo, str, len, hash);
+	if (memo == NULL)
+		return;
+	memo->fields = p->styleFields;
+	memo->attr = *attr;
+	memcpy(memo->xform, p->styleXform, sizeof(float)*6);
+	if ((memo->fields & NSVG_FIELD_FILL) && attr->hasFill == 2)
+		memcpy(memo->fillGradient, attr->fillGradient, sizeof(NSVGattribName));
+	if ((memo->fields & NSVG_FIELD_STROKE) && attr->hasStroke == 2)
+		memcpy(memo->strokeGradient, attr->strokeGradient, sizeof(NSVGattribName));
+	if (memo->fields & NSVG_FIELD_STROKE_DASHARRAY)
+		memcpy(memo->strokeDashArray, attr->strokeDashArray, attr->strokeDashCount * sizeof(float));
+}
+
 static void nsvg__parseAttribs(NSVGparser* p, const char** attr)
 {
 	int i;
 	for (i = 0; attr[i]; i += 2)
 	{
-		if (strcmp(attr[i], "style") == 0)
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (token == NSVG_TOKEN_STYLE) /* SVG4FNA change! */
 			nsvg__parseStyle(p, attr[i + 1]);
 		else
-			nsvg__parseAttr(p, attr[i], attr[i + 1]);
+			nsvg__parseTokenAttr(p, token, attr[i + 1]); /* SVG4FNA change! */
 	}
 }
 
@@ -2107,20 +2918,18 @@ static void nsvg__parsePath(NSVGparser* p, const char** attr)
 	int rargs = 0;
 	char initPoint;
 	float cpx, cpy, cpx2, cpy2;
-	const char* tmp[4];
 	char closedFlag;
 	int i;
 	char item[64];
 
 	for (i = 0; attr[i]; i += 2) {
-		if (strcmp(attr[i], "d") == 0) {
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (token == NSVG_TOKEN_D) { /* SVG4FNA change! */
 			s = attr[i + 1];
-		} else {
-			tmp[0] = attr[i];
-			tmp[1] = attr[i + 1];
-			tmp[2] = 0;
-			tmp[3] = 0;
-			nsvg__parseAttribs(p, tmp);
+		} else if (token == NSVG_TOKEN_STYLE) { /* SVG4FNA change! */
+			nsvg__parseStyle(p, attr[i + 1]); /* SVG4FNA change! */
+		} else { /* SVG4FNA change! */
+			nsvg__parseTokenAttr(p, token, attr[i + 1]); /* SVG4FNA change! */
 		}
 	}
 
@@ -2257,13 +3066,14 @@ static void nsvg__parseRect(NSVGparser* p, const char** attr)
 	int i;
 
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "x") == 0) x = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
-			if (strcmp(attr[i], "y") == 0) y = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
-			if (strcmp(attr[i], "width") == 0) w = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p));
-			if (strcmp(attr[i], "height") == 0) h = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p));
-			if (strcmp(attr[i], "rx") == 0) rx = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p)));
-			if (strcmp(attr[i], "ry") == 0) ry = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p)));
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_X) x = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_Y) y = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_WIDTH) w = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_HEIGHT) h = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_RX) rx = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p))); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_RY) ry = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p))); /* SVG4FNA change! */
 		}
 	}
 
@@ -2309,10 +3119,11 @@ static void nsvg__parseCircle(NSVGparser* p, const char** attr)
 	int i;
 
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "cx") == 0) cx = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
-			if (strcmp(attr[i], "cy") == 0) cy = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
-			if (strcmp(attr[i], "r") == 0) r = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualLength(p)));
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_CX) cx = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_CY) cy = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_R) r = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualLength(p))); /* SVG4FNA change! */
 		}
 	}
 
@@ -2340,11 +3151,12 @@ static void nsvg__parseEllipse(NSVGparser* p, const char** attr)
 	int i;
 
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "cx") == 0) cx = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
-			if (strcmp(attr[i], "cy") == 0) cy = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
-			if (strcmp(attr[i], "rx") == 0) rx = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p)));
-			if (strcmp(attr[i], "ry") == 0) ry = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p)));
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_CX) cx = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_CY) cy = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_RX) rx = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p))); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_RY) ry = fabsf(nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p))); /* SVG4FNA change! */
 		}
 	}
 
@@ -2373,11 +3185,12 @@ static void nsvg__parseLine(NSVGparser* p, const char** attr)
 	int i;
 
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "x1") == 0) x1 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
-			if (strcmp(attr[i], "y1") == 0) y1 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
-			if (strcmp(attr[i], "x2") == 0) x2 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
-			if (strcmp(attr[i], "y2") == 0) y2 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_X1) x1 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigX(p), nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_Y1) y1 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigY(p), nsvg__actualHeight(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_X2) x2 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigX(p), nsvg__actualWidth(p)); /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_Y2) y2 = nsvg__parseCoordinate(p, attr[i + 1], nsvg__actualOrigY(p), nsvg__actualHeight(p)); /* SVG4FNA change! */
 		}
 	}
 
@@ -2402,8 +3215,9 @@ static void nsvg__parsePoly(NSVGparser* p, const char** attr, int closeFlag)
 	nsvg__resetPath(p);
 
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "points") == 0) {
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_POINTS) { /* SVG4FNA change! */
 				s = attr[i + 1];
 				nargs = 0;
 				while (*s) {
@@ -2427,61 +3241,199 @@ static void nsvg__parsePoly(NSVGparser* p, const char** attr, int closeFlag)
 	nsvg__addShape(p);
 }
 
+// Returns 0 if the viewBox ends early, any missing values are left alone /* SVG4FNA change! */
+static int nsvg__parseViewBox(const char* s, float* minx, float* miny, float* width, float* height) /* SVG4FNA change! */
+{
+	char buf[64];
+	s = nsvg__parseNumber(s, buf, 64);
+	*minx = nsvg__atof(buf);
+	while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
+	if (!*s) return 0;
+	s = nsvg__parseNumber(s, buf, 64);
+	*miny = nsvg__atof(buf);
+	while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
+	if (!*s) return 0;
+	s = nsvg__parseNumber(s, buf, 64);
+	*width = nsvg__atof(buf);
+	while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
+	if (!*s) return 0;
+	s = nsvg__parseNumber(s, buf, 64);
+	*height = nsvg__atof(buf);
+	return 1;
+}
+
+static void nsvg__parseAspectRatio(const char* s, int* alignX, int* alignY, int* alignType) /* SVG4FNA change! */
+{
+	if (strstr(s, "none") != 0) {
+		// No uniform scaling
+		*alignType = NSVG_ALIGN_NONE;
+	} else {
+		// Parse X align
+		if (strstr(s, "xMin") != 0)
+			*alignX = NSVG_ALIGN_MIN;
+		else if (strstr(s, "xMid") != 0)
+			*alignX = NSVG_ALIGN_MID;
+		else if (strstr(s, "xMax") != 0)
+			*alignX = NSVG_ALIGN_MAX;
+		// Parse X align
+		if (strstr(s, "yMin") != 0)
+			*alignY = NSVG_ALIGN_MIN;
+		else if (strstr(s, "yMid") != 0)
+			*alignY = NSVG_ALIGN_MID;
+		else if (strstr(s, "yMax") != 0)
+			*alignY = NSVG_ALIGN_MAX;
+		// Parse meet/slice
+		*alignType = NSVG_ALIGN_MEET;
+		if (strstr(s, "slice") != 0)
+			*alignType = NSVG_ALIGN_SLICE;
+	}
+}
+
 static void nsvg__parseSVG(NSVGparser* p, const char** attr)
 {
 	int i;
 	for (i = 0; attr[i]; i += 2) {
-		if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "width") == 0) {
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_WIDTH) { /* SVG4FNA change! */
 				p->image->width = nsvg__parseCoordinate(p, attr[i + 1], 0.0f, 0.0f);
-			} else if (strcmp(attr[i], "height") == 0) {
+			} else if (token == NSVG_TOKEN_HEIGHT) { /* SVG4FNA change! */
 				p->image->height = nsvg__parseCoordinate(p, attr[i + 1], 0.0f, 0.0f);
-			} else if (strcmp(attr[i], "viewBox") == 0) {
-				const char *s = attr[i + 1];
-				char buf[64];
-				s = nsvg__parseNumber(s, buf, 64);
-				p->viewMinx = nsvg__atof(buf);
-				while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
-				if (!*s) return;
-				s = nsvg__parseNumber(s, buf, 64);
-				p->viewMiny = nsvg__atof(buf);
-				while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
-				if (!*s) return;
-				s = nsvg__parseNumber(s, buf, 64);
-				p->viewWidth = nsvg__atof(buf);
-				while (*s && (nsvg__isspace(*s) || *s == '%' || *s == ',')) s++;
-				if (!*s) return;
-				s = nsvg__parseNumber(s, buf, 64);
-				p->viewHeight = nsvg__atof(buf);
-			} else if (strcmp(attr[i], "preserveAspectRatio") == 0) {
-				if (strstr(attr[i + 1], "none") != 0) {
-					// No uniform scaling
-					p->alignType = NSVG_ALIGN_NONE;
-				} else {
-					// Parse X align
-					if (strstr(attr[i + 1], "xMin") != 0)
-						p->alignX = NSVG_ALIGN_MIN;
-					else if (strstr(attr[i + 1], "xMid") != 0)
-						p->alignX = NSVG_ALIGN_MID;
-					else if (strstr(attr[i + 1], "xMax") != 0)
-						p->alignX = NSVG_ALIGN_MAX;
-					// Parse X align
-					if (strstr(attr[i + 1], "yMin") != 0)
-						p->alignY = NSVG_ALIGN_MIN;
-					else if (strstr(attr[i + 1], "yMid") != 0)
-						p->alignY = NSVG_ALIGN_MID;
-					else if (strstr(attr[i + 1], "yMax") != 0)
-						p->alignY = NSVG_ALIGN_MAX;
-					// Parse meet/slice
-					p->alignType = NSVG_ALIGN_MEET;
-					if (strstr(attr[i + 1], "slice") != 0)
-						p->alignType = NSVG_ALIGN_SLICE;
-				}
+			} else if (token == NSVG_TOKEN_VIEWBOX) { /* SVG4FNA change! */
+				if (!nsvg__parseViewBox(attr[i + 1], &p->viewMinx, &p->viewMiny, &p->viewWidth, &p->viewHeight)) /* SVG4FNA change! */
+					return; /* SVG4FNA change! */
+			} else if (token == NSVG_TOKEN_PRESERVEASPECTRATIO) { /* SVG4FNA change! */
+				nsvg__parseAspectRatio(attr[i + 1], &p->alignX, &p->alignY, &p->alignType); /* SVG4FNA change! */
 			}
 		}
 	}
 }
 
+static void nsvg__parseSymbol(NSVGparser* p, const char** attr) /* SVG4FNA change! */
+{
+	NSVGsymbolData* data;
+	NSVGsymbol* symbol;
+	NSVGattrib* a;
+	int i;
+
+	nsvg__pushAttr(p);
+	data = p->symbol == NULL ? (NSVGsymbolData*)malloc(sizeof(NSVGsymbolData)) : NULL;
+	symbol = data != NULL ? (NSVGsymbol*)NSVG_IMAGE_MALLOC(sizeof(NSVGsymbol)) : NULL;
+	if (symbol == NULL) {
+		// Nested, or out of memory: parse it like a group, but drop its shapes
+		free(data);
+		p->symbolDepth++;
+		nsvg__parseAttribs(p, attr);
+		return;
+	}
+	memset(data, 0, sizeof(NSVGsymbolData));
+	memset(symbol, 0, sizeof(NSVGsymbol));
+	data->symbol = symbol;
+	data->alignX = NSVG_ALIGN_MID;
+	data->alignY = NSVG_ALIGN_MID;
+	data->alignType = NSVG_ALIGN_MEET;
+
+	// Paints left unset from here on are up to each <use>
+	a = nsvg__getAttr(p);
+	a->inherit = NSVG_FIELD_FILL | NSVG_FIELD_FILL_OPACITY | NSVG_FIELD_STROKE | NSVG_FIELD_STROKE_OPACITY;
+
+	for (i = 0; attr[i]; i += 2) {
+		int token = nsvg__token(attr[i]);
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) {
+			if (token == NSVG_TOKEN_VIEWBOX)
+				nsvg__parseViewBox(attr[i + 1], &data->viewBox[0], &data->viewBox[1], &data->viewBox[2], &data->viewBox[3]);
+			else if (token == NSVG_TOKEN_PRESERVEASPECTRATIO)
+				nsvg__parseAspectRatio(attr[i + 1], &data->alignX, &data->alignY, &data->alignType);
+		}
+	}
+
+	// The content is in symbol space, each <use> places it
+	a = nsvg__getAttr(p);
+	nsvg__xformIdentity(a->xform);
+	memcpy(symbol->id, a->id, sizeof symbol->id);
+
+	data->next = p->symbols;
+	p->symbols = data;
+	symbol->next = p->image->symbols;
+	p->image->symbols = symbol;
+	p->symbol = data;
+}
+
+static void nsvg__endSymbol(NSVGparser* p) /* SVG4FNA change! */
+{
+	if (p->symbolDepth > 0) {
+		p->symbolDepth--;
+		nsvg__popAttr(p);
+	} else if (p->symbol != NULL) {
+		p->symbol = NULL;
+		nsvg__popAttr(p);
+	}
+}
+
+// Adds a shape that draws a symbol, once nsvg__resolveUse finds it /* SVG4FNA change! */
+static void nsvg__parseUse(NSVGparser* p, const char** attr) /* SVG4FNA change! */
+{
+	NSVGattrib* a = nsvg__getAttr(p);
+	NSVGshape* shape;
+	NSVGuseData* use;
+	const char* href = NULL;
+	float x = 0.0f, y = 0.0f, w = 0.0f, h = 0.0f;
+	int i;
+
+	for (i = 0; attr[i]; i += 2) {
+		int token = nsvg__token(attr[i]);
+		if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) {
+			if (token == NSVG_TOKEN_X) x = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigX(p), nsvg__actualWidth(p));
+			if (token == NSVG_TOKEN_Y) y = nsvg__parseCoordinate(p, attr[i+1], nsvg__actualOrigY(p), nsvg__actualHeight(p));
+			if (token == NSVG_TOKEN_WIDTH) w = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualWidth(p));
+			if (token == NSVG_TOKEN_HEIGHT) h = nsvg__parseCoordinate(p, attr[i+1], 0.0f, nsvg__actualHeight(p));
+			if (token == NSVG_TOKEN_HREF || token == NSVG_TOKEN_XLINK_HREF) href = attr[i+1];
+		}
+	}
+	if (href == NULL || href[0] != '#' || href[1] == '\0')
+		return;
+
+	shape = (NSVGshape*)NSVG_IMAGE_MALLOC(sizeof(NSVGshape));
+	use = (NSVGuseData*)malloc(sizeof(NSVGuseData));
+	if (shape == NULL || use == NULL) {
+		free(shape);
+		free(use);
+		return;
+	}
+	memset(shape, 0, sizeof(NSVGshape));
+	memset(use, 0, sizeof(NSVGuseData));
+
+	// a->xform may have been changed by the attributes above
+	a = nsvg__getAttr(p);
+	memcpy(shape->id, a->id, sizeof shape->id);
+	// Paints for the symbol's shapes that leave theirs unset
+	nsvg__setInheritablePaint(&shape->fill, a->hasFill, a->fillColor, a->fillOpacity);
+	nsvg__setInheritablePaint(&shape->stroke, a->hasStroke, a->strokeColor, a->strokeOpacity);
+	if (a->hasFill == 2)
+		memcpy(shape->fillGradient, a->fillGradient, sizeof shape->fillGradient);
+	if (a->hasStroke == 2)
+		memcpy(shape->strokeGradient, a->strokeGradient, sizeof shape->strokeGradient);
+	// Its gradients are in symbol space, like those of the symbol's shapes
+	nsvg__xformIdentity(shape->xform);
+	shape->opacity = a->opacity;
+	shape->flags = (a->visible ? NSVG_FLAGS_VISIBLE : 0x00);
+	nsvg__xformSetTranslation(shape->symbolXform, x, y);
+	nsvg__xformMultiply(shape->symbolXform, a->xform);
+
+	use->shape = shape;
+	strncpy(use->href, href + 1, 63);
+	use->href[63] = '\0';
+	use->width = w;
+	use->height = h;
+	if (p->uses == NULL)
+		p->uses = use;
+	else
+		p->usesTail->next = use;
+	p->usesTail = use;
+
+	nsvg__appendShape(p, shape);
+}
+
 static void nsvg__parseGradient(NSVGparser* p, const char** attr, signed char type)
 {
 	int i;
@@ -2506,45 +3458,46 @@ static void nsvg__parseGradient(NSVGparser* p, const char** attr, signed char ty
 	int setfy = 0;
 
 	for (i = 0; attr[i]; i += 2) {
-		if (strcmp(attr[i], "id") == 0) {
+		int token = nsvg__token(attr[i]); /* SVG4FNA change! */
+		if (token == NSVG_TOKEN_ID) { /* SVG4FNA change! */
 			strncpy(grad->id, attr[i+1], 63);
 			grad->id[63] = '\0';
-		} else if (!nsvg__parseAttr(p, attr[i], attr[i + 1])) {
-			if (strcmp(attr[i], "gradientUnits") == 0) {
+		} else if (!nsvg__parseTokenAttr(p, token, attr[i + 1])) { /* SVG4FNA change! */
+			if (token == NSVG_TOKEN_GRADIENTUNITS) { /* SVG4FNA change! */
 				if (strcmp(attr[i+1], "objectBoundingBox") == 0)
 					grad->units = NSVG_OBJECT_SPACE;
 				else
 					grad->units = NSVG_USER_SPACE;
-			} else if (strcmp(attr[i], "gradientTransform") == 0) {
-				nsvg__parseTransform(grad->xform, attr[i + 1]);
-			} else if (strcmp(attr[i], "cx") == 0) {
+			} else if (token == NSVG_TOKEN_GRADIENTTRANSFORM) { /* SVG4FNA change! */
+				nsvg__parseTransformMemo(p, grad->xform, attr[i + 1]); /* SVG4FNA change! */
+			} else if (token == NSVG_TOKEN_CX) { /* SVG4FNA change! */
 				grad->radial.cx = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "cy") == 0) {
+			} else if (token == NSVG_TOKEN_CY) { /* SVG4FNA change! */
 				grad->radial.cy = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "r") == 0) {
+			} else if (token == NSVG_TOKEN_R) { /* SVG4FNA change! */
 				grad->radial.r = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "fx") == 0) {
+			} else if (token == NSVG_TOKEN_FX) { /* SVG4FNA change! */
 				grad->radial.fx = nsvg__parseCoordinateRaw(attr[i + 1]);
 				setfx = 1;
-			} else if (strcmp(attr[i], "fy") == 0) {
+			} else if (token == NSVG_TOKEN_FY) { /* SVG4FNA change! */
 				grad->radial.fy = nsvg__parseCoordinateRaw(attr[i + 1]);
 				setfy = 1;
-			} else if (strcmp(attr[i], "x1") == 0) {
+			} else if (token == NSVG_TOKEN_X1) { /* SVG4FNA change! */
 				grad->linear.x1 = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "y1") == 0) {
+			} else if (token == NSVG_TOKEN_Y1) { /* SVG4FNA change! */
 				grad->linear.y1 = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "x2") == 0) {
+			} else if (token == NSVG_TOKEN_X2) { /* SVG4FNA change! */
 				grad->linear.x2 = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "y2") == 0) {
+			} else if (token == NSVG_TOKEN_Y2) { /* SVG4FNA change! */
 				grad->linear.y2 = nsvg__parseCoordinateRaw(attr[i + 1]);
-			} else if (strcmp(attr[i], "spreadMethod") == 0) {
+			} else if (token == NSVG_TOKEN_SPREADMETHOD) { /* SVG4FNA change! */
 				if (strcmp(attr[i+1], "pad") == 0)
 					grad->spread = NSVG_SPREAD_PAD;
 				else if (strcmp(attr[i+1], "reflect") == 0)
 					grad->spread = NSVG_SPREAD_REFLECT;
 				else if (strcmp(attr[i+1], "repeat") == 0)
 					grad->spread = NSVG_SPREAD_REPEAT;
-			} else if (strcmp(attr[i], "xlink:href") == 0) {
+			} else if (token == NSVG_TOKEN_XLINK_HREF) { /* SVG4FNA change! */
 				const char *href = attr[i+1];
 				strncpy(grad->ref, href+1, 62);
 				grad->ref[62] = '\0';
@@ -2609,68 +3562,104 @@ static void nsvg__parseGradientStop(NSVGparser* p, const char** attr)
 static void nsvg__startElement(void* ud, const char* el, const char** attr)
 {
 	NSVGparser* p = (NSVGparser*)ud;
+	int token = nsvg__token(el); /* SVG4FNA change! */
 
-	if (p->defsFlag) {
+	p->elementId = 0; /* SVG4FNA change! */
+	if (p->defsFlag && p->symbol == NULL) { /* SVG4FNA change! */
 		// Skip everything but gradients in defs
-		if (strcmp(el, "linearGradient") == 0) {
+		switch (token) { /* SVG4FNA change! */
+		case NSVG_TOKEN_SYMBOL: /* SVG4FNA change! */
+			nsvg__parseSymbol(p, attr); /* SVG4FNA change! */
+			break; /* SVG4FNA change! */
+		case NSVG_TOKEN_LINEARGRADIENT: /* SVG4FNA change! */
 			nsvg__parseGradient(p, attr, NSVG_PAINT_LINEAR_GRADIENT);
-		} else if (strcmp(el, "radialGradient") == 0) {
+			break; /* SVG4FNA change! */
+		case NSVG_TOKEN_RADIALGRADIENT: /* SVG4FNA change! */
 			nsvg__parseGradient(p, attr, NSVG_PAINT_RADIAL_GRADIENT);
-		} else if (strcmp(el, "stop") == 0) {
+			break; /* SVG4FNA change! */
+		case NSVG_TOKEN_STOP: /* SVG4FNA change! */
 			nsvg__parseGradientStop(p, attr);
-		} else if (strcmp(el, "path") == 0) { // flibit added this block
+			break; /* SVG4FNA change! */
+		case NSVG_TOKEN_PATH: // flibit added this block /* SVG4FNA change! */
 			if (p->pathFlag)	// Do not allow nested paths.
 				return;
 			nsvg__pushAttr(p);
 			nsvg__parsePath(p, attr);
 			nsvg__popAttr(p);
+			break; /* SVG4FNA change! */
 		}
 		return;
 	}
 
-	if (strcmp(el, "g") == 0) {
+	switch (token) { /* SVG4FNA change! */
+	case NSVG_TOKEN_G: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parseAttribs(p, attr);
-	} else if (strcmp(el, "path") == 0) {
+		p->groupIds[p->attrHead] = nsvg__addShapeId(p, -1) + 1; /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_PATH: /* SVG4FNA change! */
 		if (p->pathFlag)	// Do not allow nested paths.
 			return;
 		nsvg__pushAttr(p);
 		nsvg__parsePath(p, attr);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "rect") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_RECT: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parseRect(p, attr);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "circle") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_CIRCLE: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parseCircle(p, attr);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "ellipse") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_ELLIPSE: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parseEllipse(p, attr);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "line") == 0)  {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_LINE: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parseLine(p, attr);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "polyline") == 0)  {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_POLYLINE: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parsePoly(p, attr, 0);
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "polygon") == 0)  {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_POLYGON: /* SVG4FNA change! */
 		nsvg__pushAttr(p);
 		nsvg__parsePoly(p, attr, 1);
 		nsvg__popAttr(p);
-	} else  if (strcmp(el, "linearGradient") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_LINEARGRADIENT: /* SVG4FNA change! */
 		nsvg__parseGradient(p, attr, NSVG_PAINT_LINEAR_GRADIENT);
-	} else if (strcmp(el, "radialGradient") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_RADIALGRADIENT: /* SVG4FNA change! */
 		nsvg__parseGradient(p, attr, NSVG_PAINT_RADIAL_GRADIENT);
-	} else if (strcmp(el, "stop") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_STOP: /* SVG4FNA change! */
 		nsvg__parseGradientStop(p, attr);
-	} else if (strcmp(el, "defs") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_DEFS: /* SVG4FNA change! */
 		p->defsFlag = 1;
-	} else if (strcmp(el, "svg") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_SYMBOL: /* SVG4FNA change! */
+		nsvg__parseSymbol(p, attr); /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_USE: /* SVG4FNA change! */
+		// Not inside symbols, so instances never nest /* SVG4FNA change! */
+		if (p->symbol != NULL || p->symbolDepth > 0) /* SVG4FNA change! */
+			return; /* SVG4FNA change! */
+		nsvg__pushAttr(p); /* SVG4FNA change! */
+		nsvg__parseUse(p, attr); /* SVG4FNA change! */
+		nsvg__popAttr(p); /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_SVG: /* SVG4FNA change! */
 		nsvg__parseSVG(p, attr);
+		break; /* SVG4FNA change! */
 	}
 }
 
@@ -2678,12 +3667,20 @@ static void nsvg__endElement(void* ud, const char* el)
 {
 	NSVGparser* p = (NSVGparser*)ud;
 
-	if (strcmp(el, "g") == 0) {
+	switch (nsvg__token(el)) { /* SVG4FNA change! */
+	case NSVG_TOKEN_G: /* SVG4FNA change! */
+		nsvg__endGroup(p); /* SVG4FNA change! */
 		nsvg__popAttr(p);
-	} else if (strcmp(el, "path") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_PATH: /* SVG4FNA change! */
 		p->pathFlag = 0;
-	} else if (strcmp(el, "defs") == 0) {
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_DEFS: /* SVG4FNA change! */
 		p->defsFlag = 0;
+		break; /* SVG4FNA change! */
+	case NSVG_TOKEN_SYMBOL: /* SVG4FNA change! */
+		nsvg__endSymbol(p); /* SVG4FNA change! */
+		break; /* SVG4FNA change! */
 	}
 }
 
@@ -2694,19 +3691,18 @@ static void nsvg__content(void* ud, const char* s)
 	// empty
 }
 
-static void nsvg__imageBounds(NSVGparser* p, float* bounds)
+static void nsvg__addImageBounds(NSVGparser* p, NSVGshape* shape) /* SVG4FNA change! */
 {
-	NSVGshape* shape;
-	shape = p->image->shapes;
-	if (shape == NULL) {
-		bounds[0] = bounds[1] = bounds[2] = bounds[3] = 0.0;
+	float* bounds = p->bounds;
+	if (shape->paths == NULL && shape->symbol == NULL)
 		return;
-	}
-	bounds[0] = shape->bounds[0];
-	bounds[1] = shape->bounds[1];
-	bounds[2] = shape->bounds[2];
-	bounds[3] = shape->bounds[3];
-	for (shape = shape->next; shape != NULL; shape = shape->next) {
+	if (!p->boundsValid) {
+		p->boundsValid = 1;
+		bounds[0] = shape->bounds[0];
+		bounds[1] = shape->bounds[1];
+		bounds[2] = shape->bounds[2];
+		bounds[3] = shape->bounds[3];
+	} else {
 		bounds[0] = nsvg__minf(bounds[0], shape->bounds[0]);
 		bounds[1] = nsvg__minf(bounds[1], shape->bounds[1]);
 		bounds[2] = nsvg__maxf(bounds[2], shape->bounds[2]);
@@ -2734,17 +3730,13 @@ static void nsvg__scaleGradient(NSVGgradient* grad, float tx, float ty, float sx
 	nsvg__xformMultiply (grad->xform, t);
 }
 
-static void nsvg__scaleToViewbox(NSVGparser* p, const char* units)
+// Picks the viewBox transform once all shapes are known, p->bounds must hold /* SVG4FNA change! */
+// their bounds (all 0 when there are none) /* SVG4FNA change! */
+static void nsvg__beginScaleToViewbox(NSVGparser* p, const char* units) /* SVG4FNA change! */
 {
-	NSVGshape* shape;
-	NSVGpath* path;
-	float tx, ty, sx, sy, us, bounds[4], t[6], avgs;
-	int i;
-	float* pt;
+	float tx, ty, sx, sy, us, *bounds = p->bounds; /* SVG4FNA change! */
 
 	// Guess image size if not set completely.
-	nsvg__imageBounds(p, bounds);
-
 	if (p->viewWidth == 0) {
 		if (p->image->width > 0) {
 			p->viewWidth = p->image->width;
@@ -2789,99 +3781,565 @@ static void nsvg__scaleToViewbox(NSVGparser* p, const char* units)
 	// Transform
 	sx *= us;
 	sy *= us;
-	avgs = (sx+sy) / 2.0f;
-	for (shape = p->image->shapes; shape != NULL; shape = shape->next) {
-		shape->bounds[0] = (shape->bounds[0] + tx) * sx;
-		shape->bounds[1] = (shape->bounds[1] + ty) * sy;
-		shape->bounds[2] = (shape->bounds[2] + tx) * sx;
-		shape->bounds[3] = (shape->bounds[3] + ty) * sy;
-		for (path = shape->paths; path != NULL; path = path->next) {
-			path->bounds[0] = (path->bounds[0] + tx) * sx;
-			path->bounds[1] = (path->bounds[1] + ty) * sy;
-			path->bounds[2] = (path->bounds[2] + tx) * sx;
-			path->bounds[3] = (path->bounds[3] + ty) * sy;
-			for (i =0; i < path->npts; i++) {
-				pt = &path->pts[i*2];
-				pt[0] = (pt[0] + tx) * sx;
-				pt[1] = (pt[1] + ty) * sy;
-			}
-		}
-
-		if (shape->fill.type == NSVG_PAINT_LINEAR_GRADIENT || shape->fill.type == NSVG_PAINT_RADIAL_GRADIENT) {
-			nsvg__scaleGradient(shape->fill.gradient, tx,ty, sx,sy);
-			memcpy(t, shape->fill.gradient->xform, sizeof(float)*6);
-			nsvg__xformInverse(shape->fill.gradient->xform, t);
-		}
-		if (shape->stroke.type == NSVG_PAINT_LINEAR_GRADIENT || shape->stroke.type == NSVG_PAINT_RADIAL_GRADIENT) {
-			nsvg__scaleGradient(shape->stroke.gradient, tx,ty, sx,sy);
-			memcpy(t, shape->stroke.gradient->xform, sizeof(float)*6);
-			nsvg__xformInverse(shape->stroke.gradient->xform, t);
-		}
-
-		shape->strokeWidth *= avgs;
-		shape->strokeDashOffset *= avgs;
-		for (i = 0; i < shape->strokeDashCount; i++)
-			shape->strokeDashArray[i] *= avgs;
-	}
+	p->viewXform[0] = tx; /* SVG4FNA change! */
+	p->viewXform[1] = ty; /* SVG4FNA change! */
+	p->viewXform[2] = sx; /* SVG4FNA change! */
+	p->viewXform[3] = sy; /* SVG4FNA change! */
+	p->viewXform[4] = (sx+sy) / 2.0f; /* SVG4FNA change! */
 }
 
-static void nsvg__createGradients(NSVGparser* p)
+static void nsvg__scaleToViewbox(NSVGparser* p, NSVGshape* shape) /* SVG4FNA change! */
 {
-	NSVGshape* shape;
+	NSVGpath* path;
+	float tx = p->viewXform[0], ty = p->viewXform[1]; /* SVG4FNA change! */
+	float sx = p->viewXform[2], sy = p->viewXform[3], avgs = p->viewXform[4]; /* SVG4FNA change! */
+	float t[6]; /* SVG4FNA change! */
+	int i;
+	float* pt;
 
-	for (shape = p->image->shapes; shape != NULL; shape = shape->next) {
-		if (shape->fill.type == NSVG_PAINT_UNDEF) {
-			if (shape->fillGradient[0] != '\0') {
-				float inv[6], localBounds[4];
-				nsvg__xformInverse(inv, shape->xform);
-				nsvg__getLocalBounds(localBounds, shape, inv);
-				shape->fill.gradient = nsvg__createGradient(p, shape->fillGradient, localBounds, shape->xform, &shape->fill.type);
-			}
-			if (shape->fill.type == NSVG_PAINT_UNDEF) {
-				shape->fill.type = NSVG_PAINT_NONE;
-			}
-		}
-		if (shape->stroke.type == NSVG_PAINT_UNDEF) {
-			if (shape->strokeGradient[0] != '\0') {
-				float inv[6], localBounds[4];
-				nsvg__xformInverse(inv, shape->xform);
-				nsvg__getLocalBounds(localBounds, shape, inv);
-				shape->stroke.gradient = nsvg__createGradient(p, shape->strokeGradient, localBounds, shape->xform, &shape->stroke.type);
-			}
-			if (shape->stroke.type == NSVG_PAINT_UNDEF) {
-				shape->stroke.type = NSVG_PAINT_NONE;
-			}
+	shape->bounds[0] = (shape->bounds[0] + tx) * sx;
+	shape->bounds[1] = (shape->bounds[1] + ty) * sy;
+	shape->bounds[2] = (shape->bounds[2] + tx) * sx;
+	shape->bounds[3] = (shape->bounds[3] + ty) * sy;
+	for (path = shape->paths; path != NULL; path = path->next) {
+		path->bounds[0] = (path->bounds[0] + tx) * sx;
+		path->bounds[1] = (path->bounds[1] + ty) * sy;
+		path->bounds[2] = (path->bounds[2] + tx) * sx;
+		path->bounds[3] = (path->bounds[3] + ty) * sy;
+		for (i =0; i < path->npts; i++) {
+			pt = &path->pts[i*2];
+			pt[0] = (pt[0] + tx) * sx;
+			pt[1] = (pt[1] + ty) * sy;
 		}
 	}
-}
-
-NSVGimage* nsvgParse(char* input, const char* units, float dpi)
-{
-	NSVGparser* p;
-	NSVGimage* ret = 0;
 
-	p = nsvg__createParser();
-	if (p == NULL) {
-		return NULL;
-	}
-	p->dpi = dpi;
+	// Gradients are shared between shapes, nsvg__finishGradients scales them /* SVG4FNA change! */
 
-	nsvg__parseXML(input, nsvg__startElement, nsvg__endElement, nsvg__content, p);
+	shape->strokeWidth *= avgs;
+	shape->strokeDashOffset *= avgs;
+	for (i = 0; i < shape->strokeDashCount; i++)
+		shape->strokeDashArray[i] *= avgs;
 
-	// Create gradients after all definitions have been parsed
-	nsvg__createGradients(p);
+	// Instances draw their symbol through symbolXform, so scale that instead /* SVG4FNA change! */
+	if (shape->symbol != NULL) { /* SVG4FNA change! */
+		nsvg__xformSetTranslation(t, tx, ty); /* SVG4FNA change! */
+		nsvg__xformMultiply(shape->symbolXform, t); /* SVG4FNA change! */
+		nsvg__xformSetScale(t, sx, sy); /* SVG4FNA change! */
+		nsvg__xformMultiply(shape->symbolXform, t); /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+}
 
-	// Scale to viewBox
-	nsvg__scaleToViewbox(p, units);
+// Makes a gradient only for the first shape with a given transform and, for /* SVG4FNA change! */
+// objectBoundingBox units, local bounds, later ones share it /* SVG4FNA change! */
+static NSVGgradient* nsvg__internGradient(NSVGparser* p, const char* id, NSVGshape* shape, signed char* paintType) /* SVG4FNA change! */
+{
+	NSVGgradientKey key;
+	NSVGgradientMemo* memo;
+	NSVGgradient* grad;
+	unsigned int hash;
+	float inv[6];
+
+	memset(&key, 0, sizeof(key));
+	key.data = nsvg__findGradientData(p, id);
+	if (key.data == NULL) return NULL;
+	memcpy(key.xform, shape->xform, sizeof(key.xform));
+	if (key.data->units == NSVG_OBJECT_SPACE && shape->symbol != NULL) {
+		// An instance's gradient spans the whole symbol
+		memcpy(key.bounds, shape->symbol->bounds, sizeof(key.bounds));
+	} else if (key.data->units == NSVG_OBJECT_SPACE) {
+		nsvg__xformInverse(inv, shape->xform);
+		nsvg__getLocalBounds(key.bounds, shape, inv);
+	}
+	key.symbol = (p->phase == NSVG_PHASE_SYMBOLS);
+	hash = nsvg__memoHashBytes(&key, sizeof(key));
+
+	p->image->stats.gradientLookups++;
+	memo = (NSVGgradientMemo*)nsvg__memoFind(&p->gradientMemo, (const char*)&key, sizeof(key), hash);
+	if (memo != NULL) {
+		p->image->stats.gradientHits++;
+		*paintType = key.data->type;
+		return memo->gradient;
+	}
+
+	grad = nsvg__createGradient(p, id, key.bounds, shape->xform, paintType);
+	if (grad == NULL) return NULL;
+	grad->next = p->image->gradients;
+	p->image->gradients = grad;
+
+	// When the memo is full the gradient just isn't shared
+	memo = (NSVGgradientMemo*)nsvg__memoAdd(&p->gradientMemo, (const char*)&key, sizeof(key), hash);
+	if (memo != NULL)
+		memo->gradient = grad;
+	return grad;
+}
+
+// Inverts the gradients from grad up to end, once each however many shapes /* SVG4FNA change! */
+// share them. Image space ones are scaled to the viewBox first. /* SVG4FNA change! */
+static void nsvg__finishGradients(NSVGparser* p, NSVGgradient* grad, NSVGgradient* end, int scale) /* SVG4FNA change! */
+{
+	float t[6];
+	for (; grad != end; grad = grad->next) {
+		if (scale)
+			nsvg__scaleGradient(grad, p->viewXform[0], p->viewXform[1], p->viewXform[2], p->viewXform[3]);
+		memcpy(t, grad->xform, sizeof(float)*6);
+		nsvg__xformInverse(grad->xform, t);
+	}
+}
+
+static void nsvg__createGradients(NSVGparser* p, NSVGshape* shape) /* SVG4FNA change! */
+{
+	if (shape->fill.type == NSVG_PAINT_UNDEF) {
+		if (shape->fillGradient[0] != '\0') {
+			shape->fill.gradient = nsvg__internGradient(p, shape->fillGradient, shape, &shape->fill.type);
+		}
+		if (shape->fill.type == NSVG_PAINT_UNDEF) {
+			shape->fill.type = NSVG_PAINT_NONE;
+		}
+	}
+	if (shape->stroke.type == NSVG_PAINT_UNDEF) {
+		if (shape->strokeGradient[0] != '\0') {
+			shape->stroke.gradient = nsvg__internGradient(p, shape->strokeGradient, shape, &shape->stroke.type);
+		}
+		if (shape->stroke.type == NSVG_PAINT_UNDEF) {
+			shape->stroke.type = NSVG_PAINT_NONE;
+		}
+	}
+}
+
+// Symbol space is never scaled to the viewBox, so the shape only gets its /* SVG4FNA change! */
+// gradients and is added to the symbol's bounds /* SVG4FNA change! */
+static void nsvg__finishSymbolShape(NSVGparser* p, NSVGsymbol* symbol, NSVGshape* shape) /* SVG4FNA change! */
+{
+	nsvg__createGradients(p, shape);
+
+	if (shape == symbol->shapes) {
+		memcpy(symbol->bounds, shape->bounds, sizeof(float)*4);
+	} else {
+		symbol->bounds[0] = nsvg__minf(symbol->bounds[0], shape->bounds[0]);
+		symbol->bounds[1] = nsvg__minf(symbol->bounds[1], shape->bounds[1]);
+		symbol->bounds[2] = nsvg__maxf(symbol->bounds[2], shape->bounds[2]);
+		symbol->bounds[3] = nsvg__maxf(symbol->bounds[3], shape->bounds[3]);
+	}
+}
+
+static NSVGsymbolData* nsvg__findSymbolData(NSVGparser* p, const char* id) /* SVG4FNA change! */
+{
+	NSVGsymbolData* data = p->symbols;
+	while (data != NULL) {
+		if (strcmp(data->symbol->id, id) == 0)
+			return data;
+		data = data->next;
+	}
+	return NULL;
+}
+
+// Points an instance at its symbol, mapping the symbol's viewBox onto the /* SVG4FNA change! */
+// <use> width and height, and hides it if there is nothing to draw. Its /* SVG4FNA change! */
+// gradients are made here, in symbol space, before image space ones begin. /* SVG4FNA change! */
+static void nsvg__resolveUse(NSVGparser* p, NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGuseData* use = p->uses;
+	NSVGsymbolData* data = nsvg__findSymbolData(p, use->href);
+	float t[6], x, y;
+	int i;
+
+	p->uses = use->next;
+	if (data == NULL || data->symbol->shapes == NULL) {
+		shape->flags = 0x00;
+		shape->fill.type = NSVG_PAINT_NONE;
+		shape->stroke.type = NSVG_PAINT_NONE;
+		free(use);
+		return;
+	}
+
+	if (data->viewBox[2] > 0.0f && data->viewBox[3] > 0.0f) {
+		float* vb = data->viewBox;
+		float w = use->width > 0.0f ? use->width : vb[2];
+		float h = use->height > 0.0f ? use->height : vb[3];
+		float sx = w / vb[2], sy = h / vb[3];
+		if (data->alignType == NSVG_ALIGN_MEET)
+			sx = sy = nsvg__minf(sx, sy);
+		else if (data->alignType == NSVG_ALIGN_SLICE)
+			sx = sy = nsvg__maxf(sx, sy);
+		nsvg__xformSetScale(t, sx, sy);
+		t[4] = nsvg__viewAlign(vb[2]*sx, w, data->alignX) - vb[0]*sx;
+		t[5] = nsvg__viewAlign(vb[3]*sy, h, data->alignY) - vb[1]*sy;
+		nsvg__xformMultiply(t, shape->symbolXform);
+		memcpy(shape->symbolXform, t, sizeof(float)*6);
+	}
+	shape->symbol = data->symbol;
+	nsvg__createGradients(p, shape);
+
+	// Bounds of the transformed symbol bounds
+	for (i = 0; i < 4; i++) {
+		float* b = data->symbol->bounds;
+		nsvg__xformPoint(&x, &y, b[(i & 1) ? 2 : 0], b[(i & 2) ? 3 : 1], shape->symbolXform);
+		if (i == 0) {
+			shape->bounds[0] = shape->bounds[2] = x;
+			shape->bounds[1] = shape->bounds[3] = y;
+		} else {
+			shape->bounds[0] = nsvg__minf(shape->bounds[0], x);
+			shape->bounds[1] = nsvg__minf(shape->bounds[1], y);
+			shape->bounds[2] = nsvg__maxf(shape->bounds[2], x);
+			shape->bounds[3] = nsvg__maxf(shape->bounds[3], y);
+		}
+	}
+	free(use);
+}
+
+// Hashes the ids gathered while parsing into the image, for nsvgFindShapes /* SVG4FNA change! */
+static void nsvg__buildShapeIndex(NSVGparser* p) /* SVG4FNA change! */
+{
+	NSVGshapeIndex* index;
+	NSVGshape** shapes;
+	NSVGshape* shape;
+	size_t size, strings = 0;
+	int i, j, n = 0, mask, nslots = 16;
+
+	if (p->nids == 0)
+		return;
+	for (i = 0; i < p->nids; i++)
+		strings += strlen(p->ids[i].id) + 1;
+	while (nslots < p->nids*2)
+		nslots *= 2;
+	size = sizeof(NSVGshapeIndex) + p->nids*sizeof(NSVGshapeIndexEntry) + nslots*sizeof(int) + strings;
+
+	shapes = (NSVGshape**)malloc((p->nimageShapes + 1) * sizeof(NSVGshape*));
+	index = (NSVGshapeIndex*)NSVG_IMAGE_MALLOC(size);
+	if (shapes == NULL || index == NULL) {
+		free(shapes);
+		free(index);
+		return;
+	}
+	for (shape = p->image->shapes; shape != NULL; shape = shape->next)
+		shapes[n++] = shape;
+
+	memset(index, 0, size);
+	index->entries = (NSVGshapeIndexEntry*)(index + 1);
+	index->slots = (int*)(index->entries + p->nids);
+	index->strings = (char*)(index->slots + nslots);
+	index->nslots = nslots;
+	index->size = size;
+	mask = nslots - 1;
+	strings = 0;
+
+	for (i = 0; i < p->nids; i++) {
+		NSVGshapeIdData* data = &p->ids[i];
+		NSVGshapeIndexEntry* entry;
+		int len;
+		unsigned int hash = nsvg__memoHash(data->id, &len);
+		for (j = hash & mask; index->slots[j] != 0; j = (j + 1) & mask) {
+			entry = &index->entries[index->slots[j] - 1];
+			if (entry->hash == hash && strcmp(index->strings + entry->id, data->id) == 0)
+				break;
+		}
+		// Like getElementById, the first element with the id wins
+		if (index->slots[j] != 0)
+			continue;
+
+		entry = &index->entries[index->nentries++];
+		entry->hash = hash;
+		entry->id = (int)strings;
+		memcpy(index->strings + strings, data->id, len + 1);
+		strings += len + 1;
+		// A <g> still open at the end of the document runs to the end
+		entry->range.index = data->index;
+		entry->range.count = data->count >= 0 ? data->count : n - data->index;
+		entry->range.first = entry->range.count > 0 ? shapes[data->index] : NULL;
+		index->slots[j] = index->nentries;
+	}
+
+	free(shapes);
+	p->image->ids = index;
+}
+
+static NSVGparser* nsvg__beginParse(const char* input, size_t len, int inPlace, const char* units, float dpi) /* SVG4FNA change! */
+{
+	NSVGparser* p = nsvg__createParser();
+	size_t n;
+	if (p == NULL)
+		return NULL;
+	p->dpi = dpi;
+	p->xml.pos = input;
+	p->xml.end = input + len;
+	p->xml.inPlace = inPlace;
+	n = strlen(units);
+	if (n >= sizeof(p->units))
+		n = sizeof(p->units) - 1;
+	memcpy(p->units, units, n);
+	return p;
+}
+
+// Runs the parse phases until the deadline (0 for none) passes, checking it /* SVG4FNA change! */
+// after each element or shape. Returns 1 once all phases are done. /* SVG4FNA change! */
+static int nsvg__stepParse(NSVGparser* p, unsigned long long deadline) /* SVG4FNA change! */
+{
+	NSVGshape* shape;
+
+	if (p->phase == NSVG_PHASE_XML) {
+		NSVG_TRACE_BEGIN("nsvg__parseXML", NULL);
+		nsvg__parseXMLTags(&p->xml, deadline, nsvg__startElement, nsvg__endElement, nsvg__content, p);
+		NSVG_TRACE_END();
+		if (p->xml.pos < p->xml.end)
+			return 0;
+		nsvg__buildShapeIndex(p);
+
+		p->phase = NSVG_PHASE_SYMBOLS; /* SVG4FNA change! */
+		p->phaseSymbol = p->symbols; /* SVG4FNA change! */
+		p->phaseShape = p->symbols != NULL ? p->symbols->symbol->shapes : NULL; /* SVG4FNA change! */
+	}
+
+	if (p->phase == NSVG_PHASE_SYMBOLS) { /* SVG4FNA change! */
+		NSVG_TRACE_BEGIN("nsvg__finishSymbols", NULL);
+		for (shape = NULL; p->phaseSymbol != NULL && shape == NULL; ) {
+			for (shape = p->phaseShape; shape != NULL; shape = shape->next) {
+				nsvg__finishSymbolShape(p, p->phaseSymbol->symbol, shape);
+				if (nsvg__pastDeadline(deadline))
+					break;
+			}
+			if (shape == NULL) {
+				p->phaseSymbol = p->phaseSymbol->next;
+				p->phaseShape = p->phaseSymbol != NULL ? p->phaseSymbol->symbol->shapes : NULL;
+			}
+		}
+		NSVG_TRACE_END();
+		if (shape != NULL) {
+			p->phaseShape = shape->next;
+			return 0;
+		}
+
+		// Every symbol is known now /* SVG4FNA change! */
+		while (p->uses != NULL) { /* SVG4FNA change! */
+			nsvg__resolveUse(p, p->uses->shape); /* SVG4FNA change! */
+			if (nsvg__pastDeadline(deadline)) /* SVG4FNA change! */
+				return 0; /* SVG4FNA change! */
+		} /* SVG4FNA change! */
+
+		nsvg__finishGradients(p, p->image->gradients, NULL, 0);
+		p->symbolGradients = p->image->gradients;
+
+		// Create gradients after all definitions have been parsed
+		p->phase = NSVG_PHASE_GRADIENTS;
+		p->phaseShape = p->image->shapes;
+	}
+
+	if (p->phase == NSVG_PHASE_GRADIENTS) {
+		NSVG_TRACE_BEGIN("nsvg__createGradients", NULL);
+		for (shape = p->phaseShape; shape != NULL; shape = shape->next) {
+			nsvg__createGradients(p, shape);
+			nsvg__addImageBounds(p, shape);
+			if (shape->next != NULL && nsvg__pastDeadline(deadline))
+				break;
+		}
+		NSVG_TRACE_END();
+		if (shape != NULL) {
+			p->phaseShape = shape->next;
+			return 0;
+		}
+
+		// Scale to viewBox
+		nsvg__beginScaleToViewbox(p, p->units);
+		nsvg__finishGradients(p, p->image->gradients, p->symbolGradients, 1);
+		p->phase = NSVG_PHASE_VIEWBOX;
+		p->phaseShape = p->image->shapes;
+	}
+
+	if (p->phase == NSVG_PHASE_VIEWBOX) {
+		NSVG_TRACE_BEGIN("nsvg__scaleToViewbox", NULL);
+		for (shape = p->phaseShape; shape != NULL; shape = shape->next) {
+			nsvg__scaleToViewbox(p, shape);
+			if (shape->next != NULL && nsvg__pastDeadline(deadline))
+				break;
+		}
+		NSVG_TRACE_END();
+		if (shape != NULL) {
+			p->phaseShape = shape->next;
+			return 0;
+		}
+		p->phase = NSVG_PHASE_DONE;
+	}
 
+	return 1;
+}
+
+static NSVGimage* nsvg__endParse(NSVGparser* p) /* SVG4FNA change! */
+{
+	NSVGimage* ret;
+	nsvg__stepParse(p, 0);
 	ret = p->image;
 	p->image = NULL;
-
 	nsvg__deleteParser(p);
+	return ret;
+}
+
+static NSVGimage* nsvg__parse(const char* input, size_t len, int inPlace, const char* units, float dpi) /* SVG4FNA change! */
+{
+	NSVGparser* p;
+	NSVGimage* ret = 0;
 
+	NSVG_TRACE_BEGIN("nsvgParse", NULL); /* SVG4FNA change! */
+	p = nsvg__beginParse(input, len, inPlace, units, dpi); /* SVG4FNA change! */
+	if (p != NULL) /* SVG4FNA change! */
+		ret = nsvg__endParse(p); /* SVG4FNA change! */
+	NSVG_TRACE_END(); /* SVG4FNA change! */
 	return ret;
 }
 
+NSVGimage* nsvgParse(char* input, const char* units, float dpi) /* SVG4FNA change! */
+{
+	return nsvg__parse(input, strlen(input), 1, units, dpi);
+}
+
+NSVGimage* nsvgParseConst(const char* data, size_t len, const char* units, float dpi) /* SVG4FNA change! */
+{
+	return nsvg__parse(data, len, 0, units, dpi);
+}
+
+#define NSVG_GZIP_FHCRC 0x02 /* SVG4FNA change! */
+#define NSVG_GZIP_FEXTRA 0x04 /* SVG4FNA change! */
+#define NSVG_GZIP_FNAME 0x08 /* SVG4FNA change! */
+#define NSVG_GZIP_FCOMMENT 0x10 /* SVG4FNA change! */
+// Deflate can't do better than about 1032:1, so a bigger size is a lie /* SVG4FNA change! */
+#define NSVG_GZIP_MAX_RATIO 1032 /* SVG4FNA change! */
+
+static int nsvg__isGzip(const char* data, size_t len) /* SVG4FNA change! */
+{
+	return len >= 2 && (unsigned char)data[0] == 0x1f && (unsigned char)data[1] == 0x8b;
+}
+
+// Inflates gzip data into a buffer the caller frees, or returns NULL /* SVG4FNA change! */
+static char* nsvg__inflateGzip(const char* data, size_t len, size_t* outLen) /* SVG4FNA change! */
+{
+	const unsigned char* d = (const unsigned char*)data;
+	size_t pos = 10, end, size;
+	int flags, inflated;
+	char* svg;
+
+	// Header, see RFC 1952. The deflate data ends at the 8 byte trailer.
+	if (len < 18 || !nsvg__isGzip(data, len) || d[2] != 8 || len - 8 > INT_MAX)
+		return NULL;
+	end = len - 8;
+	flags = d[3];
+	if (flags & NSVG_GZIP_FEXTRA) {
+		if (pos + 2 > end)
+			return NULL;
+		pos += 2 + (d[pos] | (d[pos + 1] << 8));
+	}
+	if (flags & NSVG_GZIP_FNAME) {
+		while (pos < end && d[pos] != 0) pos++;
+		pos++;
+	}
+	if (flags & NSVG_GZIP_FCOMMENT) {
+		while (pos < end && d[pos] != 0) pos++;
+		pos++;
+	}
+	if (flags & NSVG_GZIP_FHCRC)
+		pos += 2;
+	if (pos > end)
+		return NULL;
+
+	// The trailer ends with the inflated size (mod 2^32), so inflate exactly
+	// once into a buffer the caller can parse in place
+	size = d[len - 4] | (d[len - 3] << 8) | (d[len - 2] << 16) | ((size_t)d[len - 1] << 24);
+	if (size > INT_MAX)
+		return NULL;
+	// The size is unchecked until inflating, don't let it make a huge buffer
+	if (size / NSVG_GZIP_MAX_RATIO > end - pos)
+		return NULL;
+	svg = (char*)malloc(size > 0 ? size : 1);
+	if (svg == NULL)
+		return NULL;
+
+	NSVG_TRACE_BEGIN("nsvg__inflate", NULL);
+	inflated = NSVG_INFLATE(svg, (int)size, (const char*)d + pos, (int)(end - pos));
+	NSVG_TRACE_END();
+	if (inflated != (int)size) {
+		free(svg);
+		return NULL;
+	}
+	*outLen = size;
+	return svg;
+}
+
+NSVGimage* nsvgParseCompressed(const char* data, size_t len, const char* units, float dpi) /* SVG4FNA change! */
+{
+	size_t size;
+	NSVGimage* image;
+	char* svg = nsvg__inflateGzip(data, len, &size);
+	if (svg == NULL)
+		return NULL;
+	image = nsvg__parse(svg, size, 1, units, dpi);
+	free(svg);
+	return image;
+}
+
+static NSVGimage* nsvg__parseMapped(const char* data, size_t len, const char* units, float dpi) /* SVG4FNA change! */
+{
+	if (nsvg__isGzip(data, len))
+		return nsvgParseCompressed(data, len, units, dpi);
+	return nsvgParseConst(data, len, units, dpi);
+}
+
+NSVGimage* nsvgParseFromFileMapped(const char* filename, const char* units, float dpi) /* SVG4FNA change! */
+{
+#if defined(_WIN32)
+	HANDLE file, mapping;
+	LARGE_INTEGER size;
+	const char* data;
+	NSVGimage* image;
+
+	file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+	if (!GetFileSizeEx(file, &size) || (unsigned long long)size.QuadPart > (size_t)-1) {
+		CloseHandle(file);
+		return NULL;
+	}
+	if (size.QuadPart == 0) {
+		CloseHandle(file);
+		return nsvgParseConst("", 0, units, dpi);
+	}
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+		return NULL;
+	data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (data == NULL)
+		return NULL;
+
+	image = nsvg__parseMapped(data, (size_t)size.QuadPart, units, dpi);
+	UnmapViewOfFile(data);
+	return image;
+#elif defined(__unix__) || defined(__APPLE__)
+	struct stat st;
+	void* data;
+	NSVGimage* image;
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	if (fstat(fd, &st) != 0 || (unsigned long long)st.st_size > (size_t)-1) {
+		close(fd);
+		return NULL;
+	}
+	if (st.st_size == 0) {
+		close(fd);
+		return nsvgParseConst("", 0, units, dpi);
+	}
+	data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return NULL;
+
+	image = nsvg__parseMapped((const char*)data, (size_t)st.st_size, units, dpi);
+	munmap(data, (size_t)st.st_size);
+	return image;
+#else
+	// No file mapping here, copy it like nsvgParseFromFile
+	return nsvgParseFromFile(filename, units, dpi);
+#endif
+}
+
 NSVGimage* nsvgParseFromFile(const char* filename, const char* units, float dpi)
 {
 	FILE* fp = NULL;
@@ -2899,7 +4357,10 @@ NSVGimage* nsvgParseFromFile(const char* filename, const char* units, float dpi)
 	if (fread(data, 1, size, fp) != size) goto error;
 	data[size] = '\0';	// Must be null terminated.
 	fclose(fp);
-	image = nsvgParse(data, units, dpi);
+	if (nsvg__isGzip(data, size)) /* SVG4FNA change! */
+		image = nsvgParseCompressed(data, size, units, dpi); /* SVG4FNA change! */
+	else /* SVG4FNA change! */
+		image = nsvgParse(data, units, dpi);
 	free(data);
 
 	return image;
@@ -2911,6 +4372,55 @@ error:
 	return NULL;
 }
 
+NSVGparser* nsvgParserCreate(const char* data, size_t len, const char* units, float dpi) /* SVG4FNA change! */
+{
+	NSVGparser* p;
+	char* svg = NULL;
+	size_t size = len;
+	if (nsvg__isGzip(data, len)) {
+		svg = nsvg__inflateGzip(data, len, &size);
+		if (svg == NULL)
+			return NULL;
+	}
+	p = nsvg__beginParse(svg != NULL ? svg : data, size, svg != NULL, units, dpi);
+	if (p == NULL) {
+		free(svg);
+		return NULL;
+	}
+	p->inflated = svg;
+	return p;
+}
+
+int nsvgParserStep(NSVGparser* parser, int budgetUs) /* SVG4FNA change! */
+{
+	unsigned long long budget, deadline;
+	int done;
+	if (parser->phase == NSVG_PHASE_DONE)
+		return 1;
+	budget = (unsigned long long)(budgetUs > 0 ? budgetUs : 0) * NSVG_TICKS_FREQUENCY() / 1000000;
+	deadline = NSVG_TICKS() + budget;
+	NSVG_TRACE_BEGIN("nsvgParserStep", NULL);
+	done = nsvg__stepParse(parser, deadline > 0 ? deadline : 1);
+	NSVG_TRACE_END();
+	return done;
+}
+
+NSVGimage* nsvgParserFinish(NSVGparser* parser) /* SVG4FNA change! */
+{
+	NSVGimage* ret;
+	if (parser == NULL)
+		return NULL;
+	NSVG_TRACE_BEGIN("nsvgParserFinish", NULL);
+	ret = nsvg__endParse(parser);
+	NSVG_TRACE_END();
+	return ret;
+}
+
+void nsvgParserDelete(NSVGparser* parser) /* SVG4FNA change! */
+{
+	nsvg__deleteParser(parser);
+}
+
 NSVGpath* nsvgDuplicatePath(NSVGpath* p)
 {
     NSVGpath* res = NULL;
@@ -2918,13 +4428,14 @@ NSVGpath* nsvgDuplicatePath(NSVGpath* p)
     if (p == NULL)
         return NULL;
 
-    res = (NSVGpath*)malloc(sizeof(NSVGpath));
+    res = (NSVGpath*)NSVG_IMAGE_MALLOC(sizeof(NSVGpath)); /* SVG4FNA change! */
     if (res == NULL) goto error;
     memset(res, 0, sizeof(NSVGpath));
 
-    res->pts = (float*)malloc(p->npts*2*sizeof(float));
+    res->pts = (float*)NSVG_IMAGE_MALLOC(p->npts*2*sizeof(float)); /* SVG4FNA change! */
     if (res->pts == NULL) goto error;
-    memcpy(res->pts, p->pts, p->npts * sizeof(float) * 2);
+    // The copy owns its points as floats, with the offset taken out /* SVG4FNA change! */
+    nsvgUnpackPath(p, res->pts); /* SVG4FNA change! */
     res->npts = p->npts;
 
     memcpy(res->bounds, p->bounds, sizeof(p->bounds));
@@ -2941,18 +4452,675 @@ error:
     return NULL;
 }
 
-void nsvgDelete(NSVGimage* image)
+// Path deduplication /* SVG4FNA change! */
+
+#define NSVG_DEDUPE_GRID 64.0f /* SVG4FNA change! */
+
+// Snaps a point relative to the path's first one, so the hash ignores where /* SVG4FNA change! */
+// the path is. Copies may still land on either side of a grid line, which /* SVG4FNA change! */
+// only costs a missed match. /* SVG4FNA change! */
+static unsigned int nsvg__snapPoint(float d) /* SVG4FNA change! */
 {
-	NSVGshape *snext, *shape;
-	if (image == NULL) return;
-	shape = image->shapes;
+	d *= NSVG_DEDUPE_GRID;
+	if (!(d > -1e9f && d < 1e9f))
+		return 0;
+	return (unsigned int)(int)floorf(d + 0.5f);
+}
+
+static unsigned int nsvg__pathHash(NSVGpath* path) /* SVG4FNA change! */
+{
+	unsigned int h = 2166136261u;
+	int i;
+	h = (h ^ (unsigned int)path->npts) * 16777619u;
+	h = (h ^ (unsigned int)path->closed) * 16777619u;
+	for (i = 1; i < path->npts; i++) {
+		h = (h ^ nsvg__snapPoint(path->pts[i*2+0] - path->pts[0])) * 16777619u;
+		h = (h ^ nsvg__snapPoint(path->pts[i*2+1] - path->pts[1])) * 16777619u;
+	}
+	return h;
+}
+
+// Whether b's points are exactly a's plus (dx,dy), as the renderers compute /* SVG4FNA change! */
+// them, so sharing a's points can't change a single pixel /* SVG4FNA change! */
+static int nsvg__samePath(NSVGpath* a, NSVGpath* b, float dx, float dy) /* SVG4FNA change! */
+{
+	int i;
+	if (a->npts != b->npts || a->closed != b->closed)
+		return 0;
+	for (i = 0; i < a->npts; i++) {
+		if (a->pts[i*2+0] + dx != b->pts[i*2+0] || a->pts[i*2+1] + dy != b->pts[i*2+1])
+			return 0;
+	}
+	return 1;
+}
+
+static int nsvg__countPaths(NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGpath* path;
+	int count = 0;
+	for (; shape != NULL; shape = shape->next)
+		for (path = shape->paths; path != NULL; path = path->next)
+			count++;
+	return count;
+}
+
+typedef struct NSVGdedupe { /* SVG4FNA change! */
+	NSVGpath** slots; // The first path seen with each shape, open addressing /* SVG4FNA change! */
+	unsigned int* hashes; /* SVG4FNA change! */
+	int mask; /* SVG4FNA change! */
+	int paths; /* SVG4FNA change! */
+	size_t bytes; /* SVG4FNA change! */
+} NSVGdedupe; /* SVG4FNA change! */
+
+static void nsvg__dedupeShapes(NSVGdedupe* d, NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGpath* path;
+	NSVGpath* other;
+	unsigned int hash;
+	float dx, dy;
+	int i;
+
+	for (; shape != NULL; shape = shape->next) {
+		for (path = shape->paths; path != NULL; path = path->next) {
+			// Already shared by an earlier call or packed, leave those alone
+			if (path->ptsRefs != NULL || path->packed != NULL || path->npts < 1)
+				continue;
+			hash = nsvg__pathHash(path);
+			for (i = hash & d->mask; d->slots[i] != NULL; i = (i + 1) & d->mask) {
+				other = d->slots[i];
+				if (d->hashes[i] != hash)
+					continue;
+				dx = path->pts[0] - other->pts[0];
+				dy = path->pts[1] - other->pts[1];
+				if (nsvg__samePath(other, path, dx, dy))
+					break;
+			}
+			if (d->slots[i] == NULL) {
+				d->slots[i] = path;
+				d->hashes[i] = hash;
+				continue;
+			}
+
+			if (other->ptsRefs == NULL) {
+				other->ptsRefs = (int*)NSVG_IMAGE_MALLOC(sizeof(int));
+				if (other->ptsRefs == NULL)
+					continue;
+				*other->ptsRefs = 1;
+				d->bytes -= sizeof(int);
+			}
+			free(path->pts);
+			path->pts = other->pts;
+			path->ptsRefs = other->ptsRefs;
+			*path->ptsRefs += 1;
+			path->offset[0] = dx;
+			path->offset[1] = dy;
+			d->paths++;
+			d->bytes += path->npts*2*sizeof(float);
+		}
+	}
+}
+
+size_t nsvgDedupePaths(NSVGimage* image) /* SVG4FNA change! */
+{
+	NSVGdedupe d;
+	NSVGsymbol* symbol;
+	int count, nslots;
+
+	if (image == NULL)
+		return 0;
+	count = nsvg__countPaths(image->shapes);
+	for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+		count += nsvg__countPaths(symbol->shapes);
+	if (count < 2)
+		return 0;
+
+	NSVG_TRACE_BEGIN("nsvgDedupePaths", NULL);
+	memset(&d, 0, sizeof(d));
+	// Keep the slots at most half full
+	for (nslots = 64; nslots < count * 2; nslots *= 2);
+	d.slots = (NSVGpath**)malloc(nslots * sizeof(NSVGpath*));
+	d.hashes = (unsigned int*)malloc(nslots * sizeof(unsigned int));
+	if (d.slots != NULL && d.hashes != NULL) {
+		memset(d.slots, 0, nslots * sizeof(NSVGpath*));
+		d.mask = nslots - 1;
+		nsvg__dedupeShapes(&d, image->shapes);
+		for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+			nsvg__dedupeShapes(&d, symbol->shapes);
+		image->stats.dedupedPaths += d.paths;
+		image->stats.dedupedBytes += (int)d.bytes;
+	}
+	free(d.slots);
+	free(d.hashes);
+	NSVG_TRACE_END();
+	return d.bytes;
+}
+
+// Path quantization /* SVG4FNA change! */
+
+#define NSVG_PACKED_MAX 32767 /* SVG4FNA change! */
+
+static size_t nsvg__packedSize(int npts) /* SVG4FNA change! */
+{
+	return offsetof(NSVGpackedPts, pts) + npts*2*sizeof(short);
+}
+
+void nsvgUnpackPath(NSVGpath* path, float* out) /* SVG4FNA change! */
+{
+	NSVGpackedPts* packed = path->packed;
+	int i;
+	if (packed != NULL) {
+		for (i = 0; i < path->npts; i++) {
+			out[i*2+0] = (packed->pts[i*2+0] * packed->scale[0] + packed->origin[0]) + path->offset[0];
+			out[i*2+1] = (packed->pts[i*2+1] * packed->scale[1] + packed->origin[1]) + path->offset[1];
+		}
+	} else {
+		for (i = 0; i < path->npts; i++) {
+			out[i*2+0] = path->pts[i*2+0] + path->offset[0];
+			out[i*2+1] = path->pts[i*2+1] + path->offset[1];
+		}
+	}
+}
+
+// Packs one path's points, or returns NULL if they aren't all finite /* SVG4FNA change! */
+static NSVGpackedPts* nsvg__packPoints(float* pts, int npts, float* error) /* SVG4FNA change! */
+{
+	NSVGpackedPts* packed;
+	float minv[2], maxv[2], v, dx, dy;
+	int i, j;
+
+	minv[0] = maxv[0] = pts[0];
+	minv[1] = maxv[1] = pts[1];
+	for (i = 0; i < npts; i++) {
+		for (j = 0; j < 2; j++) {
+			v = pts[i*2+j];
+			if (!(v > -1e30f && v < 1e30f))
+				return NULL;
+			minv[j] = nsvg__minf(minv[j], v);
+			maxv[j] = nsvg__maxf(maxv[j], v);
+		}
+	}
+
+	packed = (NSVGpackedPts*)NSVG_IMAGE_MALLOC(nsvg__packedSize(npts));
+	if (packed == NULL)
+		return NULL;
+	// The step is a power of 2 and the origin a multiple of it, so points on
+	// the grid, like the whole numbers most exporters write, come back exactly
+	for (j = 0; j < 2; j++) {
+		float need = (maxv[j] - minv[j]) / (2.0f * NSVG_PACKED_MAX - 1.0f);
+		float step = 1.0f;
+		if (need <= 0.0f) {
+			packed->origin[j] = minv[j];
+			packed->scale[j] = 0.0f;
+			continue;
+		}
+		while (step < need) step *= 2.0f;
+		while (step * 0.5f >= need) step *= 0.5f;
+		packed->origin[j] = floorf((minv[j] * 0.5f + maxv[j] * 0.5f) / step + 0.5f) * step;
+		packed->scale[j] = step;
+	}
+
+	*error = 0.0f;
+	for (i = 0; i < npts; i++) {
+		for (j = 0; j < 2; j++) {
+			v = 0.0f;
+			if (packed->scale[j] > 0.0f)
+				v = floorf((pts[i*2+j] - packed->origin[j]) / packed->scale[j] + 0.5f);
+			v = nsvg__minf(nsvg__maxf(v, -NSVG_PACKED_MAX), NSVG_PACKED_MAX);
+			packed->pts[i*2+j] = (short)v;
+		}
+		dx = (packed->pts[i*2+0] * packed->scale[0] + packed->origin[0]) - pts[i*2+0];
+		dy = (packed->pts[i*2+1] * packed->scale[1] + packed->origin[1]) - pts[i*2+1];
+		*error = nsvg__maxf(*error, sqrtf(dx*dx + dy*dy));
+	}
+	return packed;
+}
+
+typedef struct NSVGquantize { /* SVG4FNA change! */
+	// Shared points packed so far, so every path sharing them gets the same /* SVG4FNA change! */
+	// packed copy. Open addressing by the old pts pointer. /* SVG4FNA change! */
+	float** oldPts; /* SVG4FNA change! */
+	NSVGpackedPts** newPts; /* SVG4FNA change! */
+	int* remaining; /* SVG4FNA change! */
+	int mask; /* SVG4FNA change! */
+	int paths; /* SVG4FNA change! */
+	size_t bytes; /* SVG4FNA change! */
+	float error; /* SVG4FNA change! */
+} NSVGquantize; /* SVG4FNA change! */
+
+static void nsvg__quantizeShapes(NSVGquantize* q, NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGpath* path;
+	float error;
+	int i;
+
+	for (; shape != NULL; shape = shape->next) {
+		for (path = shape->paths; path != NULL; path = path->next) {
+			if (path->packed != NULL || path->pts == NULL || path->npts < 1)
+				continue;
+
+			if (path->ptsRefs == NULL) {
+				path->packed = nsvg__packPoints(path->pts, path->npts, &error);
+				if (path->packed == NULL)
+					continue;
+				q->bytes += path->npts*2*sizeof(float) - nsvg__packedSize(path->npts);
+				q->error = nsvg__maxf(q->error, error);
+				free(path->pts);
+				path->pts = NULL;
+				q->paths++;
+				continue;
+			}
+
+			i = (int)(((size_t)path->pts >> 4) * 2654435761u) & q->mask;
+			while (q->oldPts[i] != NULL && q->oldPts[i] != path->pts)
+				i = (i + 1) & q->mask;
+			if (q->oldPts[i] == NULL) {
+				// Remembered even on failure, so the sharers all stay unpacked
+				q->oldPts[i] = path->pts;
+				q->newPts[i] = nsvg__packPoints(path->pts, path->npts, &error);
+				q->remaining[i] = *path->ptsRefs;
+				if (q->newPts[i] != NULL) {
+					q->bytes += path->npts*2*sizeof(float) - nsvg__packedSize(path->npts);
+					q->error = nsvg__maxf(q->error, error);
+				}
+			}
+			if (q->newPts[i] == NULL)
+				continue;
+			// The old points go once the last path sharing them is packed
+			if (--q->remaining[i] == 0)
+				free(path->pts);
+			path->packed = q->newPts[i];
+			path->pts = NULL;
+			q->paths++;
+		}
+	}
+}
+
+size_t nsvgQuantizePaths(NSVGimage* image) /* SVG4FNA change! */
+{
+	NSVGquantize q;
+	NSVGsymbol* symbol;
+	int count, nslots;
+
+	if (image == NULL)
+		return 0;
+	count = nsvg__countPaths(image->shapes);
+	for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+		count += nsvg__countPaths(symbol->shapes);
+
+	NSVG_TRACE_BEGIN("nsvgQuantizePaths", NULL);
+	memset(&q, 0, sizeof(q));
+	// Keep the slots at most half full
+	for (nslots = 64; nslots < count * 2; nslots *= 2);
+	q.oldPts = (float**)malloc(nslots * sizeof(float*));
+	q.newPts = (NSVGpackedPts**)malloc(nslots * sizeof(NSVGpackedPts*));
+	q.remaining = (int*)malloc(nslots * sizeof(int));
+	if (q.oldPts != NULL && q.newPts != NULL && q.remaining != NULL) {
+		memset(q.oldPts, 0, nslots * sizeof(float*));
+		q.mask = nslots - 1;
+		nsvg__quantizeShapes(&q, image->shapes);
+		for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+			nsvg__quantizeShapes(&q, symbol->shapes);
+		image->stats.quantizedPaths += q.paths;
+		image->stats.quantizedBytes += (int)q.bytes;
+		image->stats.quantizeError = nsvg__maxf(image->stats.quantizeError, q.error);
+	}
+	free(q.oldPts);
+	free(q.newPts);
+	free(q.remaining);
+	NSVG_TRACE_END();
+	return q.bytes;
+}
+
+static void nsvg__deleteShapes(NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGshape *snext;
 	while (shape != NULL) {
 		snext = shape->next;
 		nsvg__deletePaths(shape->paths);
-		nsvg__deletePaint(&shape->fill);
-		nsvg__deletePaint(&shape->stroke);
 		free(shape);
 		shape = snext;
 	}
+}
+
+void nsvgDelete(NSVGimage* image)
+{
+	NSVGsymbol *symnext, *symbol; /* SVG4FNA change! */
+	NSVGgradient *gradnext, *grad; /* SVG4FNA change! */
+	if (image == NULL) return;
+	nsvg__deleteShapes(image->shapes); /* SVG4FNA change! */
+	symbol = image->symbols; /* SVG4FNA change! */
+	while (symbol != NULL) { /* SVG4FNA change! */
+		symnext = symbol->next; /* SVG4FNA change! */
+		nsvg__deleteShapes(symbol->shapes); /* SVG4FNA change! */
+		free(symbol); /* SVG4FNA change! */
+		symbol = symnext; /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+	grad = image->gradients; /* SVG4FNA change! */
+	while (grad != NULL) { /* SVG4FNA change! */
+		gradnext = grad->next; /* SVG4FNA change! */
+		free(grad); /* SVG4FNA change! */
+		grad = gradnext; /* SVG4FNA change! */
+	} /* SVG4FNA change! */
+	free(image->ids); /* SVG4FNA change! */
 	free(image);
 }
+
+int nsvgFindShapes(NSVGimage* image, const char* id, NSVGshapeRange* range) /* SVG4FNA change! */
+{
+	NSVGshapeIndex* index;
+	unsigned int hash;
+	int i, len, mask;
+
+	if (image == NULL || image->ids == NULL || id == NULL)
+		return 0;
+	index = image->ids;
+	hash = nsvg__memoHash(id, &len);
+	mask = index->nslots - 1;
+	for (i = hash & mask; index->slots[i] != 0; i = (i + 1) & mask) {
+		NSVGshapeIndexEntry* entry = &index->entries[index->slots[i] - 1];
+		if (entry->hash == hash && strcmp(index->strings + entry->id, id) == 0) {
+			if (range != NULL)
+				*range = entry->range;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Shape culling /* SVG4FNA change! */
+
+#define NSVG_CULL_MAX_COVERS 64 /* SVG4FNA change! */
+#define NSVG_CULL_MARGIN 1.0f /* SVG4FNA change! */
+
+static int nsvg__paintVisible(NSVGpaint* paint) /* SVG4FNA change! */
+{
+	if (paint->type == NSVG_PAINT_COLOR)
+		return (paint->color >> 24) != 0;
+	return paint->type == NSVG_PAINT_LINEAR_GRADIENT || paint->type == NSVG_PAINT_RADIAL_GRADIENT;
+}
+
+static int nsvg__paintOpaque(NSVGpaint* paint) /* SVG4FNA change! */
+{
+	int i;
+	if (paint->type == NSVG_PAINT_COLOR)
+		return (paint->color >> 24) == 0xff;
+	if (paint->type != NSVG_PAINT_LINEAR_GRADIENT && paint->type != NSVG_PAINT_RADIAL_GRADIENT)
+		return 0;
+	if (paint->gradient->nstops < 1)
+		return 0;
+	for (i = 0; i < paint->gradient->nstops; i++) {
+		if ((paint->gradient->stops[i].color >> 24) != 0xff)
+			return 0;
+	}
+	return 1;
+}
+
+// Whether drawing the shape can change any pixel. Instances draw their /* SVG4FNA change! */
+// symbol's shapes instead of any paint of their own. /* SVG4FNA change! */
+static int nsvg__shapeHasEffect(NSVGshape* shape) /* SVG4FNA change! */
+{
+	if (!(shape->flags & NSVG_FLAGS_VISIBLE) || !(shape->opacity > 0.0f))
+		return 0;
+	if (shape->symbol != NULL)
+		return shape->symbol->shapes != NULL;
+	if (shape->paths == NULL)
+		return 0;
+	// Paints from a <use> are only known when drawing
+	if (shape->flags & (NSVG_FLAGS_INHERIT_FILL | NSVG_FLAGS_INHERIT_FILL_OPACITY |
+			NSVG_FLAGS_INHERIT_STROKE | NSVG_FLAGS_INHERIT_STROKE_OPACITY))
+		return 1;
+	return nsvg__paintVisible(&shape->fill) ||
+		(shape->strokeWidth > 0.0f && nsvg__paintVisible(&shape->stroke));
+}
+
+// The shape's bounds, grown by as far as its stroke can reach past them /* SVG4FNA change! */
+static void nsvg__shapeExtent(NSVGshape* shape, float* extent) /* SVG4FNA change! */
+{
+	float r = 0.0f;
+	if (shape->stroke.type != NSVG_PAINT_NONE && shape->strokeWidth > 0.0f) {
+		// Round and bevel joins stay within half the width, miters within the limit
+		float reach = 1.0f;
+		if (shape->strokeLineJoin == NSVG_JOIN_MITER)
+			reach = nsvg__maxf(reach, shape->miterLimit);
+		if (shape->strokeLineCap == NSVG_CAP_SQUARE)
+			reach = nsvg__maxf(reach, 1.4143f);
+		r = shape->strokeWidth * 0.5f * reach;
+	}
+	extent[0] = shape->bounds[0] - r;
+	extent[1] = shape->bounds[1] - r;
+	extent[2] = shape->bounds[2] + r;
+	extent[3] = shape->bounds[3] + r;
+}
+
+// Whether the shape fills all of rect, opaque and unblended. Every segment /* SVG4FNA change! */
+// must run along an edge of the path's bounds, so the path can only wind /* SVG4FNA change! */
+// around the rectangle, and its area says it does so exactly once. /* SVG4FNA change! */
+static int nsvg__opaqueRect(NSVGshape* shape, float* rect) /* SVG4FNA change! */
+{
+	NSVGpath* path = shape->paths;
+	float ox, oy, x, y, px, py, w, h, area = 0.0f;
+	float* pts;
+	int i, j;
+
+	if (!(shape->flags & NSVG_FLAGS_VISIBLE) || shape->opacity < 1.0f || shape->symbol != NULL)
+		return 0;
+	if (path == NULL || path->next != NULL || path->packed != NULL)
+		return 0;
+	if (path->npts < 4 || (path->npts - 1) % 3 != 0 || !nsvg__paintOpaque(&shape->fill))
+		return 0;
+
+	pts = path->pts;
+	ox = path->offset[0];
+	oy = path->offset[1];
+	rect[0] = rect[2] = pts[0] + ox;
+	rect[1] = rect[3] = pts[1] + oy;
+	for (i = 1; i < path->npts; i++) {
+		rect[0] = nsvg__minf(rect[0], pts[i*2] + ox);
+		rect[1] = nsvg__minf(rect[1], pts[i*2+1] + oy);
+		rect[2] = nsvg__maxf(rect[2], pts[i*2] + ox);
+		rect[3] = nsvg__maxf(rect[3], pts[i*2+1] + oy);
+	}
+	w = rect[2] - rect[0];
+	h = rect[3] - rect[1];
+	if (!(w > 0.0f && h > 0.0f))
+		return 0;
+
+	// Each cubic, then the closing line back to the first point
+	for (i = 0; i < path->npts; i += 3) {
+		int n = (i + 3 < path->npts) ? 4 : 2;
+		int onX0 = 1, onX1 = 1, onY0 = 1, onY1 = 1;
+		for (j = 0; j < n; j++) {
+			int k = (n == 2 && j == 1) ? 0 : i + j;
+			x = pts[k*2] + ox;
+			y = pts[k*2+1] + oy;
+			onX0 &= (x == rect[0]);
+			onX1 &= (x == rect[2]);
+			onY0 &= (y == rect[1]);
+			onY1 &= (y == rect[3]);
+		}
+		if (!(onX0 || onX1 || onY0 || onY1))
+			return 0;
+		px = pts[i*2] + ox;
+		py = pts[i*2+1] + oy;
+		if (n == 4) {
+			x = pts[(i+3)*2] + ox;
+			y = pts[(i+3)*2+1] + oy;
+		} else {
+			x = pts[0] + ox;
+			y = pts[1] + oy;
+		}
+		area += px*y - x*py;
+	}
+
+	// Twice the area is 2*w*h times the winding number, which must be +-1
+	area = fabsf(area) * 0.5f;
+	return area > w*h*0.5f && area < w*h*1.5f;
+}
+
+static void nsvg__addCover(float covers[][4], int* ncovers, float* rect) /* SVG4FNA change! */
+{
+	int i, smallest = 0;
+	if (*ncovers < NSVG_CULL_MAX_COVERS) {
+		memcpy(covers[(*ncovers)++], rect, sizeof(float)*4);
+		return;
+	}
+	// Full, so keep the largest rectangles
+	for (i = 1; i < *ncovers; i++) {
+		if ((covers[i][2] - covers[i][0]) * (covers[i][3] - covers[i][1]) <
+			(covers[smallest][2] - covers[smallest][0]) * (covers[smallest][3] - covers[smallest][1]))
+			smallest = i;
+	}
+	if ((rect[2] - rect[0]) * (rect[3] - rect[1]) >
+		(covers[smallest][2] - covers[smallest][0]) * (covers[smallest][3] - covers[smallest][1]))
+		memcpy(covers[smallest], rect, sizeof(float)*4);
+}
+
+// Moves the ranges in the index onto the shapes left, kept[i] being how many /* SVG4FNA change! */
+// of the first i shapes are left, and shapes holding only those /* SVG4FNA change! */
+static void nsvg__moveShapeIndex(NSVGshapeIndex* index, NSVGshape** shapes, int* kept) /* SVG4FNA change! */
+{
+	int i;
+	for (i = 0; i < index->nentries; i++) {
+		NSVGshapeRange* range = &index->entries[i].range;
+		int end = kept[range->index + range->count];
+		range->index = kept[range->index];
+		range->count = end - range->index;
+		range->first = range->count > 0 ? shapes[range->index] : NULL;
+	}
+}
+
+// Removes the shapes in list with no effect and, with occlusion, those under /* SVG4FNA change! */
+// later opaque rectangles. Returns how many were removed. /* SVG4FNA change! */
+static int nsvg__cullShapes(NSVGshape** list, NSVGshapeIndex* index, int occlusion) /* SVG4FNA change! */
+{
+	NSVGshape *shape, **shapes, **tail;
+	float covers[NSVG_CULL_MAX_COVERS][4], extent[4], rect[4];
+	int n = 0, m = 0, ncovers = 0, removed = 0, i, j;
+	int* kept = NULL;
+
+	for (shape = *list; shape != NULL; shape = shape->next)
+		n++;
+	if (n == 0)
+		return 0;
+	shapes = (NSVGshape**)malloc(n * sizeof(NSVGshape*));
+	if (index != NULL)
+		kept = (int*)malloc((n + 1) * sizeof(int));
+	if (shapes == NULL || (index != NULL && kept == NULL)) {
+		free(shapes);
+		free(kept);
+		return 0;
+	}
+	for (i = 0, shape = *list; shape != NULL; shape = shape->next)
+		shapes[i++] = shape;
+
+	// Later shapes draw over earlier ones, so gather rectangles back to front
+	for (i = n - 1; i >= 0; i--) {
+		int hidden = 0;
+		shape = shapes[i];
+		if (!nsvg__shapeHasEffect(shape)) {
+			hidden = 1;
+		} else if (occlusion && shape->symbol == NULL) {
+			nsvg__shapeExtent(shape, extent);
+			for (j = 0; j < ncovers && !hidden; j++) {
+				hidden = extent[0] >= covers[j][0] && extent[1] >= covers[j][1] &&
+					extent[2] <= covers[j][2] && extent[3] <= covers[j][3];
+			}
+		}
+		if (hidden) {
+			shape->next = NULL;
+			nsvg__deleteShapes(shape);
+			shapes[i] = NULL;
+			removed++;
+		} else if (occlusion && nsvg__opaqueRect(shape, rect)) {
+			// A shape within a pixel of an edge could show through its
+			// antialiasing, even along the image's own edges
+			rect[0] += NSVG_CULL_MARGIN;
+			rect[1] += NSVG_CULL_MARGIN;
+			rect[2] -= NSVG_CULL_MARGIN;
+			rect[3] -= NSVG_CULL_MARGIN;
+			if (rect[0] < rect[2] && rect[1] < rect[3])
+				nsvg__addCover(covers, &ncovers, rect);
+		}
+	}
+
+	for (i = 0; i < n; i++) {
+		if (kept != NULL)
+			kept[i] = m;
+		if (shapes[i] != NULL)
+			shapes[m++] = shapes[i];
+	}
+	if (kept != NULL) {
+		kept[n] = m;
+		nsvg__moveShapeIndex(index, shapes, kept);
+	}
+
+	tail = list;
+	for (i = 0; i < m; i++) {
+		*tail = shapes[i];
+		tail = &shapes[i]->next;
+	}
+	*tail = NULL;
+	free(shapes);
+	free(kept);
+	return removed;
+}
+
+int nsvgCullShapes(NSVGimage* image, int occlusion) /* SVG4FNA change! */
+{
+	NSVGsymbol* symbol;
+	int removed = 0;
+
+	if (image == NULL)
+		return 0;
+
+	NSVG_TRACE_BEGIN("nsvgCullShapes", NULL);
+	// Symbols first, so instances of symbols left empty go too. Instances may
+	// be translucent, which would show what a symbol's rectangles cover.
+	for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+		removed += nsvg__cullShapes(&symbol->shapes, NULL, 0);
+	removed += nsvg__cullShapes(&image->shapes, image->ids, occlusion);
+	image->stats.culledShapes += removed;
+	NSVG_TRACE_END();
+	return removed;
+}
+
+static size_t nsvg__ptsMemoryUsage(NSVGpath* path) /* SVG4FNA change! */
+{
+	if (path->packed != NULL)
+		return nsvg__packedSize(path->npts);
+	return path->npts*2*sizeof(float);
+}
+
+static size_t nsvg__shapesMemoryUsage(NSVGshape* shape) /* SVG4FNA change! */
+{
+	NSVGpath* path;
+	size_t size = 0;
+	for (; shape != NULL; shape = shape->next) {
+		size += sizeof(NSVGshape);
+		for (path = shape->paths; path != NULL; path = path->next) {
+			size += sizeof(NSVGpath);
+			// Shared points are split evenly between the paths sharing them
+			if (path->ptsRefs != NULL)
+				size += (nsvg__ptsMemoryUsage(path) + sizeof(int)) / *path->ptsRefs;
+			else
+				size += nsvg__ptsMemoryUsage(path);
+		}
+	}
+	return size;
+}
+
+size_t nsvgImageMemoryUsage(NSVGimage* image) /* SVG4FNA change! */
+{
+	NSVGsymbol* symbol;
+	NSVGgradient* grad;
+	size_t size;
+	if (image == NULL) return 0;
+	size = sizeof(NSVGimage) + nsvg__shapesMemoryUsage(image->shapes);
+	for (symbol = image->symbols; symbol != NULL; symbol = symbol->next)
+		size += sizeof(NSVGsymbol) + nsvg__shapesMemoryUsage(symbol->shapes);
+	for (grad = image->gradients; grad != NULL; grad = grad->next)
+		size += sizeof(NSVGgradient) + sizeof(NSVGgradientStop)*(grad->nstops-1);
+	if (image->ids != NULL)
+		size += image->ids->size;
+	return size;
+}
@@ -29,6 +29,8 @@
 #ifndef NANOSVG_H_F380EFB6_CDA3_11EA_AF56_AF372EEE82E3
 #define NANOSVG_H_F380EFB6_CDA3_11EA_AF56_AF372EEE82E3
 
+#include <stddef.h> /* SVG4FNA change! */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -108,7 +110,13 @@ enum NSVGfillRule {
 };
 
 enum NSVGflags {
-	NSVG_FLAGS_VISIBLE = 0x01
+	NSVG_FLAGS_VISIBLE = 0x01, /* SVG4FNA change! */
+	// For shapes in a symbol, paints left unset there come from each <use>. /* SVG4FNA change! */
+	// Those shapes and <use>s keep the opacity in color even if the paint is none. /* SVG4FNA change! */
+	NSVG_FLAGS_INHERIT_FILL = 0x02, /* SVG4FNA change! */
+	NSVG_FLAGS_INHERIT_FILL_OPACITY = 0x04, /* SVG4FNA change! */
+	NSVG_FLAGS_INHERIT_STROKE = 0x08, /* SVG4FNA change! */
+	NSVG_FLAGS_INHERIT_STROKE_OPACITY = 0x10 /* SVG4FNA change! */
 };
 
 typedef struct NSVGgradientStop {
@@ -121,6 +129,7 @@ typedef struct NSVGgradient {
 	char spread;
 	float fx, fy;
 	int nstops;
+	struct NSVGgradient* next;	// Next gradient in NSVGimage.gradients. /* SVG4FNA change! */
 	NSVGgradientStop stops[1];
 } NSVGgradient;
 
@@ -132,6 +141,15 @@ typedef struct NSVGpaint {
 	};
 } NSVGpaint;
 
+// Points stored as 16 bits per coordinate, see nsvgQuantizePaths. Point i is /* SVG4FNA change! */
+// x = pts[i*2+0] * scale[0] + origin[0], y = pts[i*2+1] * scale[1] + origin[1] /* SVG4FNA change! */
+typedef struct NSVGpackedPts /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	float origin[2];			// Center of the points. /* SVG4FNA change! */
+	float scale[2];				// Size of one step. /* SVG4FNA change! */
+	short pts[2];				// npts*2 coordinates, from -32767 to 32767. /* SVG4FNA change! */
+} NSVGpackedPts; /* SVG4FNA change! */
+
 typedef struct NSVGpath
 {
 	float* pts;					// Cubic bezier points: x0,y0, [cpx1,cpx1,cpx2,cpy2,x1,y1], ...
@@ -139,8 +157,22 @@ typedef struct NSVGpath
 	char closed;				// Flag indicating if shapes should be treated as closed.
 	float bounds[4];			// Tight bounding box of the shape [minx,miny,maxx,maxy].
 	struct NSVGpath* next;		// Pointer to next path, or NULL if last element.
+	float offset[2];			// Added to every point in pts, see nsvgDedupePaths. /* SVG4FNA change! */
+	int* ptsRefs;				// Paths sharing pts, or NULL if this path owns them. /* SVG4FNA change! */
+	NSVGpackedPts* packed;		// Quantized points, in which case pts is NULL. /* SVG4FNA change! */
 } NSVGpath;
 
+struct NSVGshape; /* SVG4FNA change! */
+
+// Shapes shared by every <use> of a <symbol>, see NSVGshape.symbol /* SVG4FNA change! */
+typedef struct NSVGsymbol /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	char id[64];				// 'id' attr of the symbol. /* SVG4FNA change! */
+	float bounds[4];			// Tight bounding box of the shapes, in symbol space. /* SVG4FNA change! */
+	struct NSVGshape* shapes;	// Linked list of shapes, in symbol space. /* SVG4FNA change! */
+	struct NSVGsymbol* next;	// Pointer to next symbol, or NULL if last element. /* SVG4FNA change! */
+} NSVGsymbol; /* SVG4FNA change! */
+
 typedef struct NSVGshape
 {
 	char id[64];				// Optional 'id' attr of the shape or its group
@@ -162,28 +194,126 @@ typedef struct NSVGshape
 	float xform[6];				// Root transformation for fill/stroke gradient
 	NSVGpath* paths;			// Linked list of paths in the image.
 	struct NSVGshape* next;		// Pointer to next shape, or NULL if last element.
+	NSVGsymbol* symbol;			// For a <use>, the symbol to draw instead of paths, which is NULL. /* SVG4FNA change! */
+	float symbolXform[6];		// For a <use>, symbol space to image space. /* SVG4FNA change! */
 } NSVGshape;
 
+// How often nsvgParse could reuse an earlier, identical style, transform or gradient, /* SVG4FNA change! */
+// and how much nsvgDedupePaths, nsvgQuantizePaths and nsvgCullShapes could save /* SVG4FNA change! */
+typedef struct NSVGparseStats /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	int styleLookups;			// Style attributes parsed. /* SVG4FNA change! */
+	int styleHits;				// Style attributes that were memoized already. /* SVG4FNA change! */
+	int transformLookups;		// Transform attributes parsed. /* SVG4FNA change! */
+	int transformHits;			// Transform attributes that were memoized already. /* SVG4FNA change! */
+	int dedupedPaths;			// Paths nsvgDedupePaths pointed at another path's points. /* SVG4FNA change! */
+	int dedupedBytes;			// Bytes of points nsvgDedupePaths freed. /* SVG4FNA change! */
+	int quantizedPaths;			// Paths nsvgQuantizePaths packed. /* SVG4FNA change! */
+	int quantizedBytes;			// Bytes of points nsvgQuantizePaths freed. /* SVG4FNA change! */
+	float quantizeError;		// Farthest nsvgQuantizePaths moved a point, in image units. /* SVG4FNA change! */
+	int gradientLookups;		// Gradient paints resolved. /* SVG4FNA change! */
+	int gradientHits;			// Gradient paints sharing an earlier shape's gradient. /* SVG4FNA change! */
+	int culledShapes;			// Shapes nsvgCullShapes removed. /* SVG4FNA change! */
+} NSVGparseStats; /* SVG4FNA change! */
+
 typedef struct NSVGimage
 {
 	float width;				// Width of the image.
 	float height;				// Height of the image.
 	NSVGshape* shapes;			// Linked list of shapes in the image.
+	NSVGparseStats stats;		// Parser statistics, see NSVGparseStats. /* SVG4FNA change! */
+	NSVGsymbol* symbols;		// Linked list of symbols the shapes may use. /* SVG4FNA change! */
+	NSVGgradient* gradients;	// Linked list of gradients, shared by the shapes painted with them. /* SVG4FNA change! */
+	struct NSVGshapeIndex* ids;	// Shapes by element id, see nsvgFindShapes. /* SVG4FNA change! */
 } NSVGimage;
 
+// The shapes drawn by an element with an id, see nsvgFindShapes /* SVG4FNA change! */
+typedef struct NSVGshapeRange /* SVG4FNA change! */
+{ /* SVG4FNA change! */
+	NSVGshape* first;			// First shape, or NULL if the element drew none. /* SVG4FNA change! */
+	int index;					// Position of first in NSVGimage.shapes. /* SVG4FNA change! */
+	int count;					// Number of shapes, following next from first. /* SVG4FNA change! */
+} NSVGshapeRange; /* SVG4FNA change! */
+
 // Parses SVG file from a file, returns SVG image as paths.
+// gzip compressed files (.svgz) are detected and inflated. /* SVG4FNA change! */
 NSVGAPI NSVGimage* nsvgParseFromFile(const char* filename, const char* units, float dpi); /* SVG4FNA change! */
 
 // Parses SVG file from a null terminated string, returns SVG image as paths.
 // Important note: changes the string.
 NSVGAPI NSVGimage* nsvgParse(char* input, const char* units, float dpi); /* SVG4FNA change! */
 
+// Parses len bytes of SVG, which are not changed and need no null terminator. /* SVG4FNA change! */
+NSVGAPI NSVGimage* nsvgParseConst(const char* data, size_t len, const char* units, float dpi); /* SVG4FNA change! */
+
+// Parses len bytes of gzip compressed SVG (.svgz). Returns NULL if the data /* SVG4FNA change! */
+// is not gzip, or the library was built without NSVG_INFLATE. /* SVG4FNA change! */
+NSVGAPI NSVGimage* nsvgParseCompressed(const char* data, size_t len, const char* units, float dpi); /* SVG4FNA change! */
+
+// Like nsvgParseFromFile, but maps the file read-only and parses it in place /* SVG4FNA change! */
+// instead of copying it into memory first. /* SVG4FNA change! */
+NSVGAPI NSVGimage* nsvgParseFromFileMapped(const char* filename, const char* units, float dpi); /* SVG4FNA change! */
+
+// Incremental parsing, for spreading a load across several frames when a /* SVG4FNA change! */
+// thread is not an option. The data is neither copied nor changed, so it must /* SVG4FNA change! */
+// stay valid until nsvgParserFinish or nsvgParserDelete. gzip data is inflated /* SVG4FNA change! */
+// up front. /* SVG4FNA change! */
+typedef struct NSVGparser NSVGparser; /* SVG4FNA change! */
+NSVGAPI NSVGparser* nsvgParserCreate(const char* data, size_t len, const char* units, float dpi); /* SVG4FNA change! */
+
+// Parses until budgetUs microseconds have passed, stopping at the next element /* SVG4FNA change! */
+// or shape, but always making some progress. Returns 1 once all work is done. /* SVG4FNA change! */
+NSVGAPI int nsvgParserStep(NSVGparser* parser, int budgetUs); /* SVG4FNA change! */
+
+// Does any remaining work, deletes the parser and returns the image. /* SVG4FNA change! */
+NSVGAPI NSVGimage* nsvgParserFinish(NSVGparser* parser); /* SVG4FNA change! */
+
+// Deletes a parser without finishing it. /* SVG4FNA change! */
+NSVGAPI void nsvgParserDelete(NSVGparser* parser); /* SVG4FNA change! */
+
+// Finds the shapes drawn by the element with this id: a shape, a <use>, or a /* SVG4FNA change! */
+// <g> with everything inside it. Ids inside <symbol>s are not indexed. If ids /* SVG4FNA change! */
+// repeat, the first element wins. Returns 0 if no element has the id. /* SVG4FNA change! */
+NSVGAPI int nsvgFindShapes(NSVGimage* image, const char* id, NSVGshapeRange* range); /* SVG4FNA change! */
+
 // Duplicates a path.
 NSVGpath* nsvgDuplicatePath(NSVGpath* p);
 
+// Makes paths with the same points, up to a translation, share one copy of /* SVG4FNA change! */
+// them. Each path keeps its own bounds, and the difference goes in its offset, /* SVG4FNA change! */
+// so anything reading pts must add offset afterwards. Returns the bytes freed. /* SVG4FNA change! */
+NSVGAPI size_t nsvgDedupePaths(NSVGimage* image); /* SVG4FNA change! */
+
+// Packs every path's points into 16 bits per coordinate, relative to the /* SVG4FNA change! */
+// path's own extents, which about halves their memory. Image units are pixels /* SVG4FNA change! */
+// at the image's native size, so the largest error, see /* SVG4FNA change! */
+// NSVGparseStats.quantizeError, is below half a pixel for paths up to 16384 /* SVG4FNA change! */
+// pixels across. Run nsvgDedupePaths first, it skips packed paths. Returns /* SVG4FNA change! */
+// the bytes freed. /* SVG4FNA change! */
+NSVGAPI size_t nsvgQuantizePaths(NSVGimage* image); /* SVG4FNA change! */
+
+// Writes a path's npts points to out, as floats with the offset added, /* SVG4FNA change! */
+// whether they are packed or not. /* SVG4FNA change! */
+NSVGAPI void nsvgUnpackPath(NSVGpath* path, float* out); /* SVG4FNA change! */
+
+// Removes shapes that cannot change what is drawn: hidden or fully /* SVG4FNA change! */
+// transparent ones, ones with nothing to fill or stroke, and instances of /* SVG4FNA change! */
+// empty symbols. These removals are exact. /* SVG4FNA change! */
+// With occlusion, shapes entirely inside a later opaque, axis-aligned /* SVG4FNA change! */
+// rectangle (e.g. a background) go too, unless they come within an image /* SVG4FNA change! */
+// unit of its edges. That only holds while the image is drawn opaque, with /* SVG4FNA change! */
+// source-over blending, at or above its native size; otherwise the /* SVG4FNA change! */
+// rectangle's antialiased edges or translucency show what was removed. /* SVG4FNA change! */
+// The ranges nsvgFindShapes returns are updated to match. Returns the shapes /* SVG4FNA change! */
+// removed. /* SVG4FNA change! */
+NSVGAPI int nsvgCullShapes(NSVGimage* image, int occlusion); /* SVG4FNA change! */
+
 // Deletes an image.
 NSVGAPI void nsvgDelete(NSVGimage* image); /* SVG4FNA change! */
 
+// Returns the bytes allocated for an image's shapes, paths and gradients. /* SVG4FNA change! */
+NSVGAPI size_t nsvgImageMemoryUsage(NSVGimage* image); /* SVG4FNA change! */
+
 #ifdef __cplusplus
 }
 #endif
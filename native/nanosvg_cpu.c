@@ -0,0 +1,1099 @@
+#include "nanosvg_cpu.h"
+
+#include <SDL.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NSVG_CPU_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Scanline coverage accumulation is based on font-rs:
+// https://github.com/raphlinus/font-rs
+
+#define NSVG_CPU_TILE 64
+#define NSVG_CPU_ACC_STRIDE (NSVG_CPU_TILE + 2)
+#define NSVG_CPU_SCRATCH ( \
+	(NSVG_CPU_ACC_STRIDE * (NSVG_CPU_TILE + 1)) + \
+	NSVG_CPU_TILE + \
+	(NSVG_CPU_TILE * NSVG_CPU_TILE * 4) \
+)
+#define NSVG_CPU_MAX_THREADS 64 // FIXME: 64 is arbitrary!
+#define NSVG_CPU_TESS_TOL 0.25f
+#define NSVG_CPU_LUT_SIZE 256
+
+typedef struct CpuPoint
+{
+	float x;
+	float y;
+} CpuPoint;
+
+typedef struct CpuEdge
+{
+	float x0;
+	float y0;
+	float x1;
+	float y1;
+} CpuEdge;
+
+typedef struct CpuLayer
+{
+	int edgeOffset;
+	int edgeCount;
+	int binOffset; // tilesY + 1 entries of binStart
+	float bounds[4];
+	int evenOdd;
+
+	// Paint, premultiplied and with the shape opacity applied
+	int gradient;
+	float color[4];
+	int lutOffset;
+	float xform[6]; // Pixel to gradient space
+	int radial;
+	char spread;
+} CpuLayer;
+
+typedef struct CpuWorker
+{
+	NSVGcpuRasterizer *r;
+	float *scratch;
+} CpuWorker;
+
+struct NSVGcpuRasterizer
+{
+	int threads;
+
+	// Per image buffers
+	CpuEdge *edges;
+	int cedges;
+	int nedges;
+	CpuLayer *layers;
+	int clayers;
+	int nlayers;
+	float *luts;
+	int cluts;
+	int nluts;
+	// Shapes share interned gradients, so the last LUT is often reusable
+	NSVGgradient *lutGradient;
+	float lutOpacity;
+	int lutOffset;
+	int *binStart;
+	int cbinStart;
+	int nbinStart;
+	int *binEdges;
+	int cbinEdges;
+	int nbinEdges;
+	CpuPoint *points;
+	int cpoints;
+	int npoints;
+	float *unpacked; // Points of a packed path, see nsvgQuantizePaths
+	int cunpacked;
+
+	// Per thread scratch
+	float *scratch;
+	int cscratch;
+
+	// Current image, and the shape space to pixel transform of its shapes
+	float xform[6];
+	float scale; // Average scale of xform, for stroke widths
+	unsigned char *dst;
+	int w;
+	int h;
+	int stride;
+	int tilesX;
+	int tilesY;
+	SDL_atomic_t nextTile;
+};
+
+#define INTERNAL_maxi(x, y) (((x) > (y)) ? (x) : (y))
+#define INTERNAL_mini(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline float INTERNAL_clampf(float x, float lo, float hi)
+{
+	return (x < lo) ? lo : ((x > hi) ? hi : x);
+}
+
+static int INTERNAL_grow(void **ptr, int *cap, int need, size_t size, int minimum)
+{
+	void *data;
+	int c;
+	if (need <= *cap) {
+		return 1;
+	}
+	c = INTERNAL_maxi(need, minimum) + *cap / 2; // 1.5x Overallocate
+	data = realloc(*ptr, size * c);
+	if (data == NULL) return 0;
+	*ptr = data;
+	*cap = c;
+	return 1;
+}
+
+// Path flattening
+
+static void INTERNAL_addPoint(NSVGcpuRasterizer *r, float x, float y)
+{
+	if (r->npoints > 0) {
+		CpuPoint *last = &r->points[r->npoints - 1];
+		if (fabsf(last->x - x) < 1e-4f && fabsf(last->y - y) < 1e-4f) {
+			return;
+		}
+	}
+	if (!INTERNAL_grow((void**) &r->points, &r->cpoints, r->npoints + 1, sizeof(CpuPoint), 256)) {
+		return;
+	}
+	r->points[r->npoints].x = x;
+	r->points[r->npoints].y = y;
+	r->npoints += 1;
+}
+
+static void INTERNAL_flattenCubic(
+	NSVGcpuRasterizer *r,
+	float x1, float y1,
+	float x2, float y2,
+	float x3, float y3,
+	float x4, float y4,
+	int level
+) {
+	float x12, y12, x23, y23, x34, y34, x123, y123, x234, y234, x1234, y1234;
+	float dx, dy, d2, d3;
+
+	if (level > 10) return;
+
+	dx = x4 - x1;
+	dy = y4 - y1;
+	d2 = fabsf(((x2 - x4) * dy - (y2 - y4) * dx));
+	d3 = fabsf(((x3 - x4) * dy - (y3 - y4) * dx));
+	if ((d2 + d3) * (d2 + d3) < NSVG_CPU_TESS_TOL * (dx * dx + dy * dy)) {
+		INTERNAL_addPoint(r, x4, y4);
+		return;
+	}
+
+	x12 = (x1 + x2) * 0.5f;
+	y12 = (y1 + y2) * 0.5f;
+	x23 = (x2 + x3) * 0.5f;
+	y23 = (y2 + y3) * 0.5f;
+	x34 = (x3 + x4) * 0.5f;
+	y34 = (y3 + y4) * 0.5f;
+	x123 = (x12 + x23) * 0.5f;
+	y123 = (y12 + y23) * 0.5f;
+	x234 = (x23 + x34) * 0.5f;
+	y234 = (y23 + y34) * 0.5f;
+	x1234 = (x123 + x234) * 0.5f;
+	y1234 = (y123 + y234) * 0.5f;
+
+	INTERNAL_flattenCubic(r, x1, y1, x12, y12, x123, y123, x1234, y1234, level + 1);
+	INTERNAL_flattenCubic(r, x1234, y1234, x234, y234, x34, y34, x4, y4, level + 1);
+}
+
+// o is the path's offset, see nsvgDedupePaths
+#define INTERNAL_X(t, p, o) (((p)[0] + (o)[0]) * (t)[0] + ((p)[1] + (o)[1]) * (t)[2] + (t)[4])
+#define INTERNAL_Y(t, p, o) (((p)[0] + (o)[0]) * (t)[1] + ((p)[1] + (o)[1]) * (t)[3] + (t)[5])
+
+static void INTERNAL_flattenPath(NSVGcpuRasterizer *r, NSVGpath *path)
+{
+	static const float zero[2] = { 0.0f, 0.0f };
+	float *t = r->xform;
+	const float *o = path->offset;
+	const float *pts = path->pts;
+	const float *p;
+	int i;
+
+	r->npoints = 0;
+	if (path->packed != NULL) {
+		// Unpacking adds the offset already
+		if (!INTERNAL_grow((void**) &r->unpacked, &r->cunpacked, path->npts * 2, sizeof(float), 1024)) {
+			return;
+		}
+		nsvgUnpackPath(path, r->unpacked);
+		pts = r->unpacked;
+		o = zero;
+	}
+	INTERNAL_addPoint(r, INTERNAL_X(t, pts, o), INTERNAL_Y(t, pts, o));
+	for (i = 0; i < path->npts - 1; i += 3) {
+		p = &pts[i * 2];
+		INTERNAL_flattenCubic(
+			r,
+			INTERNAL_X(t, p, o), INTERNAL_Y(t, p, o),
+			INTERNAL_X(t, p + 2, o), INTERNAL_Y(t, p + 2, o),
+			INTERNAL_X(t, p + 4, o), INTERNAL_Y(t, p + 4, o),
+			INTERNAL_X(t, p + 6, o), INTERNAL_Y(t, p + 6, o),
+			0
+		);
+	}
+}
+
+// Edge generation
+
+static void INTERNAL_addEdge(NSVGcpuRasterizer *r, float x0, float y0, float x1, float y1)
+{
+	CpuEdge *e;
+	if (y0 == y1) {
+		return; // Horizontal edges have no coverage
+	}
+	if (!INTERNAL_grow((void**) &r->edges, &r->cedges, r->nedges + 1, sizeof(CpuEdge), 1024)) {
+		return;
+	}
+	e = &r->edges[r->nedges++];
+	e->x0 = x0;
+	e->y0 = y0;
+	e->x1 = x1;
+	e->y1 = y1;
+}
+
+/* Stroke pieces overlap, so every one of them is added with the same winding
+ * and the nonzero rule merges them.
+ */
+static void INTERNAL_addPolygon(NSVGcpuRasterizer *r, const CpuPoint *pts, int n)
+{
+	float area = 0.0f;
+	int i, j;
+
+	for (i = 0, j = n - 1; i < n; j = i, i += 1) {
+		area += pts[j].x * pts[i].y - pts[i].x * pts[j].y;
+	}
+	if (area > 0.0f) {
+		for (i = 0, j = n - 1; i < n; j = i, i += 1) {
+			INTERNAL_addEdge(r, pts[i].x, pts[i].y, pts[j].x, pts[j].y);
+		}
+	} else {
+		for (i = 0, j = n - 1; i < n; j = i, i += 1) {
+			INTERNAL_addEdge(r, pts[j].x, pts[j].y, pts[i].x, pts[i].y);
+		}
+	}
+}
+
+static void INTERNAL_addCircle(NSVGcpuRasterizer *r, float cx, float cy, float radius)
+{
+	CpuPoint pts[64];
+	int i, n = INTERNAL_mini(64, (int) ceilf(sqrtf(radius) * 4.0f) + 4);
+
+	for (i = 0; i < n; i += 1) {
+		float a = (float) i / n * 3.14159265f * 2.0f;
+		pts[i].x = cx + cosf(a) * radius;
+		pts[i].y = cy + sinf(a) * radius;
+	}
+	INTERNAL_addPolygon(r, pts, n);
+}
+
+static void INTERNAL_addJoin(
+	NSVGcpuRasterizer *r,
+	NSVGshape *shape,
+	CpuPoint p,
+	CpuPoint d0,
+	CpuPoint d1,
+	float hw
+) {
+	CpuPoint pts[4];
+	float n0x = -d0.y, n0y = d0.x;
+	float n1x = -d1.y, n1y = d1.x;
+	float side, dmx, dmy, dmr2;
+
+	if (shape->strokeLineJoin == NSVG_JOIN_ROUND) {
+		INTERNAL_addCircle(r, p.x, p.y, hw);
+		return;
+	}
+
+	// Only the outside of the turn has a gap to fill
+	side = ((n0x * d1.x + n0y * d1.y) < 0.0f) ? hw : -hw;
+
+	pts[0] = p;
+	pts[1].x = p.x + n0x * side;
+	pts[1].y = p.y + n0y * side;
+	pts[3].x = p.x + n1x * side;
+	pts[3].y = p.y + n1y * side;
+
+	dmx = (n0x + n1x) * 0.5f;
+	dmy = (n0y + n1y) * 0.5f;
+	dmr2 = dmx * dmx + dmy * dmy;
+	if (	shape->strokeLineJoin == NSVG_JOIN_MITER &&
+		dmr2 > 1e-6f &&
+		dmr2 * shape->miterLimit * shape->miterLimit >= 1.0f	) {
+		pts[2].x = p.x + dmx / dmr2 * side;
+		pts[2].y = p.y + dmy / dmr2 * side;
+		INTERNAL_addPolygon(r, pts, 4);
+	} else {
+		pts[2] = pts[3];
+		INTERNAL_addPolygon(r, pts, 3);
+	}
+}
+
+static void INTERNAL_strokePath(NSVGcpuRasterizer *r, NSVGshape *shape, int closed, float hw)
+{
+	CpuPoint *pts = r->points;
+	CpuPoint quad[4], dir, prevDir, firstDir;
+	int i, n = r->npoints, nsegs;
+
+	if (closed && n > 2 && pts[0].x == pts[n - 1].x && pts[0].y == pts[n - 1].y) {
+		n -= 1;
+	}
+	if (n < 2) {
+		if (n == 1 && shape->strokeLineCap == NSVG_CAP_ROUND) {
+			INTERNAL_addCircle(r, pts[0].x, pts[0].y, hw);
+		}
+		return;
+	}
+	closed = closed && (n > 2);
+	nsegs = closed ? n : (n - 1);
+
+	prevDir.x = prevDir.y = 0.0f;
+	firstDir = prevDir;
+	for (i = 0; i < nsegs; i += 1) {
+		CpuPoint a = pts[i];
+		CpuPoint b = pts[(i + 1) % n];
+		float dx = b.x - a.x, dy = b.y - a.y;
+		float len = sqrtf(dx * dx + dy * dy);
+		if (len < 1e-6f) {
+			continue;
+		}
+		dir.x = dx / len;
+		dir.y = dy / len;
+
+		if (!closed && shape->strokeLineCap == NSVG_CAP_SQUARE) {
+			if (i == 0) {
+				a.x -= dir.x * hw;
+				a.y -= dir.y * hw;
+			}
+			if (i == nsegs - 1) {
+				b.x += dir.x * hw;
+				b.y += dir.y * hw;
+			}
+		}
+
+		quad[0].x = a.x - dir.y * hw;
+		quad[0].y = a.y + dir.x * hw;
+		quad[1].x = b.x - dir.y * hw;
+		quad[1].y = b.y + dir.x * hw;
+		quad[2].x = b.x + dir.y * hw;
+		quad[2].y = b.y - dir.x * hw;
+		quad[3].x = a.x + dir.y * hw;
+		quad[3].y = a.y - dir.x * hw;
+		INTERNAL_addPolygon(r, quad, 4);
+
+		if (prevDir.x != 0.0f || prevDir.y != 0.0f) {
+			INTERNAL_addJoin(r, shape, pts[i], prevDir, dir, hw);
+		} else {
+			firstDir = dir;
+		}
+		prevDir = dir;
+	}
+
+	if (closed) {
+		INTERNAL_addJoin(r, shape, pts[0], prevDir, firstDir, hw);
+	} else if (shape->strokeLineCap == NSVG_CAP_ROUND) {
+		INTERNAL_addCircle(r, pts[0].x, pts[0].y, hw);
+		INTERNAL_addCircle(r, pts[n - 1].x, pts[n - 1].y, hw);
+	}
+}
+
+// Paints
+
+static void INTERNAL_unpackColor(unsigned int c, float opacity, float *dst)
+{
+	float a = ((c >> 24) & 0xFF) / 255.0f * opacity;
+	dst[0] = ((c >> 0) & 0xFF) / 255.0f * a;
+	dst[1] = ((c >> 8) & 0xFF) / 255.0f * a;
+	dst[2] = ((c >> 16) & 0xFF) / 255.0f * a;
+	dst[3] = a;
+}
+
+static void INTERNAL_lerpColor(unsigned int ca, unsigned int cb, float u, float opacity, float *dst)
+{
+	float a[4], b[4];
+	int i;
+
+	// Interpolate straight alpha, then premultiply
+	for (i = 0; i < 4; i += 1) {
+		a[i] = (ca >> (i * 8)) & 0xFF;
+		b[i] = (cb >> (i * 8)) & 0xFF;
+	}
+	dst[3] = (a[3] + (b[3] - a[3]) * u) / 255.0f * opacity;
+	for (i = 0; i < 3; i += 1) {
+		dst[i] = (a[i] + (b[i] - a[i]) * u) / 255.0f * dst[3];
+	}
+}
+
+static int INTERNAL_buildLut(NSVGcpuRasterizer *r, NSVGgradient *grad, float opacity)
+{
+	float *lut;
+	int offset = r->nluts;
+	int i, j;
+
+	if (!INTERNAL_grow((void**) &r->luts, &r->cluts, r->nluts + NSVG_CPU_LUT_SIZE * 4, sizeof(float), 4096)) {
+		return -1;
+	}
+	r->nluts += NSVG_CPU_LUT_SIZE * 4;
+	lut = &r->luts[offset];
+
+	if (grad->nstops == 0) {
+		memset(lut, '\0', sizeof(float) * NSVG_CPU_LUT_SIZE * 4);
+	} else if (grad->nstops == 1) {
+		for (i = 0; i < NSVG_CPU_LUT_SIZE; i += 1) {
+			INTERNAL_unpackColor(grad->stops[0].color, opacity, &lut[i * 4]);
+		}
+	} else {
+		float ua, ub;
+		int ia, ib = 0, count;
+
+		ua = INTERNAL_clampf(grad->stops[0].offset, 0.0f, 1.0f);
+		ia = (int) (ua * (NSVG_CPU_LUT_SIZE - 1));
+		for (i = 0; i < ia; i += 1) {
+			INTERNAL_unpackColor(grad->stops[0].color, opacity, &lut[i * 4]);
+		}
+
+		for (i = 0; i < grad->nstops - 1; i += 1) {
+			ua = INTERNAL_clampf(grad->stops[i].offset, 0.0f, 1.0f);
+			ub = INTERNAL_clampf(grad->stops[i + 1].offset, ua, 1.0f);
+			ia = (int) (ua * (NSVG_CPU_LUT_SIZE - 1));
+			ib = (int) (ub * (NSVG_CPU_LUT_SIZE - 1));
+			count = ib - ia;
+			for (j = 0; j < count; j += 1) {
+				INTERNAL_lerpColor(
+					grad->stops[i].color,
+					grad->stops[i + 1].color,
+					(float) j / count,
+					opacity,
+					&lut[(ia + j) * 4]
+				);
+			}
+		}
+
+		for (i = ib; i < NSVG_CPU_LUT_SIZE; i += 1) {
+			INTERNAL_unpackColor(grad->stops[grad->nstops - 1].color, opacity, &lut[i * 4]);
+		}
+	}
+	return offset;
+}
+
+static int INTERNAL_initPaint(NSVGcpuRasterizer *r, CpuLayer *layer, NSVGpaint *paint, float opacity)
+{
+	NSVGgradient *grad;
+	float *t, *x, inv[6], det;
+
+	if (paint->type == NSVG_PAINT_COLOR) {
+		layer->gradient = 0;
+		INTERNAL_unpackColor(paint->color, opacity, layer->color);
+		return 1;
+	}
+
+	grad = paint->gradient;
+	layer->gradient = 1;
+	layer->radial = (paint->type == NSVG_PAINT_RADIAL_GRADIENT);
+	layer->spread = grad->spread;
+	if (grad != r->lutGradient || opacity != r->lutOpacity) {
+		r->lutOffset = INTERNAL_buildLut(r, grad, opacity);
+		if (r->lutOffset == -1) {
+			r->lutGradient = NULL;
+			return 0;
+		}
+		r->lutGradient = grad;
+		r->lutOpacity = opacity;
+	}
+	layer->lutOffset = r->lutOffset;
+
+	// The gradient transform maps shape space, fold in pixel to shape space
+	x = r->xform;
+	det = x[0] * x[3] - x[2] * x[1];
+	if (fabsf(det) < 1e-12f) {
+		return 0;
+	}
+	det = 1.0f / det;
+	inv[0] = x[3] * det;
+	inv[1] = -x[1] * det;
+	inv[2] = -x[2] * det;
+	inv[3] = x[0] * det;
+	inv[4] = (x[2] * x[5] - x[3] * x[4]) * det;
+	inv[5] = (x[1] * x[4] - x[0] * x[5]) * det;
+	t = grad->xform;
+	layer->xform[0] = inv[0] * t[0] + inv[1] * t[2];
+	layer->xform[1] = inv[0] * t[1] + inv[1] * t[3];
+	layer->xform[2] = inv[2] * t[0] + inv[3] * t[2];
+	layer->xform[3] = inv[2] * t[1] + inv[3] * t[3];
+	layer->xform[4] = inv[4] * t[0] + inv[5] * t[2] + t[4];
+	layer->xform[5] = inv[4] * t[1] + inv[5] * t[3] + t[5];
+	return 1;
+}
+
+// Layers and binning
+
+static void INTERNAL_endLayer(NSVGcpuRasterizer *r, CpuLayer *layer)
+{
+	CpuEdge *e;
+	int i, ty, y0, y1, total;
+	int *bins;
+
+	layer->edgeCount = r->nedges - layer->edgeOffset;
+	layer->bounds[0] = layer->bounds[1] = 1e30f;
+	layer->bounds[2] = layer->bounds[3] = -1e30f;
+	for (i = 0; i < layer->edgeCount; i += 1) {
+		e = &r->edges[layer->edgeOffset + i];
+		layer->bounds[0] = fminf(layer->bounds[0], fminf(e->x0, e->x1));
+		layer->bounds[1] = fminf(layer->bounds[1], fminf(e->y0, e->y1));
+		layer->bounds[2] = fmaxf(layer->bounds[2], fmaxf(e->x0, e->x1));
+		layer->bounds[3] = fmaxf(layer->bounds[3], fmaxf(e->y0, e->y1));
+	}
+
+	// Bin edges by tile row, an edge is needed by every row it crosses
+	layer->binOffset = r->nbinStart;
+	if (!INTERNAL_grow((void**) &r->binStart, &r->cbinStart, r->nbinStart + r->tilesY + 1, sizeof(int), 256)) {
+		layer->edgeCount = 0;
+		return;
+	}
+	r->nbinStart += r->tilesY + 1;
+	bins = &r->binStart[layer->binOffset];
+	memset(bins, '\0', sizeof(int) * (r->tilesY + 1));
+
+	for (i = 0; i < layer->edgeCount; i += 1) {
+		e = &r->edges[layer->edgeOffset + i];
+		if (fminf(e->x0, e->x1) >= r->w) continue;
+		y0 = INTERNAL_maxi(0, (int) floorf(fminf(e->y0, e->y1)) / NSVG_CPU_TILE);
+		y1 = INTERNAL_mini(r->tilesY - 1, (int) floorf(fmaxf(e->y0, e->y1)) / NSVG_CPU_TILE);
+		for (ty = y0; ty <= y1; ty += 1) {
+			bins[ty + 1] += 1;
+		}
+	}
+	for (ty = 0; ty < r->tilesY; ty += 1) {
+		bins[ty + 1] += bins[ty];
+	}
+	total = bins[r->tilesY];
+	if (!INTERNAL_grow((void**) &r->binEdges, &r->cbinEdges, r->nbinEdges + total, sizeof(int), 1024)) {
+		layer->edgeCount = 0;
+		return;
+	}
+	for (ty = 0; ty <= r->tilesY; ty += 1) {
+		bins[ty] += r->nbinEdges;
+	}
+
+	// Fill each row, using the next row's start as the cursor, then shift back
+	for (i = 0; i < layer->edgeCount; i += 1) {
+		e = &r->edges[layer->edgeOffset + i];
+		if (fminf(e->x0, e->x1) >= r->w) continue;
+		y0 = INTERNAL_maxi(0, (int) floorf(fminf(e->y0, e->y1)) / NSVG_CPU_TILE);
+		y1 = INTERNAL_mini(r->tilesY - 1, (int) floorf(fmaxf(e->y0, e->y1)) / NSVG_CPU_TILE);
+		for (ty = y0; ty <= y1; ty += 1) {
+			r->binEdges[bins[ty]++] = layer->edgeOffset + i;
+		}
+	}
+	for (ty = r->tilesY; ty > 0; ty -= 1) {
+		bins[ty] = bins[ty - 1];
+	}
+	bins[0] = r->nbinEdges;
+	r->nbinEdges += total;
+}
+
+static CpuLayer* INTERNAL_beginLayer(NSVGcpuRasterizer *r)
+{
+	CpuLayer *layer;
+	if (!INTERNAL_grow((void**) &r->layers, &r->clayers, r->nlayers + 1, sizeof(CpuLayer), 64)) {
+		return NULL;
+	}
+	layer = &r->layers[r->nlayers++];
+	memset(layer, '\0', sizeof(CpuLayer));
+	layer->edgeOffset = r->nedges;
+	return layer;
+}
+
+/* The paint a symbol's shape draws with for one instance, taking what it left
+ * unset from the instance's paint. Both keep their opacity in the color's
+ * alpha even without a color, gradients aside.
+ */
+static NSVGpaint INTERNAL_inheritPaint(
+	const NSVGpaint *own,
+	const NSVGpaint *inherited,
+	int flags,
+	int paintFlag,
+	int opacityFlag
+) {
+	NSVGpaint paint = (flags & paintFlag) ? *inherited : *own;
+	const NSVGpaint *opacity = (flags & opacityFlag) ? inherited : own;
+	int gradient = (
+		opacity->type == NSVG_PAINT_LINEAR_GRADIENT ||
+		opacity->type == NSVG_PAINT_RADIAL_GRADIENT
+	);
+	if (paint.type == NSVG_PAINT_COLOR && !gradient) {
+		paint.color = (paint.color & 0x00ffffff) | (opacity->color & 0xff000000);
+	}
+	return paint;
+}
+
+static void INTERNAL_prepareShapes(NSVGcpuRasterizer *r, NSVGshape *shapes, float opacity, NSVGshape *instance)
+{
+	NSVGshape *shape;
+	NSVGpath *path;
+	CpuLayer *layer;
+	NSVGpaint fill, stroke;
+	float saved[6], *t, *s, alpha;
+	int i;
+
+	for (shape = shapes; shape != NULL; shape = shape->next) {
+		alpha = shape->opacity * opacity;
+		if (!(shape->flags & NSVG_FLAGS_VISIBLE) || alpha <= 0.0f) {
+			continue;
+		}
+
+		// Instances draw their symbol's shapes through their own transform
+		if (shape->symbol != NULL) {
+			memcpy(saved, r->xform, sizeof(saved));
+			t = shape->symbolXform;
+			s = saved;
+			r->xform[0] = t[0] * s[0] + t[1] * s[2];
+			r->xform[1] = t[0] * s[1] + t[1] * s[3];
+			r->xform[2] = t[2] * s[0] + t[3] * s[2];
+			r->xform[3] = t[2] * s[1] + t[3] * s[3];
+			r->xform[4] = t[4] * s[0] + t[5] * s[2] + s[4];
+			r->xform[5] = t[4] * s[1] + t[5] * s[3] + s[5];
+			r->scale = (
+				sqrtf(r->xform[0] * r->xform[0] + r->xform[2] * r->xform[2]) +
+				sqrtf(r->xform[1] * r->xform[1] + r->xform[3] * r->xform[3])
+			) * 0.5f;
+			INTERNAL_prepareShapes(r, shape->symbol->shapes, alpha, shape);
+			memcpy(r->xform, saved, sizeof(saved));
+			r->scale = (
+				sqrtf(r->xform[0] * r->xform[0] + r->xform[2] * r->xform[2]) +
+				sqrtf(r->xform[1] * r->xform[1] + r->xform[3] * r->xform[3])
+			) * 0.5f;
+			continue;
+		}
+
+		// A symbol's shapes may leave their paints to the <use> drawing them
+		fill = shape->fill;
+		stroke = shape->stroke;
+		if (instance != NULL) {
+			fill = INTERNAL_inheritPaint(&shape->fill, &instance->fill, shape->flags, NSVG_FLAGS_INHERIT_FILL, NSVG_FLAGS_INHERIT_FILL_OPACITY);
+			stroke = INTERNAL_inheritPaint(&shape->stroke, &instance->stroke, shape->flags, NSVG_FLAGS_INHERIT_STROKE, NSVG_FLAGS_INHERIT_STROKE_OPACITY);
+		}
+
+		if (fill.type != NSVG_PAINT_NONE) {
+			layer = INTERNAL_beginLayer(r);
+			if (layer == NULL) return;
+			layer->evenOdd = (shape->fillRule == NSVG_FILLRULE_EVENODD);
+			if (!INTERNAL_initPaint(r, layer, &fill, alpha)) {
+				r->nlayers -= 1;
+				continue;
+			}
+			for (path = shape->paths; path != NULL; path = path->next) {
+				INTERNAL_flattenPath(r, path);
+				for (i = 0; i < r->npoints; i += 1) {
+					// Fills are always closed
+					CpuPoint *a = &r->points[i];
+					CpuPoint *b = &r->points[(i + 1) % r->npoints];
+					INTERNAL_addEdge(r, a->x, a->y, b->x, b->y);
+				}
+			}
+			INTERNAL_endLayer(r, layer);
+		}
+
+		if (stroke.type != NSVG_PAINT_NONE && shape->strokeWidth > 0.0f) {
+			layer = INTERNAL_beginLayer(r);
+			if (layer == NULL) return;
+			if (!INTERNAL_initPaint(r, layer, &stroke, alpha)) {
+				r->nlayers -= 1;
+				continue;
+			}
+			for (path = shape->paths; path != NULL; path = path->next) {
+				INTERNAL_flattenPath(r, path);
+				INTERNAL_strokePath(r, shape, path->closed, shape->strokeWidth * r->scale * 0.5f);
+			}
+			INTERNAL_endLayer(r, layer);
+		}
+	}
+}
+
+static void INTERNAL_prepare(NSVGcpuRasterizer *r, NSVGimage *image)
+{
+	r->nedges = 0;
+	r->nlayers = 0;
+	r->nluts = 0;
+	r->lutGradient = NULL;
+	r->nbinStart = 0;
+	r->nbinEdges = 0;
+
+	INTERNAL_prepareShapes(r, image->shapes, 1.0f, NULL);
+}
+
+// Tile rasterization
+
+static void INTERNAL_accumulateLine(float *acc, float x0, float y0, float x1, float y1)
+{
+	float dir, dxdy, x, xnext, dy, d, xa, xb, x0floor, x1ceil, xmf, s, x0f, x1f, a0, a1, a2, am;
+	int y, yend, ls, x0i, x1i, xi;
+
+	if (y0 == y1) return;
+	if (y0 < y1) {
+		dir = 1.0f;
+	} else {
+		float t;
+		dir = -1.0f;
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+
+	dxdy = (x1 - x0) / (y1 - y0);
+	x = x0;
+	yend = (int) ceilf(y1);
+	for (y = (int) y0; y < yend; y += 1) {
+		ls = y * NSVG_CPU_ACC_STRIDE;
+		dy = fminf((float) (y + 1), y1) - fmaxf((float) y, y0);
+		xnext = x + dxdy * dy;
+		d = dy * dir;
+		if (x < xnext) {
+			xa = x;
+			xb = xnext;
+		} else {
+			xa = xnext;
+			xb = x;
+		}
+		x0floor = floorf(xa);
+		x0i = (int) x0floor;
+		x1ceil = ceilf(xb);
+		x1i = (int) x1ceil;
+		if (x1i <= x0i + 1) {
+			xmf = 0.5f * (x + xnext) - x0floor;
+			acc[ls + x0i] += d - d * xmf;
+			acc[ls + x0i + 1] += d * xmf;
+		} else {
+			s = 1.0f / (xb - xa);
+			x0f = xa - x0floor;
+			a0 = 0.5f * s * (1.0f - x0f) * (1.0f - x0f);
+			x1f = xb - x1ceil + 1.0f;
+			am = 0.5f * s * x1f * x1f;
+			acc[ls + x0i] += d * a0;
+			if (x1i == x0i + 2) {
+				acc[ls + x0i + 1] += d * (1.0f - a0 - am);
+			} else {
+				a1 = s * (1.5f - x0f);
+				acc[ls + x0i + 1] += d * (a1 - a0);
+				for (xi = x0i + 2; xi < x1i - 1; xi += 1) {
+					acc[ls + xi] += d * s;
+				}
+				a2 = a1 + (x1i - x0i - 3) * s;
+				acc[ls + x1i - 1] += d * (1.0f - a2 - am);
+			}
+			acc[ls + x1i] += d * am;
+		}
+		x = xnext;
+	}
+}
+
+/* Clips an edge to the tile. Whatever is left of the tile still adds winding
+ * to every pixel in the row, so it is folded onto the left border. Whatever
+ * is right of the tile can't affect it and is flattened onto the right border.
+ */
+static void INTERNAL_clipEdge(float *acc, const CpuEdge *e, float ox, float oy, float tw, float th)
+{
+	float x0 = e->x0 - ox, y0 = e->y0 - oy;
+	float x1 = e->x1 - ox, y1 = e->y1 - oy;
+	float dxdy, t[4], px[4], py[4], tmp;
+	int i, n;
+
+	if ((y0 <= 0.0f && y1 <= 0.0f) || (y0 >= th && y1 >= th)) return;
+	if (x0 >= tw && x1 >= tw) return;
+
+	dxdy = (x1 - x0) / (y1 - y0);
+	if (y0 < 0.0f) { x0 -= y0 * dxdy; y0 = 0.0f; }
+	if (y1 < 0.0f) { x1 -= y1 * dxdy; y1 = 0.0f; }
+	if (y0 > th) { x0 += (th - y0) * dxdy; y0 = th; }
+	if (y1 > th) { x1 += (th - y1) * dxdy; y1 = th; }
+
+	// Split where the edge crosses the tile's left and right borders
+	n = 0;
+	t[n++] = 0.0f;
+	if (x0 != x1) {
+		tmp = (0.0f - x0) / (x1 - x0);
+		if (tmp > 0.0f && tmp < 1.0f) t[n++] = tmp;
+		tmp = (tw - x0) / (x1 - x0);
+		if (tmp > 0.0f && tmp < 1.0f) t[n++] = tmp;
+		if (n == 3 && t[2] < t[1]) {
+			tmp = t[1];
+			t[1] = t[2];
+			t[2] = tmp;
+		}
+	}
+	t[n++] = 1.0f;
+	for (i = 0; i < n; i += 1) {
+		px[i] = INTERNAL_clampf(x0 + (x1 - x0) * t[i], 0.0f, tw);
+		py[i] = y0 + (y1 - y0) * t[i];
+	}
+	for (i = 0; i < n - 1; i += 1) {
+		INTERNAL_accumulateLine(acc, px[i], py[i], px[i + 1], py[i + 1]);
+	}
+}
+
+static void INTERNAL_coverage(const float *acc, float *cov, int evenOdd)
+{
+	int x;
+#ifdef NSVG_CPU_SSE2
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	__m128 carry = _mm_setzero_ps();
+	for (x = 0; x < NSVG_CPU_TILE; x += 4) {
+		// Prefix sum within the vector, then add the previous vector's total
+		__m128 v = _mm_loadu_ps(&acc[x]);
+		v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+		v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+		v = _mm_add_ps(v, carry);
+		carry = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+		v = _mm_and_ps(v, absMask);
+		if (evenOdd) {
+			__m128 f = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(v, half)));
+			v = _mm_sub_ps(v, _mm_mul_ps(f, two));
+			v = _mm_min_ps(v, _mm_sub_ps(two, v));
+		}
+		_mm_storeu_ps(&cov[x], _mm_min_ps(v, one));
+	}
+#else
+	float s = 0.0f, c;
+	for (x = 0; x < NSVG_CPU_TILE; x += 1) {
+		s += acc[x];
+		c = fabsf(s);
+		if (evenOdd) {
+			c -= 2.0f * (int) (c * 0.5f);
+			c = fminf(c, 2.0f - c);
+		}
+		cov[x] = fminf(c, 1.0f);
+	}
+#endif
+}
+
+static inline const float* INTERNAL_gradientColor(NSVGcpuRasterizer *r, const CpuLayer *layer, float px, float py)
+{
+	const float *t = layer->xform;
+	float gx = px * t[0] + py * t[2] + t[4];
+	float gy = px * t[1] + py * t[3] + t[5];
+	float u = layer->radial ? sqrtf(gx * gx + gy * gy) : gy;
+
+	if (layer->spread == NSVG_SPREAD_REPEAT) {
+		u -= floorf(u);
+	} else if (layer->spread == NSVG_SPREAD_REFLECT) {
+		u = fabsf(u);
+		u -= 2.0f * floorf(u * 0.5f);
+		if (u > 1.0f) u = 2.0f - u;
+	}
+	u = INTERNAL_clampf(u * (NSVG_CPU_LUT_SIZE - 1), 0.0f, NSVG_CPU_LUT_SIZE - 1);
+	return &r->luts[layer->lutOffset + ((int) u) * 4];
+}
+
+static void INTERNAL_composite(
+	NSVGcpuRasterizer *r,
+	const CpuLayer *layer,
+	const float *cov,
+	float *pix,
+	int x0,
+	int x1,
+	float px,
+	float py
+) {
+	const float *color = layer->color;
+	int x;
+#ifdef NSVG_CPU_SSE2
+	const __m128 one = _mm_set1_ps(1.0f);
+	__m128 src, dst;
+	for (x = x0; x < x1; x += 1) {
+		if (cov[x] <= 0.0f) continue;
+		if (layer->gradient) {
+			color = INTERNAL_gradientColor(r, layer, px + x + 0.5f, py);
+		}
+		// Premultiplied source over
+		src = _mm_mul_ps(_mm_loadu_ps(color), _mm_set1_ps(cov[x]));
+		dst = _mm_loadu_ps(&pix[x * 4]);
+		dst = _mm_add_ps(src, _mm_mul_ps(dst, _mm_sub_ps(one, _mm_shuffle_ps(src, src, _MM_SHUFFLE(3, 3, 3, 3)))));
+		_mm_storeu_ps(&pix[x * 4], dst);
+	}
+#else
+	float k, ia;
+	for (x = x0; x < x1; x += 1) {
+		if (cov[x] <= 0.0f) continue;
+		if (layer->gradient) {
+			color = INTERNAL_gradientColor(r, layer, px + x + 0.5f, py);
+		}
+		k = cov[x];
+		ia = 1.0f - color[3] * k;
+		pix[x * 4 + 0] = color[0] * k + pix[x * 4 + 0] * ia;
+		pix[x * 4 + 1] = color[1] * k + pix[x * 4 + 1] * ia;
+		pix[x * 4 + 2] = color[2] * k + pix[x * 4 + 2] * ia;
+		pix[x * 4 + 3] = color[3] * k + pix[x * 4 + 3] * ia;
+	}
+#endif
+}
+
+static void INTERNAL_rasterizeTile(NSVGcpuRasterizer *r, int tile, float *scratch)
+{
+	float *acc = scratch;
+	float *cov = acc + NSVG_CPU_ACC_STRIDE * (NSVG_CPU_TILE + 1);
+	float *pix = cov + NSVG_CPU_TILE;
+	int tx = tile % r->tilesX;
+	int ty = tile / r->tilesX;
+	int ox = tx * NSVG_CPU_TILE;
+	int oy = ty * NSVG_CPU_TILE;
+	int tw = INTERNAL_mini(NSVG_CPU_TILE, r->w - ox);
+	int th = INTERNAL_mini(NSVG_CPU_TILE, r->h - oy);
+	int i, j, x, y, y0, y1, x0, x1;
+
+	memset(pix, '\0', sizeof(float) * NSVG_CPU_TILE * NSVG_CPU_TILE * 4);
+
+	for (i = 0; i < r->nlayers; i += 1) {
+		const CpuLayer *layer = &r->layers[i];
+		const float *b = layer->bounds;
+		const int *bins = &r->binStart[layer->binOffset];
+
+		if (layer->edgeCount == 0) continue;
+		if (b[2] <= ox || b[0] >= ox + tw || b[3] <= oy || b[1] >= oy + th) continue;
+		if (bins[ty] == bins[ty + 1]) continue;
+
+		memset(acc, '\0', sizeof(float) * NSVG_CPU_ACC_STRIDE * (NSVG_CPU_TILE + 1));
+		for (j = bins[ty]; j < bins[ty + 1]; j += 1) {
+			INTERNAL_clipEdge(acc, &r->edges[r->binEdges[j]], (float) ox, (float) oy, (float) tw, (float) th);
+		}
+
+		y0 = INTERNAL_maxi(0, (int) floorf(b[1]) - oy);
+		y1 = INTERNAL_mini(th, (int) ceilf(b[3]) - oy);
+		x0 = INTERNAL_maxi(0, (int) floorf(b[0]) - ox);
+		x1 = INTERNAL_mini(tw, (int) ceilf(b[2]) - ox + 1);
+		for (y = y0; y < y1; y += 1) {
+			INTERNAL_coverage(&acc[y * NSVG_CPU_ACC_STRIDE], cov, layer->evenOdd);
+			INTERNAL_composite(
+				r,
+				layer,
+				cov,
+				&pix[y * NSVG_CPU_TILE * 4],
+				x0,
+				x1,
+				(float) ox,
+				oy + y + 0.5f
+			);
+		}
+	}
+
+	// Convert to non-premultiplied RGBA8
+	for (y = 0; y < th; y += 1) {
+		const float *src = &pix[y * NSVG_CPU_TILE * 4];
+		unsigned char *dst = &r->dst[(oy + y) * r->stride + ox * 4];
+		for (x = 0; x < tw; x += 1, src += 4, dst += 4) {
+			float a = src[3];
+			if (a <= 0.0f) {
+				dst[0] = dst[1] = dst[2] = dst[3] = 0;
+				continue;
+			}
+			a = fminf(a, 1.0f);
+			dst[0] = (unsigned char) (INTERNAL_clampf(src[0] / a, 0.0f, 1.0f) * 255.0f + 0.5f);
+			dst[1] = (unsigned char) (INTERNAL_clampf(src[1] / a, 0.0f, 1.0f) * 255.0f + 0.5f);
+			dst[2] = (unsigned char) (INTERNAL_clampf(src[2] / a, 0.0f, 1.0f) * 255.0f + 0.5f);
+			dst[3] = (unsigned char) (a * 255.0f + 0.5f);
+		}
+	}
+}
+
+static int SDLCALL INTERNAL_worker(void *data)
+{
+	CpuWorker *worker = (CpuWorker*) data;
+	NSVGcpuRasterizer *r = worker->r;
+	int ntiles = r->tilesX * r->tilesY;
+	int tile;
+
+	while ((tile = SDL_AtomicAdd(&r->nextTile, 1)) < ntiles) {
+		INTERNAL_rasterizeTile(r, tile, worker->scratch);
+	}
+	return 0;
+}
+
+// Public API
+
+NSVGcpuRasterizer* nsvgCpuCreate(int threads)
+{
+	NSVGcpuRasterizer *r = (NSVGcpuRasterizer*) malloc(sizeof(NSVGcpuRasterizer));
+	if (r == NULL) {
+		return NULL;
+	}
+	memset(r, '\0', sizeof(NSVGcpuRasterizer));
+	nsvgCpuSetThreads(r, threads);
+	return r;
+}
+
+void nsvgCpuSetThreads(NSVGcpuRasterizer *r, int threads)
+{
+	if (threads <= 0) {
+		threads = SDL_GetCPUCount();
+	}
+	r->threads = INTERNAL_maxi(1, INTERNAL_mini(threads, NSVG_CPU_MAX_THREADS));
+}
+
+void nsvgCpuDelete(NSVGcpuRasterizer *r)
+{
+	if (r == NULL) {
+		return;
+	}
+	free(r->edges);
+	free(r->layers);
+	free(r->luts);
+	free(r->binStart);
+	free(r->binEdges);
+	free(r->points);
+	free(r->unpacked);
+	free(r->scratch);
+	free(r);
+}
+
+void nsvgCpuRasterize(
+	NSVGcpuRasterizer *r,
+	NSVGimage *image,
+	float tx,
+	float ty,
+	float scale,
+	unsigned char *dst,
+	int w,
+	int h,
+	int stride
+) {
+	CpuWorker workers[NSVG_CPU_MAX_THREADS];
+	SDL_Thread *threads[NSVG_CPU_MAX_THREADS];
+	int i, nthreads;
+
+	if (w <= 0 || h <= 0) {
+		return;
+	}
+
+	r->xform[0] = scale;
+	r->xform[1] = 0.0f;
+	r->xform[2] = 0.0f;
+	r->xform[3] = scale;
+	r->xform[4] = tx;
+	r->xform[5] = ty;
+	r->scale = scale;
+	r->dst = dst;
+	r->w = w;
+	r->h = h;
+	r->stride = stride;
+	r->tilesX = (w + NSVG_CPU_TILE - 1) / NSVG_CPU_TILE;
+	r->tilesY = (h + NSVG_CPU_TILE - 1) / NSVG_CPU_TILE;
+
+	INTERNAL_prepare(r, image);
+
+	nthreads = INTERNAL_mini(r->threads, r->tilesX * r->tilesY);
+	if (!INTERNAL_grow((void**) &r->scratch, &r->cscratch, nthreads * NSVG_CPU_SCRATCH, sizeof(float), 0)) {
+		nthreads = 1;
+		if (!INTERNAL_grow((void**) &r->scratch, &r->cscratch, NSVG_CPU_SCRATCH, sizeof(float), 0)) {
+			return;
+		}
+	}
+
+	SDL_AtomicSet(&r->nextTile, 0);
+	for (i = 0; i < nthreads; i += 1) {
+		workers[i].r = r;
+		workers[i].scratch = &r->scratch[i * NSVG_CPU_SCRATCH];
+	}
+
+	// The calling thread works too, if a thread fails to start the rest pick up its tiles
+	for (i = 1; i < nthreads; i += 1) {
+		threads[i] = SDL_CreateThread(INTERNAL_worker, "nsvgCpuRasterize", &workers[i]);
+	}
+	INTERNAL_worker(&workers[0]);
+	for (i = 1; i < nthreads; i += 1) {
+		if (threads[i] != NULL) {
+			SDL_WaitThread(threads[i], NULL);
+		}
+	}
+}
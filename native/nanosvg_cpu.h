@@ -0,0 +1,59 @@
+#ifndef NANOSVG_CPU_H
+#define NANOSVG_CPU_H
+
+#include "nanosvg.h"
+
+#ifdef _WIN32
+#define NSVGCPUAPI __declspec(dllexport)
+#else
+#define NSVGCPUAPI
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* CPU rasterizer for NSVGimage, for when there is no GPU to draw with
+ * (headless tools, thumbnails and atlases built on worker threads).
+ *
+ * The output is split into 64x64 tiles that are rasterized in parallel.
+ * Each shape's coverage is accumulated per scanline with SIMD and then
+ * composited into the tile. The output is non-premultiplied RGBA8, which is
+ * what nvgCreateImageRGBA expects when no image flags are passed.
+ *
+ * A rasterizer keeps its scratch memory between calls. It must not be used
+ * from two threads at once, make one per thread instead.
+ */
+typedef struct NSVGcpuRasterizer NSVGcpuRasterizer;
+
+/* threads is the number of threads rasterizing tiles, including the calling
+ * thread. 0 uses one thread per CPU.
+ */
+NSVGCPUAPI NSVGcpuRasterizer* nsvgCpuCreate(int threads);
+NSVGCPUAPI void nsvgCpuSetThreads(NSVGcpuRasterizer *r, int threads);
+NSVGCPUAPI void nsvgCpuDelete(NSVGcpuRasterizer *r);
+
+/* Rasterizes the image into dst, which is w * h pixels, stride bytes per row.
+ * Image coordinates are scaled by scale, then offset by (tx, ty) pixels.
+ * dst is overwritten, pixels without any shape are transparent black.
+ *
+ * Dashed strokes are drawn solid, like nvgDrawSVG does. Radial gradients
+ * ignore the focal point.
+ */
+NSVGCPUAPI void nsvgCpuRasterize(
+	NSVGcpuRasterizer *r,
+	NSVGimage *image,
+	float tx,
+	float ty,
+	float scale,
+	unsigned char *dst,
+	int w,
+	int h,
+	int stride
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NANOSVG_CPU_H */
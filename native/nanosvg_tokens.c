@@ -0,0 +1,345 @@
+/* SVG4FNA - SVG Container and Renderer for FNA
+ *
+ * Copyright (c) 2024 Ethan Lee
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software in a
+ * product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ * Ethan "flibitijibibo" Lee <flibitijibibo@flibitijibibo.com>
+ *
+ */
+
+// Generates nanosvg_tokens.h, the perfect hash tables nanosvg.c uses to look
+// up element, attribute and color names. This is a host tool, it does not
+// use SDL. Usage: nanosvg_tokens nanosvg.c > nanosvg_tokens.h
+//
+// The element and attribute names are listed below, the color names are read
+// from nanosvg.c's nsvg__colors table, in order. Run `make tokens` after
+// changing either.
+//
+// Each table uses hash and displace: a name's FNV-1a hash picks a bucket,
+// and the bucket's displacement is mixed into the hash to pick the slot. The
+// displacements are searched here so that every name gets its own slot, so a
+// lookup is one hash, two table reads and one strcmp to reject unknown names.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *tokens[] =
+{
+	// Elements
+	"circle",
+	"defs",
+	"ellipse",
+	"g",
+	"line",
+	"linearGradient",
+	"path",
+	"polygon",
+	"polyline",
+	"radialGradient",
+	"rect",
+	"stop",
+	"svg",
+	"symbol",
+	"use",
+
+	// Elements whose whole subtree is skipped ("style" is an attribute too)
+	"desc",
+	"filter",
+	"font",
+	"font-face",
+	"foreignObject",
+	"metadata",
+	"script",
+	"title",
+
+	// Attributes
+	"cx",
+	"cy",
+	"d",
+	"display",
+	"fill",
+	"fill-opacity",
+	"fill-rule",
+	"font-size",
+	"fx",
+	"fy",
+	"gradientTransform",
+	"gradientUnits",
+	"height",
+	"href",
+	"id",
+	"offset",
+	"opacity",
+	"points",
+	"preserveAspectRatio",
+	"r",
+	"rx",
+	"ry",
+	"spreadMethod",
+	"stop-color",
+	"stop-opacity",
+	"stroke",
+	"stroke-dasharray",
+	"stroke-dashoffset",
+	"stroke-linecap",
+	"stroke-linejoin",
+	"stroke-miterlimit",
+	"stroke-opacity",
+	"stroke-width",
+	"style",
+	"transform",
+	"viewBox",
+	"width",
+	"x",
+	"x1",
+	"x2",
+	"xlink:href",
+	"y",
+	"y1",
+	"y2"
+};
+
+#define MAX_NAMES 256
+#define MAX_DISPLACEMENT 65536
+
+// Must match nsvg__hashName and nsvg__lookupName in nanosvg.c!
+static unsigned int hashName(const char *s)
+{
+	unsigned int h = 2166136261u;
+	while (*s) {
+		h = (h ^ (unsigned char) *s++) * 16777619u;
+	}
+	return h;
+}
+
+static unsigned int slotOf(unsigned int h, unsigned int d, int bits)
+{
+	return ((h ^ d) * 2654435761u) >> (32 - bits);
+}
+
+typedef struct Table
+{
+	int bits;
+	int nbuckets;
+	unsigned short displace[MAX_NAMES];
+	unsigned char slots[MAX_NAMES];
+} Table;
+
+static int *bucketSizes;
+
+static int compareBucketSizes(const void *a, const void *b)
+{
+	return bucketSizes[*(const int*) b] - bucketSizes[*(const int*) a];
+}
+
+/* Slots hold the name's index + 1, 0 is empty */
+static int buildTable(Table *table, const char **names, int count)
+{
+	unsigned int hashes[MAX_NAMES];
+	int sizes[MAX_NAMES];
+	int order[MAX_NAMES];
+	int size, b, i, j;
+
+	table->bits = 1;
+	while ((1 << table->bits) < count) {
+		table->bits += 1;
+	}
+	size = 1 << table->bits;
+	table->nbuckets = size / 2;
+	if (size > MAX_NAMES) {
+		return 0;
+	}
+
+	memset(sizes, '\0', sizeof(sizes));
+	for (i = 0; i < count; i += 1) {
+		hashes[i] = hashName(names[i]);
+		sizes[hashes[i] % table->nbuckets] += 1;
+	}
+
+	// Place the biggest buckets first, while the table is still empty
+	for (b = 0; b < table->nbuckets; b += 1) {
+		order[b] = b;
+	}
+	bucketSizes = sizes;
+	qsort(order, table->nbuckets, sizeof(int), compareBucketSizes);
+
+	memset(table->displace, '\0', sizeof(table->displace));
+	memset(table->slots, '\0', sizeof(table->slots));
+	for (b = 0; b < table->nbuckets && sizes[order[b]] > 0; b += 1) {
+		int bucket = order[b];
+		unsigned int d;
+		for (d = 0; d < MAX_DISPLACEMENT; d += 1) {
+			unsigned char taken[MAX_NAMES];
+			int ok = 1;
+			memcpy(taken, table->slots, size);
+			for (i = 0; i < count && ok; i += 1) {
+				if ((hashes[i] % table->nbuckets) == (unsigned int) bucket) {
+					unsigned int slot = slotOf(hashes[i], d, table->bits);
+					if (taken[slot]) {
+						ok = 0;
+					}
+					taken[slot] = 1;
+				}
+			}
+			if (ok) {
+				break;
+			}
+		}
+		if (d == MAX_DISPLACEMENT) {
+			return 0;
+		}
+		table->displace[bucket] = (unsigned short) d;
+		for (i = 0; i < count; i += 1) {
+			if ((hashes[i] % table->nbuckets) == (unsigned int) bucket) {
+				table->slots[slotOf(hashes[i], d, table->bits)] = (unsigned char) (i + 1);
+			}
+		}
+	}
+
+	// Paranoia: every name must find itself
+	for (i = 0; i < count; i += 1) {
+		unsigned int d = table->displace[hashes[i] % table->nbuckets];
+		j = table->slots[slotOf(hashes[i], d, table->bits)];
+		if (j != i + 1) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void printTable(const Table *table, const char *prefix, const char *name)
+{
+	int i;
+
+	printf("#define NSVG_%s_BITS %d\n", prefix, table->bits);
+	printf("#define NSVG_%s_BUCKETS %d\n\n", prefix, table->nbuckets);
+
+	printf("static const unsigned short nsvg__%sDisplace[%d] = {", name, table->nbuckets);
+	for (i = 0; i < table->nbuckets; i += 1) {
+		printf("%s%u,", (i % 12) ? " " : "\n\t", table->displace[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("static const unsigned char nsvg__%sSlots[%d] = {", name, 1 << table->bits);
+	for (i = 0; i < (1 << table->bits); i += 1) {
+		printf("%s%u,", (i % 16) ? " " : "\n\t", table->slots[i]);
+	}
+	printf("\n};\n\n");
+}
+
+// Collects the quoted names from nsvg__colors, including the ones behind
+// NANOSVG_ALL_COLOR_KEYWORDS, in table order
+static int readColors(const char *path, char **colors)
+{
+	char line[1024];
+	int count = 0, inTable = 0;
+	FILE *f = fopen(path, "r");
+	if (f == NULL) {
+		return -1;
+	}
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (!inTable) {
+			inTable = (strstr(line, "nsvg__colors[] = {") != NULL);
+			continue;
+		}
+		if (strncmp(line, "};", 2) == 0) {
+			break;
+		}
+		char *start = strstr(line, "{ \"");
+		if (start != NULL && count < MAX_NAMES) {
+			start += 3;
+			char *end = strchr(start, '"');
+			if (end == NULL) {
+				continue;
+			}
+			*end = '\0';
+			colors[count++] = strdup(start);
+		}
+	}
+	fclose(f);
+	return count;
+}
+
+static void printEnumName(const char *name)
+{
+	printf("\tNSVG_TOKEN_");
+	for (; *name; name += 1) {
+		if (*name == '-' || *name == ':') {
+			putchar('_');
+		} else if (*name >= 'a' && *name <= 'z') {
+			putchar(*name - 'a' + 'A');
+		} else {
+			putchar(*name);
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const int ntokens = sizeof(tokens) / sizeof(tokens[0]);
+	char *colors[MAX_NAMES];
+	Table tokenTable, colorTable;
+	int ncolors, i;
+
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s nanosvg.c > nanosvg_tokens.h\n", argv[0]);
+		return 1;
+	}
+	ncolors = readColors(argv[1], colors);
+	if (ncolors <= 0) {
+		fprintf(stderr, "No nsvg__colors table in %s\n", argv[1]);
+		return 1;
+	}
+	if (!buildTable(&tokenTable, tokens, ntokens)) {
+		fprintf(stderr, "Could not build the token table\n");
+		return 1;
+	}
+	if (!buildTable(&colorTable, (const char**) colors, ncolors)) {
+		fprintf(stderr, "Could not build the color table\n");
+		return 1;
+	}
+
+	printf("// Generated by nanosvg_tokens.c, do not edit! Run `make tokens` instead.\n\n");
+	printf("#ifndef NANOSVG_TOKENS_H\n#define NANOSVG_TOKENS_H\n\n");
+
+	printf("enum NSVGtoken {\n\tNSVG_TOKEN_UNKNOWN,\n");
+	for (i = 0; i < ntokens; i += 1) {
+		printEnumName(tokens[i]);
+		printf(",\n");
+	}
+	printf("\tNSVG_TOKEN_COUNT\n};\n\n");
+
+	printf("static const char* nsvg__tokenNames[NSVG_TOKEN_COUNT] = {\n\t\"\",\n");
+	for (i = 0; i < ntokens; i += 1) {
+		printf("\t\"%s\",\n", tokens[i]);
+	}
+	printf("};\n\n");
+
+	// Token slots hold the token itself, since the enum starts after UNKNOWN
+	printTable(&tokenTable, "TOKEN", "token");
+
+	// Color slots hold the nsvg__colors index + 1
+	printf("#define NSVG_COLOR_NAMES %d\n", ncolors);
+	printTable(&colorTable, "COLOR", "color");
+
+	printf("#endif // NANOSVG_TOKENS_H\n");
+	return 0;
+}
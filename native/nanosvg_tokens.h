@@ -0,0 +1,209 @@
+// Generated by nanosvg_tokens.c, do not edit! Run `make tokens` instead.
+
+#ifndef NANOSVG_TOKENS_H
+#define NANOSVG_TOKENS_H
+
+enum NSVGtoken {
+	NSVG_TOKEN_UNKNOWN,
+	NSVG_TOKEN_CIRCLE,
+	NSVG_TOKEN_DEFS,
+	NSVG_TOKEN_ELLIPSE,
+	NSVG_TOKEN_G,
+	NSVG_TOKEN_LINE,
+	NSVG_TOKEN_LINEARGRADIENT,
+	NSVG_TOKEN_PATH,
+	NSVG_TOKEN_POLYGON,
+	NSVG_TOKEN_POLYLINE,
+	NSVG_TOKEN_RADIALGRADIENT,
+	NSVG_TOKEN_RECT,
+	NSVG_TOKEN_STOP,
+	NSVG_TOKEN_SVG,
+	NSVG_TOKEN_SYMBOL,
+	NSVG_TOKEN_USE,
+	NSVG_TOKEN_DESC,
+	NSVG_TOKEN_FILTER,
+	NSVG_TOKEN_FONT,
+	NSVG_TOKEN_FONT_FACE,
+	NSVG_TOKEN_FOREIGNOBJECT,
+	NSVG_TOKEN_METADATA,
+	NSVG_TOKEN_SCRIPT,
+	NSVG_TOKEN_TITLE,
+	NSVG_TOKEN_CX,
+	NSVG_TOKEN_CY,
+	NSVG_TOKEN_D,
+	NSVG_TOKEN_DISPLAY,
+	NSVG_TOKEN_FILL,
+	NSVG_TOKEN_FILL_OPACITY,
+	NSVG_TOKEN_FILL_RULE,
+	NSVG_TOKEN_FONT_SIZE,
+	NSVG_TOKEN_FX,
+	NSVG_TOKEN_FY,
+	NSVG_TOKEN_GRADIENTTRANSFORM,
+	NSVG_TOKEN_GRADIENTUNITS,
+	NSVG_TOKEN_HEIGHT,
+	NSVG_TOKEN_HREF,
+	NSVG_TOKEN_ID,
+	NSVG_TOKEN_OFFSET,
+	NSVG_TOKEN_OPACITY,
+	NSVG_TOKEN_POINTS,
+	NSVG_TOKEN_PRESERVEASPECTRATIO,
+	NSVG_TOKEN_R,
+	NSVG_TOKEN_RX,
+	NSVG_TOKEN_RY,
+	NSVG_TOKEN_SPREADMETHOD,
+	NSVG_TOKEN_STOP_COLOR,
+	NSVG_TOKEN_STOP_OPACITY,
+	NSVG_TOKEN_STROKE,
+	NSVG_TOKEN_STROKE_DASHARRAY,
+	NSVG_TOKEN_STROKE_DASHOFFSET,
+	NSVG_TOKEN_STROKE_LINECAP,
+	NSVG_TOKEN_STROKE_LINEJOIN,
+	NSVG_TOKEN_STROKE_MITERLIMIT,
+	NSVG_TOKEN_STROKE_OPACITY,
+	NSVG_TOKEN_STROKE_WIDTH,
+	NSVG_TOKEN_STYLE,
+	NSVG_TOKEN_TRANSFORM,
+	NSVG_TOKEN_VIEWBOX,
+	NSVG_TOKEN_WIDTH,
+	NSVG_TOKEN_X,
+	NSVG_TOKEN_X1,
+	NSVG_TOKEN_X2,
+	NSVG_TOKEN_XLINK_HREF,
+	NSVG_TOKEN_Y,
+	NSVG_TOKEN_Y1,
+	NSVG_TOKEN_Y2,
+	NSVG_TOKEN_COUNT
+};
+
+static const char* nsvg__tokenNames[NSVG_TOKEN_COUNT] = {
+	"",
+	"circle",
+	"defs",
+	"ellipse",
+	"g",
+	"line",
+	"linearGradient",
+	"path",
+	"polygon",
+	"polyline",
+	"radialGradient",
+	"rect",
+	"stop",
+	"svg",
+	"symbol",
+	"use",
+	"desc",
+	"filter",
+	"font",
+	"font-face",
+	"foreignObject",
+	"metadata",
+	"script",
+	"title",
+	"cx",
+	"cy",
+	"d",
+	"display",
+	"fill",
+	"fill-opacity",
+	"fill-rule",
+	"font-size",
+	"fx",
+	"fy",
+	"gradientTransform",
+	"gradientUnits",
+	"height",
+	"href",
+	"id",
+	"offset",
+	"opacity",
+	"points",
+	"preserveAspectRatio",
+	"r",
+	"rx",
+	"ry",
+	"spreadMethod",
+	"stop-color",
+	"stop-opacity",
+	"stroke",
+	"stroke-dasharray",
+	"stroke-dashoffset",
+	"stroke-linecap",
+	"stroke-linejoin",
+	"stroke-miterlimit",
+	"stroke-opacity",
+	"stroke-width",
+	"style",
+	"transform",
+	"viewBox",
+	"width",
+	"x",
+	"x1",
+	"x2",
+	"xlink:href",
+	"y",
+	"y1",
+	"y2",
+};
+
+#define NSVG_TOKEN_BITS 7
+#define NSVG_TOKEN_BUCKETS 64
+
+static const unsigned short nsvg__tokenDisplace[64] = {
+	0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 0,
+	0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 6,
+	0, 0, 1, 4, 0, 0, 0, 0, 0, 8, 0, 0,
+	0, 0, 0, 0,
+};
+
+static const unsigned char nsvg__tokenSlots[128] = {
+	0, 19, 56, 0, 63, 52, 14, 0, 0, 0, 0, 0, 42, 0, 0, 27,
+	20, 0, 0, 29, 0, 3, 0, 11, 60, 54, 0, 9, 21, 0, 0, 0,
+	0, 2, 41, 48, 1, 44, 57, 8, 0, 50, 22, 0, 28, 15, 0, 0,
+	0, 0, 16, 61, 0, 0, 36, 0, 12, 25, 0, 39, 6, 0, 0, 7,
+	62, 0, 32, 0, 45, 53, 0, 0, 0, 0, 0, 66, 0, 0, 0, 26,
+	17, 46, 65, 47, 0, 4, 38, 0, 24, 0, 10, 30, 35, 58, 59, 37,
+	0, 0, 0, 51, 0, 0, 0, 40, 0, 0, 0, 0, 43, 0, 0, 34,
+	5, 23, 0, 33, 0, 64, 0, 31, 18, 0, 55, 67, 13, 0, 0, 49,
+};
+
+#define NSVG_COLOR_NAMES 147
+#define NSVG_COLOR_BITS 8
+#define NSVG_COLOR_BUCKETS 128
+
+static const unsigned short nsvg__colorDisplace[128] = {
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 2, 0, 0, 4, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 2, 1, 0, 1, 0, 0,
+	1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 1, 0, 0, 1, 2, 2, 0, 0, 1, 1,
+	0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 3, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 1, 0,
+	2, 0, 1, 0, 0, 0, 1, 12, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 1, 1, 4,
+};
+
+static const unsigned char nsvg__colorSlots[256] = {
+	0, 0, 24, 138, 141, 0, 0, 118, 0, 4, 130, 22, 0, 0, 115, 25,
+	83, 85, 0, 67, 0, 0, 0, 0, 0, 139, 0, 0, 107, 0, 0, 112,
+	100, 74, 0, 23, 56, 0, 52, 117, 0, 0, 0, 0, 127, 63, 62, 0,
+	125, 0, 33, 0, 43, 119, 121, 86, 16, 114, 47, 37, 105, 84, 98, 17,
+	129, 0, 101, 96, 0, 0, 132, 21, 131, 93, 145, 0, 104, 75, 49, 88,
+	0, 0, 50, 122, 66, 0, 15, 120, 0, 0, 113, 0, 57, 0, 3, 0,
+	6, 0, 0, 0, 29, 0, 0, 0, 111, 108, 5, 0, 68, 2, 109, 0,
+	30, 110, 90, 0, 0, 0, 45, 133, 40, 0, 70, 59, 126, 69, 55, 0,
+	123, 48, 36, 0, 31, 26, 18, 0, 8, 140, 0, 0, 0, 0, 34, 51,
+	58, 94, 0, 0, 0, 0, 0, 0, 77, 0, 0, 99, 46, 11, 0, 0,
+	42, 103, 0, 0, 0, 80, 0, 0, 0, 102, 7, 0, 0, 0, 0, 54,
+	73, 64, 44, 72, 136, 0, 0, 0, 27, 135, 0, 0, 82, 146, 39, 91,
+	0, 0, 124, 128, 38, 9, 0, 60, 0, 81, 116, 142, 32, 0, 87, 137,
+	0, 0, 0, 41, 0, 0, 19, 0, 35, 53, 20, 0, 76, 0, 0, 0,
+	143, 14, 0, 61, 144, 0, 0, 0, 0, 95, 89, 97, 0, 0, 0, 65,
+	0, 1, 0, 78, 0, 71, 134, 0, 92, 28, 12, 13, 106, 147, 79, 10,
+};
+
+#endif // NANOSVG_TOKENS_H
@@ -25,8 +25,16 @@
 
 #include "nanovg.h"
 
+#ifdef SVG4FNA_MEMORY_TAG /* SVG4FNA change! */
+#pragma push_macro("SVG4FNA_MEMORY_TAG") /* SVG4FNA change! */
+#undef SVG4FNA_MEMORY_TAG /* SVG4FNA change! */
+#define SVG4FNA_MEMORY_TAG SVG4FNA_MEMORY_FONTATLAS /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
 #define FONTSTASH_IMPLEMENTATION
 #include "fontstash.h"
+#ifdef SVG4FNA_MEMORY_TAG /* SVG4FNA change! */
+#pragma pop_macro("SVG4FNA_MEMORY_TAG") /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
 
 #ifndef NVG_NO_STB
 #define STB_IMAGE_IMPLEMENTATION
@@ -53,6 +61,15 @@
 #define NVG_MAX_STATES 64
 #endif
 
+#ifndef NVG_TICKS /* SVG4FNA change! */
+#define NVG_TICKS() 0ULL /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
+#ifndef NVG_TRACE_BEGIN /* SVG4FNA change! */
+#define NVG_TRACE_BEGIN(name, detail) /* SVG4FNA change! */
+#define NVG_TRACE_END() /* SVG4FNA change! */
+#endif /* SVG4FNA change! */
+
 #define NVG_KAPPA90 0.5522847493f	// Length proportional to radius of a cubic bezier handle for 90deg arcs.
 
 #define NVG_COUNTOF(arr) (sizeof(arr) / sizeof(0[arr]))
@@ -138,6 +155,15 @@ struct NVGcontext {
 	int fillTriCount;
 	int strokeTriCount;
 	int textTriCount;
+	unsigned long long flattenTicks; /* SVG4FNA change! */
+	unsigned long long expandTicks; /* SVG4FNA change! */
+	unsigned long long flushTicks; /* SVG4FNA change! */
+	int cacheUsed[NVG_CACHE_COUNT]; /* SVG4FNA change! */
+	int cacheLastUsed[NVG_CACHE_COUNT]; /* SVG4FNA change! */
+	int cacheReserve[NVG_CACHE_COUNT]; /* SVG4FNA change! */
+	int cacheBelow[NVG_CACHE_COUNT]; /* SVG4FNA change! */
+	int trimFrames; /* SVG4FNA change! */
+	float trimFraction; /* SVG4FNA change! */
 };
 
 static float nvg__sqrtf(float a) { return sqrtf(a); }
@@ -390,6 +416,127 @@ void nvgBeginFrame(NVGcontext* ctx, float windowWidth, float windowHeight, float
 	ctx->fillTriCount = 0;
 	ctx->strokeTriCount = 0;
 	ctx->textTriCount = 0;
+	ctx->flattenTicks = 0; /* SVG4FNA change! */
+	ctx->expandTicks = 0; /* SVG4FNA change! */
+}
+
+void nvgGetStageTicks(NVGcontext* ctx, unsigned long long* flatten, unsigned long long* expand, unsigned long long* flush) /* SVG4FNA change! */
+{
+	if (flatten != NULL) *flatten = ctx->flattenTicks;
+	if (expand != NULL) *expand = ctx->expandTicks;
+	if (flush != NULL) *flush = ctx->flushTicks;
+}
+
+void nvgGetDrawCounts(NVGcontext* ctx, int* drawCalls, int* fillTris, int* strokeTris, int* textTris) /* SVG4FNA change! */
+{
+	if (drawCalls != NULL) *drawCalls = ctx->drawCallCount;
+	if (fillTris != NULL) *fillTris = ctx->fillTriCount;
+	if (strokeTris != NULL) *strokeTris = ctx->strokeTriCount;
+	if (textTris != NULL) *textTris = ctx->textTriCount;
+}
+
+static void nvg__getCacheBuffer(NVGcontext* ctx, int i, void*** data, int** capacity, int* count, int* size, int* minimum) /* SVG4FNA change! */
+{
+	switch (i) {
+	case NVG_CACHE_COMMANDS:
+		*data = (void**)&ctx->commands; *capacity = &ctx->ccommands; *count = ctx->ncommands;
+		*size = sizeof(float); *minimum = NVG_INIT_COMMANDS_SIZE;
+		break;
+	case NVG_CACHE_POINTS:
+		*data = (void**)&ctx->cache->points; *capacity = &ctx->cache->cpoints; *count = ctx->cache->npoints;
+		*size = sizeof(NVGpoint); *minimum = NVG_INIT_POINTS_SIZE;
+		break;
+	case NVG_CACHE_PATHS:
+		*data = (void**)&ctx->cache->paths; *capacity = &ctx->cache->cpaths; *count = ctx->cache->npaths;
+		*size = sizeof(NVGpath); *minimum = NVG_INIT_PATHS_SIZE;
+		break;
+	default:
+		*data = (void**)&ctx->cache->verts; *capacity = &ctx->cache->cverts; *count = ctx->cache->nverts;
+		*size = sizeof(NVGvertex); *minimum = NVG_INIT_VERTS_SIZE;
+		break;
+	}
+}
+
+static int nvg__resizeCacheBuffer(NVGcontext* ctx, int i, int ncapacity) /* SVG4FNA change! */
+{
+	void** data;
+	void* ndata;
+	int* capacity;
+	int count, size, minimum;
+	nvg__getCacheBuffer(ctx, i, &data, &capacity, &count, &size, &minimum);
+	ndata = realloc(*data, (size_t)size*ncapacity);
+	if (ndata == NULL) return 0;
+	*data = ndata;
+	*capacity = ncapacity;
+	return 1;
+}
+
+static void nvg__noteCacheUse(NVGcontext* ctx) /* SVG4FNA change! */
+{
+	ctx->cacheUsed[NVG_CACHE_COMMANDS] = nvg__maxi(ctx->cacheUsed[NVG_CACHE_COMMANDS], ctx->ncommands);
+	ctx->cacheUsed[NVG_CACHE_POINTS] = nvg__maxi(ctx->cacheUsed[NVG_CACHE_POINTS], ctx->cache->npoints);
+	ctx->cacheUsed[NVG_CACHE_PATHS] = nvg__maxi(ctx->cacheUsed[NVG_CACHE_PATHS], ctx->cache->npaths);
+}
+
+static void nvg__trimCache(NVGcontext* ctx) /* SVG4FNA change! */
+{
+	int i;
+	nvg__noteCacheUse(ctx);
+	memcpy(ctx->cacheLastUsed, ctx->cacheUsed, sizeof(ctx->cacheUsed));
+	memset(ctx->cacheUsed, 0, sizeof(ctx->cacheUsed));
+	if (ctx->trimFrames <= 0) return;
+
+	for (i = 0; i < NVG_CACHE_COUNT; i++) {
+		void** data;
+		int* capacity;
+		int count, size, minimum, used, ncapacity;
+		nvg__getCacheBuffer(ctx, i, &data, &capacity, &count, &size, &minimum);
+		used = ctx->cacheLastUsed[i];
+		if (used >= *capacity * ctx->trimFraction) {
+			ctx->cacheBelow[i] = 0;
+			continue;
+		}
+		if (++ctx->cacheBelow[i] < ctx->trimFrames) continue;
+		ctx->cacheBelow[i] = 0;
+		// Keep the 1.5x headroom the buffers grow with, and whatever is still in use
+		ncapacity = nvg__maxi(nvg__maxi(minimum, ctx->cacheReserve[i]), nvg__maxi(used + used/2, count));
+		if (ncapacity < *capacity)
+			nvg__resizeCacheBuffer(ctx, i, ncapacity);
+	}
+}
+
+void nvgGetCacheSizes(NVGcontext* ctx, int* capacity, int* used) /* SVG4FNA change! */
+{
+	int i;
+	for (i = 0; i < NVG_CACHE_COUNT; i++) {
+		void** data;
+		int* c;
+		int count, size, minimum;
+		nvg__getCacheBuffer(ctx, i, &data, &c, &count, &size, &minimum);
+		if (capacity != NULL) capacity[i] = *c;
+		if (used != NULL) used[i] = ctx->cacheLastUsed[i];
+	}
+}
+
+void nvgReserveCache(NVGcontext* ctx, const int* capacity) /* SVG4FNA change! */
+{
+	int i;
+	for (i = 0; i < NVG_CACHE_COUNT; i++) {
+		void** data;
+		int* c;
+		int count, size, minimum;
+		nvg__getCacheBuffer(ctx, i, &data, &c, &count, &size, &minimum);
+		ctx->cacheReserve[i] = nvg__maxi(capacity[i], 0);
+		if (capacity[i] > *c)
+			nvg__resizeCacheBuffer(ctx, i, capacity[i]);
+	}
+}
+
+void nvgSetCacheTrim(NVGcontext* ctx, int frames, float fraction) /* SVG4FNA change! */
+{
+	ctx->trimFrames = nvg__maxi(frames, 0);
+	ctx->trimFraction = nvg__clampf(fraction, 0.0f, 1.0f);
+	memset(ctx->cacheBelow, 0, sizeof(ctx->cacheBelow));
 }
 
 void nvgCancelFrame(NVGcontext* ctx)
@@ -399,7 +546,10 @@ void nvgCancelFrame(NVGcontext* ctx)
 
 void nvgEndFrame(NVGcontext* ctx)
 {
+	unsigned long long start = NVG_TICKS(); /* SVG4FNA change! */
 	ctx->params.renderFlush(ctx->params.userPtr);
+	ctx->flushTicks = NVG_TICKS() - start; /* SVG4FNA change! */
+	nvg__trimCache(ctx); /* SVG4FNA change! */
 	if (ctx->fontImageIdx != 0) {
 		int fontImage = ctx->fontImages[ctx->fontImageIdx];
 		ctx->fontImages[ctx->fontImageIdx] = 0;
@@ -1085,19 +1235,25 @@ static float nvg__distPtSeg(float x, float y, float px, float py, float qx, floa
 	return dx*dx + dy*dy;
 }
 
-static void nvg__appendCommands(NVGcontext* ctx, float* vals, int nvals)
+static int nvg__reserveCommands(NVGcontext* ctx, int nvals) /* SVG4FNA change! */
 {
-	NVGstate* state = nvg__getState(ctx);
-	int i;
-
 	if (ctx->ncommands+nvals > ctx->ccommands) {
 		float* commands;
 		int ccommands = ctx->ncommands+nvals + ctx->ccommands/2;
 		commands = (float*)realloc(ctx->commands, sizeof(float)*ccommands);
-		if (commands == NULL) return;
+		if (commands == NULL) return 0;
 		ctx->commands = commands;
 		ctx->ccommands = ccommands;
 	}
+	return 1;
+}
+
+static void nvg__appendCommands(NVGcontext* ctx, float* vals, int nvals)
+{
+	NVGstate* state = nvg__getState(ctx);
+	int i;
+
+	if (!nvg__reserveCommands(ctx, nvals)) return; /* SVG4FNA change! */
 
 	if ((int)vals[0] != NVG_CLOSE && (int)vals[0] != NVG_WINDING) {
 		ctx->commandx = vals[nvals-2];
@@ -1235,6 +1391,7 @@ static float nvg__getAverageScale(float *t)
 
 static NVGvertex* nvg__allocTempVerts(NVGcontext* ctx, int nverts)
 {
+	ctx->cacheUsed[NVG_CACHE_VERTS] = nvg__maxi(ctx->cacheUsed[NVG_CACHE_VERTS], nverts); /* SVG4FNA change! */
 	if (nverts > ctx->cache->cverts) {
 		NVGvertex* verts;
 		int cverts = (nverts + 0xff) & ~0xff; // Round up to prevent allocations when things change just slightly.
@@ -1431,6 +1588,8 @@ static void nvg__flattenPaths(NVGcontext* ctx)
 			p0 = p1++;
 		}
 	}
+
+	nvg__noteCacheUse(ctx); /* SVG4FNA change! */
 }
 
 static int nvg__curveDivs(float r, float arc, float tol)
@@ -2003,6 +2162,28 @@ void nvgBezierTo(NVGcontext* ctx, float c1x, float c1y, float c2x, float c2y, fl
 	nvg__appendCommands(ctx, vals, NVG_COUNTOF(vals));
 }
 
+void nvgPolyBezierTo(NVGcontext* ctx, const float* pts, int count) /* SVG4FNA change! */
+{
+	NVGstate* state = nvg__getState(ctx);
+	float* cmd;
+	int i;
+
+	if (count <= 0 || !nvg__reserveCommands(ctx, count*7)) return;
+
+	ctx->commandx = pts[count*6-2];
+	ctx->commandy = pts[count*6-1];
+
+	// Transformed straight into the command buffer, as nvg__appendCommands would
+	cmd = &ctx->commands[ctx->ncommands];
+	for (i = 0; i < count; i++, pts += 6, cmd += 7) {
+		cmd[0] = NVG_BEZIERTO;
+		nvgTransformPoint(&cmd[1], &cmd[2], state->xform, pts[0], pts[1]);
+		nvgTransformPoint(&cmd[3], &cmd[4], state->xform, pts[2], pts[3]);
+		nvgTransformPoint(&cmd[5], &cmd[6], state->xform, pts[4], pts[5]);
+	}
+	ctx->ncommands += count*7;
+}
+
 void nvgQuadTo(NVGcontext* ctx, float cx, float cy, float x, float y)
 {
     float x0 = ctx->commandx;
@@ -2243,12 +2424,21 @@ void nvgFill(NVGcontext* ctx)
 	const NVGpath* path;
 	NVGpaint fillPaint = state->fill;
 	int i;
+	unsigned long long start, mid; /* SVG4FNA change! */
 
+	start = NVG_TICKS(); /* SVG4FNA change! */
+	NVG_TRACE_BEGIN("nvg__flattenPaths", NULL); /* SVG4FNA change! */
 	nvg__flattenPaths(ctx);
+	NVG_TRACE_END(); /* SVG4FNA change! */
+	mid = NVG_TICKS(); /* SVG4FNA change! */
+	NVG_TRACE_BEGIN("nvg__expandFill", NULL); /* SVG4FNA change! */
 	if (ctx->params.edgeAntiAlias && state->shapeAntiAlias)
 		nvg__expandFill(ctx, ctx->fringeWidth, NVG_MITER, 2.4f);
 	else
 		nvg__expandFill(ctx, 0.0f, NVG_MITER, 2.4f);
+	NVG_TRACE_END(); /* SVG4FNA change! */
+	ctx->flattenTicks += mid - start; /* SVG4FNA change! */
+	ctx->expandTicks += NVG_TICKS() - mid; /* SVG4FNA change! */
 
 	// Apply global alpha
 	fillPaint.innerColor.a *= state->alpha;
@@ -2274,6 +2464,7 @@ void nvgStroke(NVGcontext* ctx)
 	NVGpaint strokePaint = state->stroke;
 	const NVGpath* path;
 	int i;
+	unsigned long long start, mid; /* SVG4FNA change! */
 
 
 	if (strokeWidth < ctx->fringeWidth) {
@@ -2289,12 +2480,20 @@ void nvgStroke(NVGcontext* ctx)
 	strokePaint.innerColor.a *= state->alpha;
 	strokePaint.outerColor.a *= state->alpha;
 
+	start = NVG_TICKS(); /* SVG4FNA change! */
+	NVG_TRACE_BEGIN("nvg__flattenPaths", NULL); /* SVG4FNA change! */
 	nvg__flattenPaths(ctx);
+	NVG_TRACE_END(); /* SVG4FNA change! */
+	mid = NVG_TICKS(); /* SVG4FNA change! */
 
+	NVG_TRACE_BEGIN("nvg__expandStroke", NULL); /* SVG4FNA change! */
 	if (ctx->params.edgeAntiAlias && state->shapeAntiAlias)
 		nvg__expandStroke(ctx, strokeWidth*0.5f, ctx->fringeWidth, state->lineCap, state->lineJoin, state->miterLimit);
 	else
 		nvg__expandStroke(ctx, strokeWidth*0.5f, 0.0f, state->lineCap, state->lineJoin, state->miterLimit);
+	NVG_TRACE_END(); /* SVG4FNA change! */
+	ctx->flattenTicks += mid - start; /* SVG4FNA change! */
+	ctx->expandTicks += NVG_TICKS() - mid; /* SVG4FNA change! */
 
 	ctx->params.renderStroke(ctx->params.userPtr, &strokePaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
 							 strokeWidth, ctx->cache->paths, ctx->cache->npaths);
@@ -2470,6 +2669,42 @@ static void nvg__renderText(NVGcontext* ctx, NVGvertex* verts, int nverts)
 	ctx->textTriCount += nverts/3;
 }
 
+void nvgImageQuad(NVGcontext* ctx, int image, float sx, float sy, float sw, float sh, float dx, float dy, float dw, float dh, float alpha) /* SVG4FNA change! */
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint;
+	NVGvertex* verts;
+	float x[4], y[4];
+	float u0, v0, u1, v1;
+	int iw, ih;
+
+	if (ctx->params.renderGetTextureSize(ctx->params.userPtr, image, &iw, &ih) == 0) return;
+	u0 = sx / iw;
+	v0 = sy / ih;
+	u1 = (sx + sw) / iw;
+	v1 = (sy + sh) / ih;
+
+	verts = nvg__allocTempVerts(ctx, 6);
+	if (verts == NULL) return;
+
+	nvgTransformPoint(&x[0], &y[0], state->xform, dx, dy);
+	nvgTransformPoint(&x[1], &y[1], state->xform, dx + dw, dy);
+	nvgTransformPoint(&x[2], &y[2], state->xform, dx + dw, dy + dh);
+	nvgTransformPoint(&x[3], &y[3], state->xform, dx, dy + dh);
+	nvg__vset(&verts[0], x[0], y[0], u0, v0);
+	nvg__vset(&verts[1], x[2], y[2], u1, v1);
+	nvg__vset(&verts[2], x[1], y[1], u1, v0);
+	nvg__vset(&verts[3], x[0], y[0], u0, v0);
+	nvg__vset(&verts[4], x[3], y[3], u0, v1);
+	nvg__vset(&verts[5], x[2], y[2], u1, v1);
+
+	paint = nvgImagePattern(ctx, 0, 0, (float) iw, (float) ih, 0, image, alpha * state->alpha);
+	ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, verts, 6, ctx->fringeWidth);
+
+	ctx->drawCallCount++;
+	ctx->fillTriCount += 2;
+}
+
 static int nvg__isTransformFlipped(const float *xform)
 {
 	float det = xform[0] * xform[3] - xform[2] * xform[1];
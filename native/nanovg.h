@@ -167,6 +167,34 @@ void nvgCancelFrame(NVGcontext* ctx);
 // Ends drawing flushing remaining render state.
 NVGAPI void nvgEndFrame(NVGcontext* ctx); /* SVG4FNA change! */
 
+// Returns the time spent since nvgBeginFrame() flattening and expanding paths,
+// and in the last nvgEndFrame() flushing the renderer, in NVG_TICKS() units.
+// NVG_TICKS() is 0 unless the implementation defines it.
+NVGAPI void nvgGetStageTicks(NVGcontext* ctx, unsigned long long* flatten, unsigned long long* expand, unsigned long long* flush); /* SVG4FNA change! */
+
+// Returns the draw call and triangle counts since nvgBeginFrame().
+NVGAPI void nvgGetDrawCounts(NVGcontext* ctx, int* drawCalls, int* fillTris, int* strokeTris, int* textTris); /* SVG4FNA change! */
+
+// Command buffer and path cache sizes, in elements, for the arrays below. /* SVG4FNA change! */
+enum NVGcacheBuffer { /* SVG4FNA change! */
+	NVG_CACHE_COMMANDS, /* SVG4FNA change! */
+	NVG_CACHE_POINTS, /* SVG4FNA change! */
+	NVG_CACHE_PATHS, /* SVG4FNA change! */
+	NVG_CACHE_VERTS, /* SVG4FNA change! */
+	NVG_CACHE_COUNT /* SVG4FNA change! */
+}; /* SVG4FNA change! */
+
+// Returns the capacity of each buffer, and the most of it used between the last /* SVG4FNA change! */
+// nvgBeginFrame() and nvgEndFrame(). /* SVG4FNA change! */
+NVGAPI void nvgGetCacheSizes(NVGcontext* ctx, int* capacity, int* used); /* SVG4FNA change! */
+
+// Grows each buffer to at least capacity[i], trimming never goes below it. /* SVG4FNA change! */
+NVGAPI void nvgReserveCache(NVGcontext* ctx, const int* capacity); /* SVG4FNA change! */
+
+// Shrinks a buffer in nvgEndFrame() once it has used less than fraction of its /* SVG4FNA change! */
+// capacity for frames frames in a row. frames = 0 never shrinks, the default. /* SVG4FNA change! */
+NVGAPI void nvgSetCacheTrim(NVGcontext* ctx, int frames, float fraction); /* SVG4FNA change! */
+
 //
 // Composite operation
 //
@@ -397,6 +425,11 @@ void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h);
 // Deletes created image.
 void nvgDeleteImage(NVGcontext* ctx, int image);
 
+// Draws the rectangle (sx,sy,sw,sh) of the image, in pixels, into the rectangle (dx,dy,dw,dh)
+// as two textured triangles, counted as fill triangles. No path is tessellated, the current
+// transform, scissor and composite operation still apply.
+NVGAPI void nvgImageQuad(NVGcontext* ctx, int image, float sx, float sy, float sw, float sh, float dx, float dy, float dw, float dh, float alpha); /* SVG4FNA change! */
+
 //
 // Paints
 //
@@ -479,6 +512,10 @@ void nvgLineTo(NVGcontext* ctx, float x, float y);
 // Adds cubic bezier segment from last point in the path via two control points to the specified point.
 void nvgBezierTo(NVGcontext* ctx, float c1x, float c1y, float c2x, float c2y, float x, float y);
 
+// Adds count cubic bezier segments at once, like count nvgBezierTo calls. /* SVG4FNA change! */
+// pts holds c1x,c1y,c2x,c2y,x,y for each segment. /* SVG4FNA change! */
+void nvgPolyBezierTo(NVGcontext* ctx, const float* pts, int count); /* SVG4FNA change! */
+
 // Adds quadratic bezier segment from last point in the path via a control point to the specified point.
 void nvgQuadTo(NVGcontext* ctx, float cx, float cy, float x, float y);
 
@@ -1,19 +1,33 @@
 #include "nanovg_gpu.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 // Mostly based on gl2 renderer
 
+#ifndef NVG_TICKS_FREQUENCY
+#define NVG_TICKS_FREQUENCY() 1ULL
+#endif
+
+#ifndef NVG_TRACE_BEGIN
+#define NVG_TRACE_BEGIN(name, detail)
+#define NVG_TRACE_END()
+#endif
+
 typedef enum
 {
 	RENDERTYPE_NONE,
 	RENDERTYPE_FILL,
 	RENDERTYPE_CONVEXFILL,
 	RENDERTYPE_STROKE,
-	RENDERTYPE_TRIANGLES
+	RENDERTYPE_TRIANGLES,
+	RENDERTYPE_GEOMETRY,
+	RENDERTYPE_TARGET
 } RenderType;
 
 typedef enum
@@ -55,6 +69,10 @@ typedef struct RenderDrawCall
 	int triangleCount;
 	int uniformOffset;
 	NVGcompositeOperationState blendOp;
+	int geometry;
+	int callOffset;
+	int callCount;
+	float xform[6];
 } RenderDrawCall;
 
 typedef struct RenderPath
@@ -74,8 +92,44 @@ typedef struct RenderTexture
 	int flags;
 	int width;
 	int height;
+	int target; // Created by nvgGpuCreateRenderTarget
 } RenderTexture;
 
+#define NVG_MAX_GEOMETRIES 128 // FIXME: 128 is arbitrary!
+
+typedef struct RenderGeometry
+{
+	void* vertexBuffer;
+	size_t vertexBufferSize;
+	RenderDrawCall *calls;
+	int ncalls;
+	RenderPath *paths;
+	int npaths;
+	unsigned char *uniforms;
+	int nuniforms;
+	int deleted; // Freed once the frame that may still draw it is flushed
+} RenderGeometry;
+
+typedef enum
+{
+	RENDERRECORD_NONE,
+	RENDERRECORD_GEOMETRY,
+	RENDERRECORD_INSTANCES
+} RenderRecord;
+
+typedef struct RenderCapture RenderCapture;
+
+// Per frame buffers, see nvgGpuSetTrimPolicy
+typedef enum
+{
+	RENDERBUFFER_CALLS,
+	RENDERBUFFER_PATHS,
+	RENDERBUFFER_VERTS,
+	RENDERBUFFER_UNIFORMS,
+	RENDERBUFFER_INSTANCECALLS,
+	RENDERBUFFER_COUNT
+} RenderBuffer;
+
 typedef struct RenderContext
 {
 	NVGcreateFlags flags;
@@ -94,6 +148,7 @@ typedef struct RenderContext
 	nvg_gpu_pfn_updateShader updateShader;
 	nvg_gpu_pfn_updateSampler updateSampler;
 	nvg_gpu_pfn_setViewport setViewport;
+	nvg_gpu_pfn_updateVertexTransform updateVertexTransform;
 	nvg_gpu_pfn_resetState resetState;
 	nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask;
 	nvg_gpu_pfn_updateBlendFunction updateBlendFunction;
@@ -102,11 +157,26 @@ typedef struct RenderContext
 	nvg_gpu_pfn_toggleCullMode toggleCullMode;
 	nvg_gpu_pfn_applyState applyState;
 	nvg_gpu_pfn_drawPrimitives drawPrimitives;
+	nvg_gpu_pfn_createRenderTarget createRenderTarget;
+	nvg_gpu_pfn_setRenderTarget setRenderTarget;
+
+	// Viewport of the default render target
+	float viewWidth;
+	float viewHeight;
+	int renderTarget;
 
 	// GPU resources
 	void* vertexBuffer;
 	size_t vertexBufferSize;
 	RenderTexture textures[NVG_MAX_TEXTURES];
+	RenderGeometry geometries[NVG_MAX_GEOMETRIES];
+
+	// Static geometry and instance recording, see nvgGpuBeginGeometry
+	RenderRecord recording;
+	int recordCalls;
+	int recordPaths;
+	int recordVerts;
+	int recordUniforms;
 
 	// Per frame buffers
 	RenderDrawCall *calls;
@@ -122,10 +192,127 @@ typedef struct RenderContext
 	int cuniforms;
 	int nuniforms;
 	int fragSize;
+	RenderDrawCall *instanceCalls;
+	int cinstanceCalls;
+	int ninstanceCalls;
+
+	// Buffer trimming and reservation, see nvgGpuSetTrimPolicy
+	int trimFrames;
+	float trimFraction;
+	int bufferReserve[RENDERBUFFER_COUNT];
+	int bufferUsed[RENDERBUFFER_COUNT];
+	int bufferLastUsed[RENDERBUFFER_COUNT];
+	int bufferBelow[RENDERBUFFER_COUNT];
+
+	// Callback capture, see nvgGpuBeginCapture
+	RenderCapture *capture;
+
+	// Renderer counts for the frame being built and the last flushed one
+	NVGframeStats frameStats;
+	NVGframeStats lastFrameStats;
 } RenderContext;
 
+// Callback capture file format, see nvgGpuBeginCapture
+
+#define CAPTURE_MAGIC "NVGCAP"
+#define CAPTURE_VERSION 1
+
+typedef enum
+{
+	CAPTURE_CREATEVERTEXBUFFER,
+	CAPTURE_DELETEVERTEXBUFFER,
+	CAPTURE_UPDATEVERTEXBUFFER,
+	CAPTURE_CREATETEXTURE,
+	CAPTURE_DELETETEXTURE,
+	CAPTURE_UPDATETEXTURE,
+	CAPTURE_UPDATEUNIFORMBUFFER,
+	CAPTURE_UPDATESHADER,
+	CAPTURE_UPDATESAMPLER,
+	CAPTURE_SETVIEWPORT,
+	CAPTURE_UPDATEVERTEXTRANSFORM,
+	CAPTURE_RESETSTATE,
+	CAPTURE_TOGGLECOLORWRITEMASK,
+	CAPTURE_UPDATEBLENDFUNCTION,
+	CAPTURE_TOGGLESTENCIL,
+	CAPTURE_UPDATESTENCILFUNCTION,
+	CAPTURE_TOGGLECULLMODE,
+	CAPTURE_APPLYSTATE,
+	CAPTURE_DRAWPRIMITIVES,
+	CAPTURE_CREATERENDERTARGET,
+	CAPTURE_SETRENDERTARGET,
+	CAPTURE_ENDFRAME,
+	CAPTURE_COUNT
+} RenderCaptureOp;
+
+// The backend callbacks that get wrapped while capturing
+typedef struct RenderBackend
+{
+	void *userdata;
+	nvg_gpu_pfn_createVertexBuffer createVertexBuffer;
+	nvg_gpu_pfn_deleteVertexBuffer deleteVertexBuffer;
+	nvg_gpu_pfn_updateVertexBuffer updateVertexBuffer;
+	nvg_gpu_pfn_createTexture createTexture;
+	nvg_gpu_pfn_deleteTexture deleteTexture;
+	nvg_gpu_pfn_updateTexture updateTexture;
+	nvg_gpu_pfn_updateUniformBuffer updateUniformBuffer;
+	nvg_gpu_pfn_updateShader updateShader;
+	nvg_gpu_pfn_updateSampler updateSampler;
+	nvg_gpu_pfn_setViewport setViewport;
+	nvg_gpu_pfn_updateVertexTransform updateVertexTransform;
+	nvg_gpu_pfn_resetState resetState;
+	nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask;
+	nvg_gpu_pfn_updateBlendFunction updateBlendFunction;
+	nvg_gpu_pfn_toggleStencil toggleStencil;
+	nvg_gpu_pfn_updateStencilFunction updateStencilFunction;
+	nvg_gpu_pfn_toggleCullMode toggleCullMode;
+	nvg_gpu_pfn_applyState applyState;
+	nvg_gpu_pfn_drawPrimitives drawPrimitives;
+	nvg_gpu_pfn_createRenderTarget createRenderTarget;
+	nvg_gpu_pfn_setRenderTarget setRenderTarget;
+} RenderBackend;
+
+struct RenderCapture
+{
+	FILE *file;
+	RenderContext *gl;
+	RenderBackend backend;
+};
+
+/* Each record is an op and a payload length, both 32-bit ints, followed by
+ * the payload: the integer arguments as 64-bit ints (resource handles are
+ * captured by value), then float arguments, then any data blob.
+ */
+static void INTERNAL_captureWrite(
+	RenderCapture *cap,
+	RenderCaptureOp op,
+	const void *args,
+	size_t argsLength,
+	const void *blob,
+	size_t blobLength
+) {
+	int header[2];
+	header[0] = op;
+	header[1] = (int) (argsLength + blobLength);
+	fwrite(header, sizeof(header), 1, cap->file);
+	if (argsLength > 0) {
+		fwrite(args, argsLength, 1, cap->file);
+	}
+	if (blobLength > 0) {
+		fwrite(blob, blobLength, 1, cap->file);
+	}
+}
+
+static inline long long INTERNAL_captureHandle(void *handle)
+{
+	return (long long) (size_t) handle;
+}
+
+static void INTERNAL_endCapture(RenderContext *gl);
+
 #define INTERNAL_maxi(x, y) (((x) > (y)) ? (x) : (y))
 
+static float INTERNAL_identity[6] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
 static RenderDrawCall* INTERNAL_allocCall(RenderContext *gl)
 {
 	RenderDrawCall *ret = NULL;
@@ -143,6 +330,23 @@ static RenderDrawCall* INTERNAL_allocCall(RenderContext *gl)
 	return ret;
 }
 
+static int INTERNAL_allocInstanceCalls(RenderContext *gl, int n)
+{
+	int ret = 0;
+	if ((gl->ninstanceCalls + n) > gl->cinstanceCalls)
+	{
+		RenderDrawCall *calls;
+		int ccalls = INTERNAL_maxi(gl->ninstanceCalls + n, 128) + gl->cinstanceCalls / 2; // 1.5x Overallocate
+		calls = (RenderDrawCall*) realloc(gl->instanceCalls, sizeof(RenderDrawCall) * ccalls);
+		if (calls == NULL) return -1;
+		gl->instanceCalls = calls;
+		gl->cinstanceCalls = ccalls;
+	}
+	ret = gl->ninstanceCalls;
+	gl->ninstanceCalls += n;
+	return ret;
+}
+
 static int INTERNAL_allocPaths(RenderContext *gl, int n)
 {
 	int ret = 0;
@@ -205,15 +409,157 @@ static int INTERNAL_allocFragUniforms(RenderContext* gl, int n)
 	return ret;
 }
 
+static void INTERNAL_getBuffer(
+	RenderContext *gl,
+	RenderBuffer buffer,
+	void ***data,
+	int **capacity,
+	int *count,
+	size_t *size,
+	int *minimum
+) {
+	// Minimums match the first allocation of each buffer
+	switch (buffer)
+	{
+	case RENDERBUFFER_CALLS:
+		*data = (void**) &gl->calls;
+		*capacity = &gl->ccalls;
+		*count = gl->ncalls;
+		*size = sizeof(RenderDrawCall);
+		*minimum = 128;
+		break;
+	case RENDERBUFFER_PATHS:
+		*data = (void**) &gl->paths;
+		*capacity = &gl->cpaths;
+		*count = gl->npaths;
+		*size = sizeof(RenderPath);
+		*minimum = 128;
+		break;
+	case RENDERBUFFER_VERTS:
+		*data = (void**) &gl->verts;
+		*capacity = &gl->cverts;
+		*count = gl->nverts;
+		*size = sizeof(NVGvertex);
+		*minimum = 4096;
+		break;
+	case RENDERBUFFER_UNIFORMS:
+		*data = (void**) &gl->uniforms;
+		*capacity = &gl->cuniforms;
+		*count = gl->nuniforms;
+		*size = gl->fragSize;
+		*minimum = 128;
+		break;
+	default:
+		*data = (void**) &gl->instanceCalls;
+		*capacity = &gl->cinstanceCalls;
+		*count = gl->ninstanceCalls;
+		*size = sizeof(RenderDrawCall);
+		*minimum = 128;
+		break;
+	}
+}
+
+static int INTERNAL_resizeBuffer(RenderContext *gl, RenderBuffer buffer, int capacity)
+{
+	void **data;
+	void *resized;
+	int *oldCapacity, count, minimum;
+	size_t size;
+
+	INTERNAL_getBuffer(gl, buffer, &data, &oldCapacity, &count, &size, &minimum);
+	resized = realloc(*data, size * capacity);
+	if (resized == NULL) {
+		return 0;
+	}
+	*data = resized;
+	*oldCapacity = capacity;
+	return 1;
+}
+
+/* Recording rolls the buffers back mid-frame, so the high-water mark is
+ * taken before each rollback as well as at the flush.
+ */
+static void INTERNAL_noteBufferUse(RenderContext *gl)
+{
+	gl->bufferUsed[RENDERBUFFER_CALLS] = INTERNAL_maxi(gl->bufferUsed[RENDERBUFFER_CALLS], gl->ncalls);
+	gl->bufferUsed[RENDERBUFFER_PATHS] = INTERNAL_maxi(gl->bufferUsed[RENDERBUFFER_PATHS], gl->npaths);
+	gl->bufferUsed[RENDERBUFFER_VERTS] = INTERNAL_maxi(gl->bufferUsed[RENDERBUFFER_VERTS], gl->nverts);
+	gl->bufferUsed[RENDERBUFFER_UNIFORMS] = INTERNAL_maxi(gl->bufferUsed[RENDERBUFFER_UNIFORMS], gl->nuniforms);
+	gl->bufferUsed[RENDERBUFFER_INSTANCECALLS] = INTERNAL_maxi(gl->bufferUsed[RENDERBUFFER_INSTANCECALLS], gl->ninstanceCalls);
+}
+
+static void INTERNAL_trimBuffers(RenderContext *gl)
+{
+	INTERNAL_noteBufferUse(gl);
+	memcpy(gl->bufferLastUsed, gl->bufferUsed, sizeof(gl->bufferUsed));
+	memset(gl->bufferUsed, '\0', sizeof(gl->bufferUsed));
+
+	// Recorded geometry still lives in the buffers until EndGeometry
+	if (gl->trimFrames <= 0 || gl->recording != RENDERRECORD_NONE) {
+		return;
+	}
+
+	for (int i = 0; i < RENDERBUFFER_COUNT; i += 1) {
+		void **data;
+		int *capacity, count, minimum, used, trimmed;
+		size_t size;
+
+		INTERNAL_getBuffer(gl, (RenderBuffer) i, &data, &capacity, &count, &size, &minimum);
+		used = gl->bufferLastUsed[i];
+		if (*capacity == 0 || used >= *capacity * gl->trimFraction) {
+			gl->bufferBelow[i] = 0;
+			continue;
+		}
+		gl->bufferBelow[i] += 1;
+		if (gl->bufferBelow[i] < gl->trimFrames) {
+			continue;
+		}
+		gl->bufferBelow[i] = 0;
+
+		// Leave the same 1.5x headroom the buffers grow with
+		trimmed = INTERNAL_maxi(used + used / 2, INTERNAL_maxi(minimum, gl->bufferReserve[i]));
+		if (trimmed >= *capacity || !INTERNAL_resizeBuffer(gl, (RenderBuffer) i, trimmed)) {
+			continue;
+		}
+
+		// The GPU vertex buffer is recreated at the next flush to match
+		if (	i == RENDERBUFFER_VERTS &&
+			gl->vertexBuffer != NULL &&
+			gl->vertexBufferSize > trimmed * sizeof(NVGvertex)	)
+		{
+			gl->deleteVertexBuffer(gl->userdata, gl->vertexBuffer);
+			gl->vertexBuffer = NULL;
+			gl->vertexBufferSize = 0;
+		}
+	}
+}
+
+// Image handles are the texture slot + 1, nanovg treats 0 as "no image"
 static RenderTexture* INTERNAL_findTexture(RenderContext *gl, int id)
 {
-	if (id < 0 || id >= NVG_MAX_TEXTURES) {
+	if (id < 1 || id > NVG_MAX_TEXTURES) {
 		return NULL;
 	}
-	if (gl->textures[id].userdata == NULL) {
+	if (gl->textures[id - 1].userdata == NULL) {
 		return NULL;
 	}
-	return &gl->textures[id];
+	return &gl->textures[id - 1];
+}
+
+static int INTERNAL_allocTexture(RenderContext *gl)
+{
+	for (int i = 0; i < NVG_MAX_TEXTURES; i += 1) {
+		if (gl->textures[i].userdata == NULL) {
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+static inline void INTERNAL_drawPrimitives(RenderContext *gl, int triStrip, int vertexOffset, int vertexCount)
+{
+	gl->frameStats.backendDrawCalls += 1;
+	gl->drawPrimitives(gl->userdata, triStrip, vertexOffset, vertexCount);
 }
 
 static inline RenderUniforms* INTERNAL_fragUniformPtr(RenderContext* gl, int i)
@@ -227,6 +573,7 @@ static void INTERNAL_setUniforms(RenderContext *gl, int uniformOffset, int image
 	RenderUniforms *frag = INTERNAL_fragUniformPtr(gl, uniformOffset);
 
 	gl->updateUniformBuffer(gl->userdata, frag->uniformArray, sizeof(frag->uniformArray));
+	gl->frameStats.uniformBytesUploaded += sizeof(frag->uniformArray);
 
 	gl->updateShader(
 		gl->userdata,
@@ -370,9 +717,10 @@ static void INTERNAL_fill(RenderContext *gl, RenderDrawCall *call)
 
 	gl->applyState(gl->userdata, gl->vertexBuffer);
 
+	gl->frameStats.stencilPasses += npaths;
 	for (i = 0; i < npaths; i++)
-		gl->drawPrimitives(
-			gl->userdata,
+		INTERNAL_drawPrimitives(
+			gl,
 			0,
 			paths[i].fillOffset,
 			paths[i].fillCount
@@ -400,8 +748,8 @@ static void INTERNAL_fill(RenderContext *gl, RenderDrawCall *call)
 
 		// Draw fringes
 		for (i = 0; i < npaths; i++)
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -421,8 +769,8 @@ static void INTERNAL_fill(RenderContext *gl, RenderDrawCall *call)
 	);
 	gl->applyState(gl->userdata, gl->vertexBuffer);
 
-	gl->drawPrimitives(
-		gl->userdata,
+	INTERNAL_drawPrimitives(
+		gl,
 		1,
 		call->triangleOffset,
 		call->triangleCount
@@ -440,8 +788,8 @@ static void INTERNAL_convexFill(RenderContext *gl, RenderDrawCall *call)
 
 	gl->applyState(gl->userdata, gl->vertexBuffer);
 	for (i = 0; i < npaths; i++) {
-		gl->drawPrimitives(
-			gl->userdata,
+		INTERNAL_drawPrimitives(
+			gl,
 			0,
 			paths[i].fillOffset,
 			paths[i].fillCount
@@ -449,8 +797,8 @@ static void INTERNAL_convexFill(RenderContext *gl, RenderDrawCall *call)
 
 		// Draw fringes
 		if (paths[i].strokeCount > 0) {
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -483,8 +831,8 @@ static void INTERNAL_stroke(RenderContext *gl, RenderDrawCall *call)
 		gl->applyState(gl->userdata, gl->vertexBuffer);
 
 		for (i = 0; i < npaths; i++)
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -504,8 +852,8 @@ static void INTERNAL_stroke(RenderContext *gl, RenderDrawCall *call)
 		);
 		gl->applyState(gl->userdata, gl->vertexBuffer);
 		for (i = 0; i < npaths; i++)
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -524,9 +872,10 @@ static void INTERNAL_stroke(RenderContext *gl, RenderDrawCall *call)
 			NVG_STENCILOPERATION_ZERO
 		);
 		gl->applyState(gl->userdata, gl->vertexBuffer);
+		gl->frameStats.stencilPasses += npaths;
 		for (i = 0; i < npaths; i++)
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -540,8 +889,8 @@ static void INTERNAL_stroke(RenderContext *gl, RenderDrawCall *call)
 
 		// Draw Strokes
 		for (i = 0; i < npaths; i++)
-			gl->drawPrimitives(
-				gl->userdata,
+			INTERNAL_drawPrimitives(
+				gl,
 				1,
 				paths[i].strokeOffset,
 				paths[i].strokeCount
@@ -553,7 +902,113 @@ static void INTERNAL_triangles(RenderContext *gl, RenderDrawCall *call)
 {
 	INTERNAL_setUniforms(gl, call->uniformOffset, call->image);
 
-	gl->drawPrimitives(gl->userdata, 0, call->triangleOffset, call->triangleCount);
+	gl->applyState(gl->userdata, gl->vertexBuffer);
+	INTERNAL_drawPrimitives(gl, 0, call->triangleOffset, call->triangleCount);
+}
+
+static void INTERNAL_target(RenderContext *gl, RenderDrawCall *call)
+{
+	RenderTexture *tex = INTERNAL_findTexture(gl, call->image);
+
+	if (tex != NULL) {
+		gl->setRenderTarget(gl->userdata, tex->userdata);
+		gl->setViewport(gl->userdata, (float) tex->width, (float) tex->height);
+		gl->renderTarget = call->image;
+	} else {
+		gl->setRenderTarget(gl->userdata, NULL);
+		gl->setViewport(gl->userdata, gl->viewWidth, gl->viewHeight);
+		gl->renderTarget = 0;
+	}
+}
+
+static void INTERNAL_geometry(RenderContext *gl, RenderDrawCall *call);
+
+static void INTERNAL_renderCall(RenderContext *gl, RenderDrawCall *call)
+{
+	if (call->type == RENDERTYPE_GEOMETRY) {
+		// Each recorded call sets its own blend state
+		gl->frameStats.geometryCalls += 1;
+		INTERNAL_geometry(gl, call);
+		return;
+	}
+	if (call->type == RENDERTYPE_TARGET) {
+		gl->frameStats.targetCalls += 1;
+		INTERNAL_target(gl, call);
+		return;
+	}
+
+	gl->updateBlendFunction(gl->userdata, call->blendOp);
+
+	if (call->type == RENDERTYPE_FILL) {
+		gl->frameStats.fillCalls += 1;
+		INTERNAL_fill(gl, call);
+	} else if (call->type == RENDERTYPE_CONVEXFILL) {
+		gl->frameStats.convexFillCalls += 1;
+		INTERNAL_convexFill(gl, call);
+	} else if (call->type == RENDERTYPE_STROKE) {
+		gl->frameStats.strokeCalls += 1;
+		INTERNAL_stroke(gl, call);
+	} else if (call->type == RENDERTYPE_TRIANGLES) {
+		gl->frameStats.triangleCalls += 1;
+		INTERNAL_triangles(gl, call);
+	}
+}
+
+static void INTERNAL_geometry(RenderContext *gl, RenderDrawCall *call)
+{
+	RenderGeometry *geom;
+	RenderPath *paths = gl->paths;
+	unsigned char *uniforms = gl->uniforms;
+	void *vertexBuffer = gl->vertexBuffer;
+	int i;
+
+	if (call->geometry == 0) {
+		// Instances recorded this frame live in the frame's arrays
+		gl->updateVertexTransform(gl->userdata, call->xform);
+		for (i = 0; i < call->callCount; i += 1) {
+			INTERNAL_renderCall(gl, &gl->instanceCalls[call->callOffset + i]);
+		}
+		gl->updateVertexTransform(gl->userdata, INTERNAL_identity);
+		return;
+	}
+
+	geom = &gl->geometries[call->geometry - 1];
+	if (geom->vertexBuffer == NULL) {
+		return;
+	}
+
+	// Recorded calls index into the geometry's arrays, swap them in
+	gl->paths = geom->paths;
+	gl->uniforms = geom->uniforms;
+	gl->vertexBuffer = geom->vertexBuffer;
+
+	gl->updateVertexTransform(gl->userdata, call->xform);
+	for (i = 0; i < geom->ncalls; i += 1) {
+		INTERNAL_renderCall(gl, &geom->calls[i]);
+	}
+	gl->updateVertexTransform(gl->userdata, INTERNAL_identity);
+
+	gl->paths = paths;
+	gl->uniforms = uniforms;
+	gl->vertexBuffer = vertexBuffer;
+}
+
+static void INTERNAL_freeGeometry(RenderContext *gl, RenderGeometry *geom)
+{
+	gl->deleteVertexBuffer(gl->userdata, geom->vertexBuffer);
+	free(geom->calls);
+	free(geom->paths);
+	free(geom->uniforms);
+	memset(geom, '\0', sizeof(RenderGeometry));
+}
+
+static void INTERNAL_freeDeletedGeometry(RenderContext *gl)
+{
+	for (int i = 0; i < NVG_MAX_GEOMETRIES; i += 1) {
+		if (gl->geometries[i].deleted) {
+			INTERNAL_freeGeometry(gl, &gl->geometries[i]);
+		}
+	}
 }
 
 // GPU implementation of NVGcontext
@@ -581,21 +1036,17 @@ static int nvg_gpu_renderCreateTexture(
 
 	assert(!(imageFlags & NVG_IMAGE_GENERATE_MIPMAPS)); // Unsupported
 
-	RenderTexture *dst = NULL;
-	for (int i = 0; i < NVG_MAX_TEXTURES; i += 1) {
-		if (ctx->textures[i].userdata == NULL) {
-			dst = &ctx->textures[i];
-			break;
-		}
-	}
-	if (dst == NULL) {
+	int id = INTERNAL_allocTexture(ctx);
+	if (id == 0) {
 		return 0;
 	}
+	RenderTexture *dst = &ctx->textures[id - 1];
 
 	dst->type = type;
 	dst->flags = imageFlags;
 	dst->width = w;
 	dst->height = h;
+	dst->target = 0;
 	dst->userdata = ctx->createTexture(
 		ctx->userdata,
 		(type == NVG_TEXTURE_RGBA),
@@ -607,6 +1058,7 @@ static int nvg_gpu_renderCreateTexture(
 	);
 	if (data != NULL)
 	{
+		ctx->frameStats.textureBytesUploaded += w * h * ((type == NVG_TEXTURE_RGBA) ? 4 : 1);
 		ctx->updateTexture(
 			ctx->userdata,
 			dst->userdata,
@@ -618,23 +1070,19 @@ static int nvg_gpu_renderCreateTexture(
 		);
 	}
 
-	return 1;
+	return id;
 }
 
 static int nvg_gpu_renderDeleteTexture(void* uptr, int image) {
 	RenderContext *ctx = (RenderContext*) uptr;
 
-	if (image < 0 || image >= NVG_MAX_TEXTURES) {
-		return 0;
-	}
-
-	void *userdata = ctx->textures[image].userdata;
-	if (userdata == NULL) {
+	RenderTexture *tex = INTERNAL_findTexture(ctx, image);
+	if (tex == NULL) {
 		return 0;
 	}
 
-	ctx->deleteTexture(ctx->userdata, userdata);
-	ctx->textures[image].userdata = NULL;
+	ctx->deleteTexture(ctx->userdata, tex->userdata);
+	tex->userdata = NULL;
 	return 1;
 }
 
@@ -649,18 +1097,15 @@ static int nvg_gpu_renderUpdateTexture(
 ) {
 	RenderContext *ctx = (RenderContext*) uptr;
 
-	if (image < 0 || image >= NVG_MAX_TEXTURES) {
-		return 0;
-	}
-
-	void *userdata = ctx->textures[image].userdata;
-	if (userdata == NULL) {
+	RenderTexture *tex = INTERNAL_findTexture(ctx, image);
+	if (tex == NULL) {
 		return 0;
 	}
 
+	ctx->frameStats.textureBytesUploaded += w * h * ((tex->type == NVG_TEXTURE_RGBA) ? 4 : 1);
 	ctx->updateTexture(
 		ctx->userdata,
-		userdata,
+		tex->userdata,
 		x,
 		y,
 		w,
@@ -678,19 +1123,16 @@ static int nvg_gpu_renderGetTextureSize(
 ) {
 	RenderContext *ctx = (RenderContext*) uptr;
 
-	if (image < 0 || image >= NVG_MAX_TEXTURES) {
-		return 0;
-	}
-
-	if (ctx->textures[image].userdata == NULL) {
+	RenderTexture *tex = INTERNAL_findTexture(ctx, image);
+	if (tex == NULL) {
 		return 0;
 	}
 
 	if (w != NULL) {
-		*w = ctx->textures[image].width;
+		*w = tex->width;
 	}
 	if (h != NULL) {
-		*h = ctx->textures[image].height;
+		*h = tex->height;
 	}
 	return 1;
 }
@@ -700,65 +1142,83 @@ static void nvg_gpu_renderViewport(void* uptr, float width, float height, float
 
 	NVG_NOTUSED(devicePixelRatio);
 
+	ctx->viewWidth = width;
+	ctx->viewHeight = height;
 	ctx->setViewport(ctx->userdata, width, height);
 }
 
 static void nvg_gpu_renderCancel(void* uptr) {
 	RenderContext *ctx = (RenderContext*) uptr;
 
+	ctx->recording = RENDERRECORD_NONE;
 	ctx->nverts = 0;
 	ctx->npaths = 0;
 	ctx->ncalls = 0;
 	ctx->nuniforms = 0;
+	ctx->ninstanceCalls = 0;
+	INTERNAL_freeDeletedGeometry(ctx);
 }
 
 static void nvg_gpu_renderFlush(void* uptr) {
 	RenderContext *ctx = (RenderContext*) uptr;
 
+	NVG_TRACE_BEGIN("nvg_gpu_renderFlush", NULL);
+
 	if (ctx->ncalls <= 0) {
 		goto reset;
 	}
 
 	ctx->resetState(ctx->userdata);
+	ctx->updateVertexTransform(ctx->userdata, INTERNAL_identity);
 
-	if ((ctx->vertexBuffer == NULL) || (ctx->nverts * sizeof(NVGvertex) > ctx->vertexBufferSize)) {
-		if (ctx->vertexBuffer != NULL) {
-			ctx->deleteVertexBuffer(ctx->userdata, ctx->vertexBuffer);
+	// Frames made only of static geometry have nothing to upload
+	if (ctx->nverts > 0) {
+		if ((ctx->vertexBuffer == NULL) || (ctx->nverts * sizeof(NVGvertex) > ctx->vertexBufferSize)) {
+			if (ctx->vertexBuffer != NULL) {
+				ctx->deleteVertexBuffer(ctx->userdata, ctx->vertexBuffer);
+			}
+			ctx->vertexBufferSize = ctx->nverts * sizeof(NVGvertex);
+			ctx->vertexBuffer = ctx->createVertexBuffer(
+				ctx->userdata,
+				ctx->vertexBufferSize
+			);
 		}
-		ctx->vertexBufferSize = ctx->nverts * sizeof(NVGvertex);
-		ctx->vertexBuffer = ctx->createVertexBuffer(
+		ctx->updateVertexBuffer(
 			ctx->userdata,
-			ctx->vertexBufferSize
+			ctx->vertexBuffer,
+			ctx->verts,
+			ctx->nverts,
+			sizeof(NVGvertex)
 		);
+		ctx->frameStats.verticesUploaded += ctx->nverts;
+		ctx->frameStats.vertexBytesUploaded += ctx->nverts * sizeof(NVGvertex);
 	}
-	ctx->updateVertexBuffer(
-		ctx->userdata,
-		ctx->vertexBuffer,
-		ctx->verts,
-		ctx->nverts,
-		sizeof(NVGvertex)
-	);
 
 	for (int i = 0; i < ctx->ncalls; i++) {
-		RenderDrawCall *call = &ctx->calls[i];
-
-		ctx->updateBlendFunction(ctx->userdata, call->blendOp);
+		INTERNAL_renderCall(ctx, &ctx->calls[i]);
+	}
 
-		if (call->type == RENDERTYPE_FILL)
-			INTERNAL_fill(ctx, call);
-		else if (call->type == RENDERTYPE_CONVEXFILL)
-			INTERNAL_convexFill(ctx, call);
-		else if (call->type == RENDERTYPE_STROKE)
-			INTERNAL_stroke(ctx, call);
-		else if (call->type == RENDERTYPE_TRIANGLES)
-			INTERNAL_triangles(ctx, call);
+	// Never leave the frame pointed at an offscreen target
+	if (ctx->renderTarget != 0) {
+		ctx->setRenderTarget(ctx->userdata, NULL);
+		ctx->setViewport(ctx->userdata, ctx->viewWidth, ctx->viewHeight);
+		ctx->renderTarget = 0;
 	}
 
 reset:
+	if (ctx->capture != NULL) {
+		INTERNAL_captureWrite(ctx->capture, CAPTURE_ENDFRAME, NULL, 0, NULL, 0);
+	}
+	ctx->lastFrameStats = ctx->frameStats;
+	memset(&ctx->frameStats, '\0', sizeof(NVGframeStats));
+	INTERNAL_trimBuffers(ctx);
 	ctx->nverts = 0;
 	ctx->npaths = 0;
 	ctx->ncalls = 0;
 	ctx->nuniforms = 0;
+	ctx->ninstanceCalls = 0;
+	INTERNAL_freeDeletedGeometry(ctx);
+	NVG_TRACE_END();
 }
 
 static void nvg_gpu_renderFill(
@@ -964,6 +1424,18 @@ static void nvg_gpu_renderDelete(void* uptr) {
 
 	RenderContext *ctx = (RenderContext*) uptr;
 
+	INTERNAL_endCapture(ctx);
+
+	for (int i = 0; i < NVG_MAX_GEOMETRIES; i += 1) {
+		RenderGeometry *geom = &ctx->geometries[i];
+		if (geom->vertexBuffer != NULL) {
+			ctx->deleteVertexBuffer(ctx->userdata, geom->vertexBuffer);
+		}
+		free(geom->calls);
+		free(geom->paths);
+		free(geom->uniforms);
+	}
+
 	for (int i = 0; i < NVG_MAX_TEXTURES; i += 1) {
 		if (ctx->textures[i].userdata != NULL) {
 			ctx->deleteTexture(
@@ -984,6 +1456,7 @@ static void nvg_gpu_renderDelete(void* uptr) {
 	free(ctx->verts);
 	free(ctx->uniforms);
 	free(ctx->calls);
+	free(ctx->instanceCalls);
 
 	free(uptr);
 }
@@ -1002,6 +1475,7 @@ NVGcontext* nvgGpuCreate(
 	nvg_gpu_pfn_updateShader updateShader,
 	nvg_gpu_pfn_updateSampler updateSampler,
 	nvg_gpu_pfn_setViewport setViewport,
+	nvg_gpu_pfn_updateVertexTransform updateVertexTransform,
 	nvg_gpu_pfn_resetState resetState,
 	nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask,
 	nvg_gpu_pfn_updateBlendFunction updateBlendFunction,
@@ -1009,7 +1483,9 @@ NVGcontext* nvgGpuCreate(
 	nvg_gpu_pfn_updateStencilFunction updateStencilFunction,
 	nvg_gpu_pfn_toggleCullMode toggleCullMode,
 	nvg_gpu_pfn_applyState applyState,
-	nvg_gpu_pfn_drawPrimitives drawPrimitives
+	nvg_gpu_pfn_drawPrimitives drawPrimitives,
+	nvg_gpu_pfn_createRenderTarget createRenderTarget,
+	nvg_gpu_pfn_setRenderTarget setRenderTarget
 ) {
 	NVGparams nvgParams;
 
@@ -1029,6 +1505,7 @@ NVGcontext* nvgGpuCreate(
 	ctx->updateShader = updateShader;
 	ctx->updateSampler = updateSampler;
 	ctx->setViewport = setViewport;
+	ctx->updateVertexTransform = updateVertexTransform;
 	ctx->resetState = resetState;
 	ctx->toggleColorWriteMask = toggleColorWriteMask;
 	ctx->updateBlendFunction = updateBlendFunction;
@@ -1037,6 +1514,8 @@ NVGcontext* nvgGpuCreate(
 	ctx->toggleCullMode = toggleCullMode;
 	ctx->applyState = applyState;
 	ctx->drawPrimitives = drawPrimitives;
+	ctx->createRenderTarget = createRenderTarget;
+	ctx->setRenderTarget = setRenderTarget;
 
 	memset(&nvgParams, 0, sizeof(nvgParams));
 	nvgParams.renderCreate = nvg_gpu_renderCreate;
@@ -1061,3 +1540,1479 @@ void nvgGpuDelete(NVGcontext *ctx)
 {
 	nvgDeleteInternal(ctx);
 }
+
+void nvgGetFrameStats(NVGcontext *ctx, NVGframeStats *stats)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	unsigned long long flatten, expand, flush;
+	double msPerTick = 1000.0 / (double) NVG_TICKS_FREQUENCY();
+
+	*stats = gl->lastFrameStats;
+	nvgGetDrawCounts(
+		ctx,
+		&stats->drawCalls,
+		&stats->fillTriangles,
+		&stats->strokeTriangles,
+		&stats->textTriangles
+	);
+	nvgGetStageTicks(ctx, &flatten, &expand, &flush);
+	stats->flattenTime = (float) (flatten * msPerTick);
+	stats->expandTime = (float) (expand * msPerTick);
+	stats->flushTime = (float) (flush * msPerTick);
+}
+
+void nvgGpuSetTrimPolicy(NVGcontext *ctx, int frames, float fraction)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+
+	gl->trimFrames = INTERNAL_maxi(frames, 0);
+	gl->trimFraction = (fraction < 0.0f) ? 0.0f : ((fraction > 1.0f) ? 1.0f : fraction);
+	memset(gl->bufferBelow, '\0', sizeof(gl->bufferBelow));
+	nvgSetCacheTrim(ctx, frames, fraction);
+}
+
+void nvgGpuReserve(NVGcontext *ctx, const NVGgpuBufferSizes *hint)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	int cache[NVG_CACHE_COUNT];
+	int frame[RENDERBUFFER_COUNT];
+
+	frame[RENDERBUFFER_CALLS] = hint->calls;
+	frame[RENDERBUFFER_PATHS] = hint->paths;
+	frame[RENDERBUFFER_VERTS] = hint->verts;
+	frame[RENDERBUFFER_UNIFORMS] = hint->uniforms;
+	frame[RENDERBUFFER_INSTANCECALLS] = hint->instanceCalls;
+	for (int i = 0; i < RENDERBUFFER_COUNT; i += 1) {
+		void **data;
+		int *capacity, count, minimum;
+		size_t size;
+
+		INTERNAL_getBuffer(gl, (RenderBuffer) i, &data, &capacity, &count, &size, &minimum);
+		gl->bufferReserve[i] = INTERNAL_maxi(frame[i], 0);
+		if (frame[i] > *capacity) {
+			INTERNAL_resizeBuffer(gl, (RenderBuffer) i, frame[i]);
+		}
+	}
+
+	cache[NVG_CACHE_COMMANDS] = hint->commands;
+	cache[NVG_CACHE_POINTS] = hint->cachePoints;
+	cache[NVG_CACHE_PATHS] = hint->cachePaths;
+	cache[NVG_CACHE_VERTS] = hint->cacheVerts;
+	nvgReserveCache(ctx, cache);
+}
+
+static void INTERNAL_fillBufferSizes(NVGgpuBufferSizes *sizes, const int *frame, const int *cache)
+{
+	sizes->calls = frame[RENDERBUFFER_CALLS];
+	sizes->paths = frame[RENDERBUFFER_PATHS];
+	sizes->verts = frame[RENDERBUFFER_VERTS];
+	sizes->uniforms = frame[RENDERBUFFER_UNIFORMS];
+	sizes->instanceCalls = frame[RENDERBUFFER_INSTANCECALLS];
+	sizes->commands = cache[NVG_CACHE_COMMANDS];
+	sizes->cachePoints = cache[NVG_CACHE_POINTS];
+	sizes->cachePaths = cache[NVG_CACHE_PATHS];
+	sizes->cacheVerts = cache[NVG_CACHE_VERTS];
+}
+
+void nvgGpuGetBufferSizes(NVGcontext *ctx, NVGgpuBufferSizes *capacity, NVGgpuBufferSizes *used)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	int cacheCapacity[NVG_CACHE_COUNT], cacheUsed[NVG_CACHE_COUNT];
+	int frameCapacity[RENDERBUFFER_COUNT];
+
+	for (int i = 0; i < RENDERBUFFER_COUNT; i += 1) {
+		void **data;
+		int *c, count, minimum;
+		size_t size;
+
+		INTERNAL_getBuffer(gl, (RenderBuffer) i, &data, &c, &count, &size, &minimum);
+		frameCapacity[i] = *c;
+	}
+	nvgGetCacheSizes(ctx, cacheCapacity, cacheUsed);
+
+	if (capacity != NULL) {
+		INTERNAL_fillBufferSizes(capacity, frameCapacity, cacheCapacity);
+	}
+	if (used != NULL) {
+		INTERNAL_fillBufferSizes(used, gl->bufferLastUsed, cacheUsed);
+	}
+}
+
+// Null backend, see nvgGpuCreateNull
+
+typedef struct NullDevice
+{
+	NVGgpuNullCounters counters;
+	size_t nextHandle;
+} NullDevice;
+
+static void* INTERNAL_nullHandle(NullDevice *dev)
+{
+	// Never NULL, that means "no resource" to the renderer
+	dev->nextHandle += 1;
+	return (void*) dev->nextHandle;
+}
+
+static void NULLGPU_createContext(void* userdata)
+{
+	NVG_NOTUSED(userdata);
+}
+
+static void NULLGPU_deleteContext(void* userdata)
+{
+	free(userdata);
+}
+
+static void* NULLGPU_createVertexBuffer(void* userdata, size_t size)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(size);
+	dev->counters.vertexBuffersCreated += 1;
+	return INTERNAL_nullHandle(dev);
+}
+
+static void NULLGPU_deleteVertexBuffer(void* userdata, void* buffer)
+{
+	NVG_NOTUSED(userdata);
+	NVG_NOTUSED(buffer);
+}
+
+static void NULLGPU_updateVertexBuffer(void* userdata, void* buffer, void* ptr, int count, size_t stride)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(buffer);
+	NVG_NOTUSED(ptr);
+	dev->counters.vertexUploads += 1;
+	dev->counters.verticesUploaded += count;
+	dev->counters.vertexBytesUploaded += count * stride;
+}
+
+static void* NULLGPU_createTexture(void* userdata, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(isRGBA);
+	NVG_NOTUSED(width);
+	NVG_NOTUSED(height);
+	NVG_NOTUSED(nearest);
+	NVG_NOTUSED(repeatX);
+	NVG_NOTUSED(repeatY);
+	dev->counters.texturesCreated += 1;
+	return INTERNAL_nullHandle(dev);
+}
+
+static void NULLGPU_deleteTexture(void* userdata, void* texture)
+{
+	NVG_NOTUSED(userdata);
+	NVG_NOTUSED(texture);
+}
+
+static void NULLGPU_updateTexture(void* userdata, void* texture, int x, int y, int w, int h, void* data)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(texture);
+	NVG_NOTUSED(x);
+	NVG_NOTUSED(y);
+	NVG_NOTUSED(data);
+	dev->counters.textureUploads += 1;
+	dev->counters.texelsUploaded += (size_t) w * h;
+}
+
+static void NULLGPU_updateUniformBuffer(void* userdata, void* uniforms, size_t uniformLength)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(uniforms);
+	dev->counters.uniformUploads += 1;
+	dev->counters.uniformBytesUploaded += uniformLength;
+}
+
+static void NULLGPU_updateShader(void* userdata, int enableAA, int fillType, int texType)
+{
+	NVG_NOTUSED(enableAA);
+	NVG_NOTUSED(fillType);
+	NVG_NOTUSED(texType);
+	((NullDevice*) userdata)->counters.shaderChanges += 1;
+}
+
+static void NULLGPU_updateSampler(void* userdata, void* texture)
+{
+	NVG_NOTUSED(texture);
+	((NullDevice*) userdata)->counters.samplerChanges += 1;
+}
+
+static void NULLGPU_setViewport(void* userdata, float width, float height)
+{
+	NVG_NOTUSED(width);
+	NVG_NOTUSED(height);
+	((NullDevice*) userdata)->counters.viewportChanges += 1;
+}
+
+static void NULLGPU_updateVertexTransform(void* userdata, float* xform)
+{
+	NVG_NOTUSED(xform);
+	((NullDevice*) userdata)->counters.vertexTransformChanges += 1;
+}
+
+static void NULLGPU_resetState(void* userdata)
+{
+	((NullDevice*) userdata)->counters.stateResets += 1;
+}
+
+static void NULLGPU_toggleColorWriteMask(void* userdata, int enabled)
+{
+	NVG_NOTUSED(enabled);
+	((NullDevice*) userdata)->counters.colorWriteMaskChanges += 1;
+}
+
+static void NULLGPU_updateBlendFunction(void* userdata, NVGcompositeOperationState blendOp)
+{
+	NVG_NOTUSED(blendOp);
+	((NullDevice*) userdata)->counters.blendFunctionChanges += 1;
+}
+
+static void NULLGPU_toggleStencil(void* userdata, int enabled)
+{
+	NVG_NOTUSED(enabled);
+	((NullDevice*) userdata)->counters.stencilToggles += 1;
+}
+
+static void NULLGPU_updateStencilFunction(
+	void* userdata,
+	nvgStencilCompareFunction stencilFunc,
+	nvgStencilOperation stencilFail,
+	nvgStencilOperation stencilDepthBufferFail,
+	nvgStencilOperation stencilPass,
+	nvgStencilOperation ccwStencilFail,
+	nvgStencilOperation ccwStencilDepthBufferFail,
+	nvgStencilOperation ccwStencilPass
+) {
+	NVG_NOTUSED(stencilFunc);
+	NVG_NOTUSED(stencilFail);
+	NVG_NOTUSED(stencilDepthBufferFail);
+	NVG_NOTUSED(stencilPass);
+	NVG_NOTUSED(ccwStencilFail);
+	NVG_NOTUSED(ccwStencilDepthBufferFail);
+	NVG_NOTUSED(ccwStencilPass);
+	((NullDevice*) userdata)->counters.stencilFunctionChanges += 1;
+}
+
+static void NULLGPU_toggleCullMode(void* userdata, int enabled)
+{
+	NVG_NOTUSED(enabled);
+	((NullDevice*) userdata)->counters.cullModeChanges += 1;
+}
+
+static void NULLGPU_applyState(void* userdata, void* vertexBuffer)
+{
+	NVG_NOTUSED(vertexBuffer);
+	((NullDevice*) userdata)->counters.stateApplies += 1;
+}
+
+static void NULLGPU_drawPrimitives(void* userdata, int triStrip, int vertexOffset, int vertexCount)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(triStrip);
+	NVG_NOTUSED(vertexOffset);
+	dev->counters.drawCalls += 1;
+	dev->counters.verticesDrawn += vertexCount;
+}
+
+static void* NULLGPU_createRenderTarget(void* userdata, int width, int height)
+{
+	NullDevice *dev = (NullDevice*) userdata;
+	NVG_NOTUSED(width);
+	NVG_NOTUSED(height);
+	dev->counters.texturesCreated += 1;
+	return INTERNAL_nullHandle(dev);
+}
+
+static void NULLGPU_setRenderTarget(void* userdata, void* texture)
+{
+	NVG_NOTUSED(texture);
+	((NullDevice*) userdata)->counters.renderTargetChanges += 1;
+}
+
+NVGcontext* nvgGpuCreateNull(void)
+{
+	NullDevice *dev = (NullDevice*) malloc(sizeof(NullDevice));
+	if (dev == NULL) {
+		return NULL;
+	}
+	memset(dev, '\0', sizeof(NullDevice));
+
+	return nvgGpuCreate(
+		dev,
+		NULLGPU_createContext,
+		NULLGPU_deleteContext,
+		NULLGPU_createVertexBuffer,
+		NULLGPU_deleteVertexBuffer,
+		NULLGPU_updateVertexBuffer,
+		NULLGPU_createTexture,
+		NULLGPU_deleteTexture,
+		NULLGPU_updateTexture,
+		NULLGPU_updateUniformBuffer,
+		NULLGPU_updateShader,
+		NULLGPU_updateSampler,
+		NULLGPU_setViewport,
+		NULLGPU_updateVertexTransform,
+		NULLGPU_resetState,
+		NULLGPU_toggleColorWriteMask,
+		NULLGPU_updateBlendFunction,
+		NULLGPU_toggleStencil,
+		NULLGPU_updateStencilFunction,
+		NULLGPU_toggleCullMode,
+		NULLGPU_applyState,
+		NULLGPU_drawPrimitives,
+		NULLGPU_createRenderTarget,
+		NULLGPU_setRenderTarget
+	);
+}
+
+static NullDevice* INTERNAL_nullDevice(NVGcontext *ctx)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	if (gl->capture != NULL) {
+		if (gl->capture->backend.drawPrimitives != NULLGPU_drawPrimitives) {
+			return NULL;
+		}
+		return (NullDevice*) gl->capture->backend.userdata;
+	}
+	if (gl->drawPrimitives != NULLGPU_drawPrimitives) {
+		return NULL;
+	}
+	return (NullDevice*) gl->userdata;
+}
+
+void nvgGpuGetNullCounters(NVGcontext *ctx, NVGgpuNullCounters *counters)
+{
+	NullDevice *dev = INTERNAL_nullDevice(ctx);
+	if (dev == NULL) {
+		memset(counters, '\0', sizeof(NVGgpuNullCounters));
+		return;
+	}
+	*counters = dev->counters;
+}
+
+void nvgGpuResetNullCounters(NVGcontext *ctx)
+{
+	NullDevice *dev = INTERNAL_nullDevice(ctx);
+	if (dev != NULL) {
+		memset(&dev->counters, '\0', sizeof(NVGgpuNullCounters));
+	}
+}
+
+static void INTERNAL_beginRecord(NVGcontext *ctx, RenderRecord mode)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+
+	if (gl->recording != RENDERRECORD_NONE) {
+		return;
+	}
+
+	gl->recording = mode;
+	gl->recordCalls = gl->ncalls;
+	gl->recordPaths = gl->npaths;
+	gl->recordVerts = gl->nverts;
+	gl->recordUniforms = gl->nuniforms;
+
+	// Tessellate in local coordinates, the transform is applied at draw time.
+	// A scissor would be baked into the uniforms in world space, but tested
+	// against local vertices, so none is applied while recording.
+	nvgSave(ctx);
+	nvgResetTransform(ctx);
+	nvgResetScissor(ctx);
+}
+
+static void INTERNAL_queueInstances(
+	NVGcontext *ctx,
+	int geometry,
+	int callOffset,
+	int callCount,
+	const float *xforms,
+	int count
+) {
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderDrawCall *call;
+	float base[6];
+	int i;
+
+	nvgCurrentTransform(ctx, base);
+	for (i = 0; i < count; i += 1) {
+		call = INTERNAL_allocCall(gl);
+		if (call == NULL) return;
+
+		call->type = RENDERTYPE_GEOMETRY;
+		call->geometry = geometry;
+		call->callOffset = callOffset;
+		call->callCount = callCount;
+		memcpy(call->xform, &xforms[i * 6], sizeof(call->xform));
+		nvgTransformMultiply(call->xform, base);
+	}
+}
+
+void nvgGpuBeginGeometry(NVGcontext *ctx)
+{
+	INTERNAL_beginRecord(ctx, RENDERRECORD_GEOMETRY);
+}
+
+int nvgGpuEndGeometry(NVGcontext *ctx)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderGeometry *geom = NULL;
+	int i, ncalls, npaths, nverts, nuniforms, id = 0;
+
+	if (gl->recording != RENDERRECORD_GEOMETRY) {
+		return 0;
+	}
+	gl->recording = RENDERRECORD_NONE;
+	nvgRestore(ctx);
+
+	ncalls = gl->ncalls - gl->recordCalls;
+	npaths = gl->npaths - gl->recordPaths;
+	nverts = gl->nverts - gl->recordVerts;
+	nuniforms = gl->nuniforms - gl->recordUniforms;
+	if (ncalls <= 0 || nverts <= 0) {
+		goto rollback;
+	}
+
+	for (i = 0; i < NVG_MAX_GEOMETRIES; i += 1) {
+		if (gl->geometries[i].vertexBuffer == NULL) {
+			geom = &gl->geometries[i];
+			id = i + 1;
+			break;
+		}
+	}
+	if (geom == NULL) {
+		goto rollback;
+	}
+
+	geom->calls = (RenderDrawCall*) malloc(sizeof(RenderDrawCall) * ncalls);
+	geom->paths = (RenderPath*) malloc(sizeof(RenderPath) * INTERNAL_maxi(npaths, 1));
+	geom->uniforms = (unsigned char*) malloc(gl->fragSize * INTERNAL_maxi(nuniforms, 1));
+	if (geom->calls == NULL || geom->paths == NULL || geom->uniforms == NULL) {
+		goto error;
+	}
+	geom->ncalls = ncalls;
+	geom->npaths = npaths;
+	geom->nuniforms = nuniforms;
+
+	// Copy the recorded range out of the frame, rebasing all of the offsets
+	memcpy(geom->calls, &gl->calls[gl->recordCalls], sizeof(RenderDrawCall) * ncalls);
+	memcpy(geom->paths, &gl->paths[gl->recordPaths], sizeof(RenderPath) * npaths);
+	memcpy(geom->uniforms, &gl->uniforms[gl->recordUniforms * gl->fragSize], gl->fragSize * nuniforms);
+	for (i = 0; i < ncalls; i += 1) {
+		RenderDrawCall *call = &geom->calls[i];
+		call->pathOffset -= gl->recordPaths;
+		call->uniformOffset -= gl->recordUniforms * gl->fragSize;
+		if (call->triangleCount > 0) {
+			call->triangleOffset -= gl->recordVerts;
+		}
+	}
+	for (i = 0; i < npaths; i += 1) {
+		RenderPath *path = &geom->paths[i];
+		if (path->fillCount > 0) {
+			path->fillOffset -= gl->recordVerts;
+		}
+		if (path->strokeCount > 0) {
+			path->strokeOffset -= gl->recordVerts;
+		}
+	}
+
+	geom->vertexBufferSize = nverts * sizeof(NVGvertex);
+	geom->vertexBuffer = gl->createVertexBuffer(
+		gl->userdata,
+		geom->vertexBufferSize
+	);
+	if (geom->vertexBuffer == NULL) {
+		goto error;
+	}
+	gl->updateVertexBuffer(
+		gl->userdata,
+		geom->vertexBuffer,
+		&gl->verts[gl->recordVerts],
+		nverts,
+		sizeof(NVGvertex)
+	);
+	gl->frameStats.verticesUploaded += nverts;
+	gl->frameStats.vertexBytesUploaded += nverts * sizeof(NVGvertex);
+	goto rollback;
+
+error:
+	free(geom->calls);
+	free(geom->paths);
+	free(geom->uniforms);
+	memset(geom, '\0', sizeof(RenderGeometry));
+	id = 0;
+
+rollback:
+	INTERNAL_noteBufferUse(gl);
+
+	// The recorded calls belong to the geometry now, not this frame
+	gl->ncalls = gl->recordCalls;
+	gl->npaths = gl->recordPaths;
+	gl->nverts = gl->recordVerts;
+	gl->nuniforms = gl->recordUniforms;
+	return id;
+}
+
+void nvgGpuDrawGeometry(NVGcontext *ctx, int geometry)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderDrawCall *call;
+
+	if (geometry < 1 || geometry > NVG_MAX_GEOMETRIES) {
+		return;
+	}
+	if (gl->geometries[geometry - 1].vertexBuffer == NULL || gl->geometries[geometry - 1].deleted) {
+		return;
+	}
+	if (gl->recording != RENDERRECORD_NONE) {
+		return; // FIXME: Nested geometry is not supported
+	}
+
+	call = INTERNAL_allocCall(gl);
+	if (call == NULL) return;
+
+	call->type = RENDERTYPE_GEOMETRY;
+	call->geometry = geometry;
+	nvgCurrentTransform(ctx, call->xform);
+}
+
+void nvgGpuDeleteGeometry(NVGcontext *ctx, int geometry)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderGeometry *geom;
+
+	if (geometry < 1 || geometry > NVG_MAX_GEOMETRIES) {
+		return;
+	}
+	geom = &gl->geometries[geometry - 1];
+	if (geom->vertexBuffer == NULL) {
+		return;
+	}
+
+	// Draws already queued this frame still read the geometry at flush
+	geom->deleted = 1;
+}
+
+void nvgGpuDrawGeometryInstanced(NVGcontext *ctx, int geometry, const float *xforms, int count)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+
+	if (geometry < 1 || geometry > NVG_MAX_GEOMETRIES) {
+		return;
+	}
+	if (gl->geometries[geometry - 1].vertexBuffer == NULL || gl->geometries[geometry - 1].deleted) {
+		return;
+	}
+	if (gl->recording != RENDERRECORD_NONE) {
+		return; // FIXME: Nested geometry is not supported
+	}
+
+	INTERNAL_queueInstances(ctx, geometry, 0, 0, xforms, count);
+}
+
+void nvgGpuBeginInstances(NVGcontext *ctx)
+{
+	INTERNAL_beginRecord(ctx, RENDERRECORD_INSTANCES);
+}
+
+void nvgGpuEndInstances(NVGcontext *ctx, const float *xforms, int count)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	int ncalls, offset;
+
+	if (gl->recording != RENDERRECORD_INSTANCES) {
+		return;
+	}
+	gl->recording = RENDERRECORD_NONE;
+	nvgRestore(ctx);
+
+	ncalls = gl->ncalls - gl->recordCalls;
+	if (ncalls <= 0 || count <= 0) {
+		goto rollback;
+	}
+
+	offset = INTERNAL_allocInstanceCalls(gl, ncalls);
+	if (offset == -1) {
+		goto rollback;
+	}
+
+	/* Move the recorded calls aside, their paths, vertices and uniforms
+	 * stay in the frame and get uploaded once with everything else.
+	 */
+	memcpy(
+		&gl->instanceCalls[offset],
+		&gl->calls[gl->recordCalls],
+		sizeof(RenderDrawCall) * ncalls
+	);
+	INTERNAL_noteBufferUse(gl);
+	gl->ncalls = gl->recordCalls;
+
+	INTERNAL_queueInstances(ctx, 0, offset, ncalls, xforms, count);
+	return;
+
+rollback:
+	INTERNAL_noteBufferUse(gl);
+	gl->ncalls = gl->recordCalls;
+	gl->npaths = gl->recordPaths;
+	gl->nverts = gl->recordVerts;
+	gl->nuniforms = gl->recordUniforms;
+}
+
+int nvgGpuCreateRenderTarget(NVGcontext *ctx, int width, int height)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderTexture *dst;
+	int id;
+
+	id = INTERNAL_allocTexture(gl);
+	if (id == 0) {
+		return 0;
+	}
+
+	dst = &gl->textures[id - 1];
+	dst->userdata = gl->createRenderTarget(gl->userdata, width, height);
+	if (dst->userdata == NULL) {
+		return 0;
+	}
+	dst->type = NVG_TEXTURE_RGBA;
+	dst->flags = NVG_IMAGE_PREMULTIPLIED;
+	dst->width = width;
+	dst->height = height;
+	dst->target = 1;
+	return id;
+}
+
+void nvgGpuBindRenderTarget(NVGcontext *ctx, int image)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderDrawCall *call;
+
+	if (gl->recording != RENDERRECORD_NONE) {
+		return; // FIXME: Targets can't be switched inside a recording
+	}
+
+	call = INTERNAL_allocCall(gl);
+	if (call == NULL) return;
+
+	call->type = RENDERTYPE_TARGET;
+	call->image = image;
+}
+
+// Callback capture, see nvgGpuBeginCapture
+
+static void* CAPTURE_createVertexBuffer(void* userdata, size_t size)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	void *buffer = cap->backend.createVertexBuffer(cap->backend.userdata, size);
+	long long args[2] = { INTERNAL_captureHandle(buffer), (long long) size };
+	INTERNAL_captureWrite(cap, CAPTURE_CREATEVERTEXBUFFER, args, sizeof(args), NULL, 0);
+	return buffer;
+}
+
+static void CAPTURE_deleteVertexBuffer(void* userdata, void* buffer)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { INTERNAL_captureHandle(buffer) };
+	INTERNAL_captureWrite(cap, CAPTURE_DELETEVERTEXBUFFER, args, sizeof(args), NULL, 0);
+	cap->backend.deleteVertexBuffer(cap->backend.userdata, buffer);
+}
+
+static void CAPTURE_updateVertexBuffer(void* userdata, void* buffer, void* ptr, int count, size_t stride)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[3] = { INTERNAL_captureHandle(buffer), count, (long long) stride };
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATEVERTEXBUFFER, args, sizeof(args), ptr, count * stride);
+	cap->backend.updateVertexBuffer(cap->backend.userdata, buffer, ptr, count, stride);
+}
+
+static void* CAPTURE_createTexture(void* userdata, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	void *texture = cap->backend.createTexture(
+		cap->backend.userdata,
+		isRGBA,
+		width,
+		height,
+		nearest,
+		repeatX,
+		repeatY
+	);
+	long long args[7] = {
+		INTERNAL_captureHandle(texture),
+		isRGBA,
+		width,
+		height,
+		nearest,
+		repeatX,
+		repeatY
+	};
+	INTERNAL_captureWrite(cap, CAPTURE_CREATETEXTURE, args, sizeof(args), NULL, 0);
+	return texture;
+}
+
+static void CAPTURE_deleteTexture(void* userdata, void* texture)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { INTERNAL_captureHandle(texture) };
+	INTERNAL_captureWrite(cap, CAPTURE_DELETETEXTURE, args, sizeof(args), NULL, 0);
+	cap->backend.deleteTexture(cap->backend.userdata, texture);
+}
+
+static void CAPTURE_updateTexture(void* userdata, void* texture, int x, int y, int w, int h, void* data)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[5] = { INTERNAL_captureHandle(texture), x, y, w, h };
+	size_t bpp = 4;
+
+	// The backend only gets the handle, the format is in the texture table
+	for (int i = 0; i < NVG_MAX_TEXTURES; i += 1) {
+		if (cap->gl->textures[i].userdata == texture) {
+			bpp = (cap->gl->textures[i].type == NVG_TEXTURE_RGBA) ? 4 : 1;
+			break;
+		}
+	}
+
+	INTERNAL_captureWrite(
+		cap,
+		CAPTURE_UPDATETEXTURE,
+		args,
+		sizeof(args),
+		data,
+		(data != NULL) ? ((size_t) w * h * bpp) : 0
+	);
+	cap->backend.updateTexture(cap->backend.userdata, texture, x, y, w, h, data);
+}
+
+static void CAPTURE_updateUniformBuffer(void* userdata, void* uniforms, size_t uniformLength)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATEUNIFORMBUFFER, NULL, 0, uniforms, uniformLength);
+	cap->backend.updateUniformBuffer(cap->backend.userdata, uniforms, uniformLength);
+}
+
+static void CAPTURE_updateShader(void* userdata, int enableAA, int fillType, int texType)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[3] = { enableAA, fillType, texType };
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATESHADER, args, sizeof(args), NULL, 0);
+	cap->backend.updateShader(cap->backend.userdata, enableAA, fillType, texType);
+}
+
+static void CAPTURE_updateSampler(void* userdata, void* texture)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { INTERNAL_captureHandle(texture) };
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATESAMPLER, args, sizeof(args), NULL, 0);
+	cap->backend.updateSampler(cap->backend.userdata, texture);
+}
+
+static void CAPTURE_setViewport(void* userdata, float width, float height)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	float args[2] = { width, height };
+	INTERNAL_captureWrite(cap, CAPTURE_SETVIEWPORT, args, sizeof(args), NULL, 0);
+	cap->backend.setViewport(cap->backend.userdata, width, height);
+}
+
+static void CAPTURE_updateVertexTransform(void* userdata, float* xform)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATEVERTEXTRANSFORM, xform, sizeof(float) * 6, NULL, 0);
+	cap->backend.updateVertexTransform(cap->backend.userdata, xform);
+}
+
+static void CAPTURE_resetState(void* userdata)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	INTERNAL_captureWrite(cap, CAPTURE_RESETSTATE, NULL, 0, NULL, 0);
+	cap->backend.resetState(cap->backend.userdata);
+}
+
+static void CAPTURE_toggleColorWriteMask(void* userdata, int enabled)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { enabled };
+	INTERNAL_captureWrite(cap, CAPTURE_TOGGLECOLORWRITEMASK, args, sizeof(args), NULL, 0);
+	cap->backend.toggleColorWriteMask(cap->backend.userdata, enabled);
+}
+
+static void CAPTURE_updateBlendFunction(void* userdata, NVGcompositeOperationState blendOp)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[4] = {
+		blendOp.srcRGB,
+		blendOp.dstRGB,
+		blendOp.srcAlpha,
+		blendOp.dstAlpha
+	};
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATEBLENDFUNCTION, args, sizeof(args), NULL, 0);
+	cap->backend.updateBlendFunction(cap->backend.userdata, blendOp);
+}
+
+static void CAPTURE_toggleStencil(void* userdata, int enabled)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { enabled };
+	INTERNAL_captureWrite(cap, CAPTURE_TOGGLESTENCIL, args, sizeof(args), NULL, 0);
+	cap->backend.toggleStencil(cap->backend.userdata, enabled);
+}
+
+static void CAPTURE_updateStencilFunction(
+	void* userdata,
+	nvgStencilCompareFunction stencilFunc,
+	nvgStencilOperation stencilFail,
+	nvgStencilOperation stencilDepthBufferFail,
+	nvgStencilOperation stencilPass,
+	nvgStencilOperation ccwStencilFail,
+	nvgStencilOperation ccwStencilDepthBufferFail,
+	nvgStencilOperation ccwStencilPass
+) {
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[7] = {
+		stencilFunc,
+		stencilFail,
+		stencilDepthBufferFail,
+		stencilPass,
+		ccwStencilFail,
+		ccwStencilDepthBufferFail,
+		ccwStencilPass
+	};
+	INTERNAL_captureWrite(cap, CAPTURE_UPDATESTENCILFUNCTION, args, sizeof(args), NULL, 0);
+	cap->backend.updateStencilFunction(
+		cap->backend.userdata,
+		stencilFunc,
+		stencilFail,
+		stencilDepthBufferFail,
+		stencilPass,
+		ccwStencilFail,
+		ccwStencilDepthBufferFail,
+		ccwStencilPass
+	);
+}
+
+static void CAPTURE_toggleCullMode(void* userdata, int enabled)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { enabled };
+	INTERNAL_captureWrite(cap, CAPTURE_TOGGLECULLMODE, args, sizeof(args), NULL, 0);
+	cap->backend.toggleCullMode(cap->backend.userdata, enabled);
+}
+
+static void CAPTURE_applyState(void* userdata, void* vertexBuffer)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { INTERNAL_captureHandle(vertexBuffer) };
+	INTERNAL_captureWrite(cap, CAPTURE_APPLYSTATE, args, sizeof(args), NULL, 0);
+	cap->backend.applyState(cap->backend.userdata, vertexBuffer);
+}
+
+static void CAPTURE_drawPrimitives(void* userdata, int triStrip, int vertexOffset, int vertexCount)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[3] = { triStrip, vertexOffset, vertexCount };
+	INTERNAL_captureWrite(cap, CAPTURE_DRAWPRIMITIVES, args, sizeof(args), NULL, 0);
+	cap->backend.drawPrimitives(cap->backend.userdata, triStrip, vertexOffset, vertexCount);
+}
+
+static void* CAPTURE_createRenderTarget(void* userdata, int width, int height)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	void *texture = cap->backend.createRenderTarget(cap->backend.userdata, width, height);
+	long long args[3] = { INTERNAL_captureHandle(texture), width, height };
+	INTERNAL_captureWrite(cap, CAPTURE_CREATERENDERTARGET, args, sizeof(args), NULL, 0);
+	return texture;
+}
+
+static void CAPTURE_setRenderTarget(void* userdata, void* texture)
+{
+	RenderCapture *cap = (RenderCapture*) userdata;
+	long long args[1] = { INTERNAL_captureHandle(texture) };
+	INTERNAL_captureWrite(cap, CAPTURE_SETRENDERTARGET, args, sizeof(args), NULL, 0);
+	cap->backend.setRenderTarget(cap->backend.userdata, texture);
+}
+
+static void INTERNAL_swapBackend(RenderContext *gl, RenderBackend *backend)
+{
+	#define CAPTURE_SWAP(x) \
+		{ \
+			RenderBackend tmp; \
+			tmp.x = gl->x; \
+			gl->x = backend->x; \
+			backend->x = tmp.x; \
+		}
+	CAPTURE_SWAP(userdata)
+	CAPTURE_SWAP(createVertexBuffer)
+	CAPTURE_SWAP(deleteVertexBuffer)
+	CAPTURE_SWAP(updateVertexBuffer)
+	CAPTURE_SWAP(createTexture)
+	CAPTURE_SWAP(deleteTexture)
+	CAPTURE_SWAP(updateTexture)
+	CAPTURE_SWAP(updateUniformBuffer)
+	CAPTURE_SWAP(updateShader)
+	CAPTURE_SWAP(updateSampler)
+	CAPTURE_SWAP(setViewport)
+	CAPTURE_SWAP(updateVertexTransform)
+	CAPTURE_SWAP(resetState)
+	CAPTURE_SWAP(toggleColorWriteMask)
+	CAPTURE_SWAP(updateBlendFunction)
+	CAPTURE_SWAP(toggleStencil)
+	CAPTURE_SWAP(updateStencilFunction)
+	CAPTURE_SWAP(toggleCullMode)
+	CAPTURE_SWAP(applyState)
+	CAPTURE_SWAP(drawPrimitives)
+	CAPTURE_SWAP(createRenderTarget)
+	CAPTURE_SWAP(setRenderTarget)
+	#undef CAPTURE_SWAP
+}
+
+static void INTERNAL_captureResources(RenderCapture *cap)
+{
+	RenderContext *gl = cap->gl;
+	long long args[7];
+	float viewport[2];
+	int i;
+
+	// Contents can't be read back, only the resources themselves
+	if (gl->vertexBuffer != NULL) {
+		args[0] = INTERNAL_captureHandle(gl->vertexBuffer);
+		args[1] = (long long) gl->vertexBufferSize;
+		INTERNAL_captureWrite(cap, CAPTURE_CREATEVERTEXBUFFER, args, sizeof(long long) * 2, NULL, 0);
+	}
+	for (i = 0; i < NVG_MAX_GEOMETRIES; i += 1) {
+		RenderGeometry *geom = &gl->geometries[i];
+		if (geom->vertexBuffer != NULL) {
+			args[0] = INTERNAL_captureHandle(geom->vertexBuffer);
+			args[1] = (long long) geom->vertexBufferSize;
+			INTERNAL_captureWrite(cap, CAPTURE_CREATEVERTEXBUFFER, args, sizeof(long long) * 2, NULL, 0);
+		}
+	}
+	for (i = 0; i < NVG_MAX_TEXTURES; i += 1) {
+		RenderTexture *tex = &gl->textures[i];
+		if (tex->userdata == NULL) {
+			continue;
+		}
+		args[0] = INTERNAL_captureHandle(tex->userdata);
+		if (tex->target) {
+			args[1] = tex->width;
+			args[2] = tex->height;
+			INTERNAL_captureWrite(cap, CAPTURE_CREATERENDERTARGET, args, sizeof(long long) * 3, NULL, 0);
+		} else {
+			args[1] = (tex->type == NVG_TEXTURE_RGBA);
+			args[2] = tex->width;
+			args[3] = tex->height;
+			args[4] = !!(tex->flags & NVG_IMAGE_NEAREST);
+			args[5] = !!(tex->flags & NVG_IMAGE_REPEATX);
+			args[6] = !!(tex->flags & NVG_IMAGE_REPEATY);
+			INTERNAL_captureWrite(cap, CAPTURE_CREATETEXTURE, args, sizeof(long long) * 7, NULL, 0);
+		}
+	}
+
+	viewport[0] = gl->viewWidth;
+	viewport[1] = gl->viewHeight;
+	INTERNAL_captureWrite(cap, CAPTURE_SETVIEWPORT, viewport, sizeof(viewport), NULL, 0);
+}
+
+int nvgGpuBeginCapture(NVGcontext *ctx, const char *path)
+{
+	RenderContext *gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	RenderCapture *cap;
+	int version = CAPTURE_VERSION;
+
+	if (gl->capture != NULL) {
+		return 0;
+	}
+
+	cap = (RenderCapture*) malloc(sizeof(RenderCapture));
+	if (cap == NULL) {
+		return 0;
+	}
+	memset(cap, '\0', sizeof(RenderCapture));
+	cap->gl = gl;
+	cap->file = fopen(path, "wb");
+	if (cap->file == NULL) {
+		free(cap);
+		return 0;
+	}
+	fwrite(CAPTURE_MAGIC, 1, 6, cap->file);
+	fwrite(&version, sizeof(int), 1, cap->file);
+	INTERNAL_captureResources(cap);
+
+	cap->backend.userdata = cap;
+	cap->backend.createVertexBuffer = CAPTURE_createVertexBuffer;
+	cap->backend.deleteVertexBuffer = CAPTURE_deleteVertexBuffer;
+	cap->backend.updateVertexBuffer = CAPTURE_updateVertexBuffer;
+	cap->backend.createTexture = CAPTURE_createTexture;
+	cap->backend.deleteTexture = CAPTURE_deleteTexture;
+	cap->backend.updateTexture = CAPTURE_updateTexture;
+	cap->backend.updateUniformBuffer = CAPTURE_updateUniformBuffer;
+	cap->backend.updateShader = CAPTURE_updateShader;
+	cap->backend.updateSampler = CAPTURE_updateSampler;
+	cap->backend.setViewport = CAPTURE_setViewport;
+	cap->backend.updateVertexTransform = CAPTURE_updateVertexTransform;
+	cap->backend.resetState = CAPTURE_resetState;
+	cap->backend.toggleColorWriteMask = CAPTURE_toggleColorWriteMask;
+	cap->backend.updateBlendFunction = CAPTURE_updateBlendFunction;
+	cap->backend.toggleStencil = CAPTURE_toggleStencil;
+	cap->backend.updateStencilFunction = CAPTURE_updateStencilFunction;
+	cap->backend.toggleCullMode = CAPTURE_toggleCullMode;
+	cap->backend.applyState = CAPTURE_applyState;
+	cap->backend.drawPrimitives = CAPTURE_drawPrimitives;
+	cap->backend.createRenderTarget = CAPTURE_createRenderTarget;
+	cap->backend.setRenderTarget = CAPTURE_setRenderTarget;
+
+	// The wrappers go into the context, the real backend into the capture
+	INTERNAL_swapBackend(gl, &cap->backend);
+	gl->capture = cap;
+	return 1;
+}
+
+static void INTERNAL_endCapture(RenderContext *gl)
+{
+	RenderCapture *cap = gl->capture;
+	if (cap == NULL) {
+		return;
+	}
+	INTERNAL_swapBackend(gl, &cap->backend);
+	gl->capture = NULL;
+	fclose(cap->file);
+	free(cap);
+}
+
+void nvgGpuEndCapture(NVGcontext *ctx)
+{
+	INTERNAL_endCapture((RenderContext*) nvgInternalParams(ctx)->userPtr);
+}
+
+// Capture replay, see nvgGpuReplayOpen
+
+typedef struct ReplayHandle
+{
+	long long id;
+	void *handle;
+	int texture;
+
+	// What the replayed commands are checked against
+	size_t size;
+	int width;
+	int height;
+	int bpp;
+} ReplayHandle;
+
+struct NVGgpuReplay
+{
+	RenderContext *gl;
+	FILE *file;
+	long start;
+	unsigned char *payload;
+	size_t cpayload;
+	ReplayHandle *handles;
+	int chandles;
+	int nhandles;
+
+	// The vertex buffer of the last applyState, for checking draws
+	void *vertexBuffer;
+	size_t vertexBufferSize;
+};
+
+// Minimum payload size of each record, in CAPTURE_* order
+static const size_t INTERNAL_captureArgs[CAPTURE_COUNT] = {
+	sizeof(long long) * 2,	// CREATEVERTEXBUFFER
+	sizeof(long long) * 1,	// DELETEVERTEXBUFFER
+	sizeof(long long) * 3,	// UPDATEVERTEXBUFFER
+	sizeof(long long) * 7,	// CREATETEXTURE
+	sizeof(long long) * 1,	// DELETETEXTURE
+	sizeof(long long) * 5,	// UPDATETEXTURE
+	0,			// UPDATEUNIFORMBUFFER
+	sizeof(long long) * 3,	// UPDATESHADER
+	sizeof(long long) * 1,	// UPDATESAMPLER
+	sizeof(float) * 2,	// SETVIEWPORT
+	sizeof(float) * 6,	// UPDATEVERTEXTRANSFORM
+	0,			// RESETSTATE
+	sizeof(long long) * 1,	// TOGGLECOLORWRITEMASK
+	sizeof(long long) * 4,	// UPDATEBLENDFUNCTION
+	sizeof(long long) * 1,	// TOGGLESTENCIL
+	sizeof(long long) * 7,	// UPDATESTENCILFUNCTION
+	sizeof(long long) * 1,	// TOGGLECULLMODE
+	sizeof(long long) * 1,	// APPLYSTATE
+	sizeof(long long) * 3,	// DRAWPRIMITIVES
+	sizeof(long long) * 3,	// CREATERENDERTARGET
+	sizeof(long long) * 1,	// SETRENDERTARGET
+	0			// ENDFRAME
+};
+
+// Captured handles are mapped to the ones the replay backend created
+static ReplayHandle* INTERNAL_replayFindHandle(NVGgpuReplay *replay, long long id)
+{
+	if (id == 0) {
+		return NULL;
+	}
+	for (int i = replay->nhandles - 1; i >= 0; i -= 1) {
+		if (replay->handles[i].id == id) {
+			return &replay->handles[i];
+		}
+	}
+	return NULL;
+}
+
+// Captures are untrusted, so sizes are checked before anything is multiplied
+static int INTERNAL_replaySize(long long count, long long stride, size_t *size)
+{
+	if (count < 0 || stride < 0 || count > INT_MAX || stride > INT_MAX) {
+		return 0;
+	}
+	if (stride != 0 && (unsigned long long) count > SIZE_MAX / (unsigned long long) stride) {
+		return 0;
+	}
+	*size = (size_t) count * (size_t) stride;
+	return 1;
+}
+
+static ReplayHandle* INTERNAL_replayAddHandle(NVGgpuReplay *replay, long long id, void *handle, int texture)
+{
+	if (id == 0 || handle == NULL) {
+		// Failed to create, either when capturing or now
+		if (handle != NULL) {
+			if (texture) {
+				replay->gl->deleteTexture(replay->gl->userdata, handle);
+			} else {
+				replay->gl->deleteVertexBuffer(replay->gl->userdata, handle);
+			}
+		}
+		return NULL;
+	}
+	if (replay->nhandles == replay->chandles) {
+		ReplayHandle *handles;
+		int chandles = INTERNAL_maxi(replay->nhandles + 1, 128) + replay->chandles / 2; // 1.5x Overallocate
+		handles = (ReplayHandle*) realloc(replay->handles, sizeof(ReplayHandle) * chandles);
+		if (handles == NULL) {
+			if (texture) {
+				replay->gl->deleteTexture(replay->gl->userdata, handle);
+			} else {
+				replay->gl->deleteVertexBuffer(replay->gl->userdata, handle);
+			}
+			return NULL;
+		}
+		replay->handles = handles;
+		replay->chandles = chandles;
+	}
+	memset(&replay->handles[replay->nhandles], '\0', sizeof(ReplayHandle));
+	replay->handles[replay->nhandles].id = id;
+	replay->handles[replay->nhandles].handle = handle;
+	replay->handles[replay->nhandles].texture = texture;
+	return &replay->handles[replay->nhandles++];
+}
+
+static void* INTERNAL_replayRemoveHandle(NVGgpuReplay *replay, long long id)
+{
+	for (int i = replay->nhandles - 1; i >= 0; i -= 1) {
+		if (replay->handles[i].id == id) {
+			void *handle = replay->handles[i].handle;
+			replay->handles[i] = replay->handles[--replay->nhandles];
+			return handle;
+		}
+	}
+	return NULL;
+}
+
+static void INTERNAL_replayDeleteHandles(NVGgpuReplay *replay)
+{
+	RenderContext *gl = replay->gl;
+	for (int i = 0; i < replay->nhandles; i += 1) {
+		ReplayHandle *h = &replay->handles[i];
+		if (h->handle == NULL) {
+			continue;
+		}
+		if (h->texture) {
+			gl->deleteTexture(gl->userdata, h->handle);
+		} else {
+			gl->deleteVertexBuffer(gl->userdata, h->handle);
+		}
+	}
+	replay->nhandles = 0;
+	replay->vertexBuffer = NULL;
+	replay->vertexBufferSize = 0;
+}
+
+NVGgpuReplay* nvgGpuReplayOpen(NVGcontext *ctx, const char *path)
+{
+	NVGgpuReplay *replay;
+	char magic[6];
+	int version;
+
+	replay = (NVGgpuReplay*) malloc(sizeof(NVGgpuReplay));
+	if (replay == NULL) {
+		return NULL;
+	}
+	memset(replay, '\0', sizeof(NVGgpuReplay));
+	replay->gl = (RenderContext*) nvgInternalParams(ctx)->userPtr;
+	replay->file = fopen(path, "rb");
+	if (replay->file == NULL) {
+		free(replay);
+		return NULL;
+	}
+	if (	fread(magic, 1, 6, replay->file) != 6 ||
+		memcmp(magic, CAPTURE_MAGIC, 6) != 0 ||
+		fread(&version, sizeof(int), 1, replay->file) != 1 ||
+		version != CAPTURE_VERSION	) {
+		fclose(replay->file);
+		free(replay);
+		return NULL;
+	}
+	replay->start = ftell(replay->file);
+	return replay;
+}
+
+int nvgGpuReplayFrame(NVGgpuReplay *replay)
+{
+	RenderContext *gl = replay->gl;
+	int header[2];
+
+	while (fread(header, sizeof(header), 1, replay->file) == 1) {
+		RenderCaptureOp op = (RenderCaptureOp) header[0];
+		size_t length = (size_t) header[1];
+		long long *args;
+		float *fargs;
+		unsigned char *blob;
+		size_t blobLength, size;
+		ReplayHandle *h;
+
+		if (header[0] < 0 || op >= CAPTURE_COUNT || header[1] < 0) {
+			return 0;
+		}
+		if (length > replay->cpayload) {
+			unsigned char *payload = (unsigned char*) realloc(replay->payload, length);
+			if (payload == NULL) {
+				return 0;
+			}
+			replay->payload = payload;
+			replay->cpayload = length;
+		}
+		if (length > 0 && fread(replay->payload, length, 1, replay->file) != 1) {
+			return 0;
+		}
+		if (length < INTERNAL_captureArgs[op]) {
+			return 0;
+		}
+		args = (long long*) replay->payload;
+		fargs = (float*) replay->payload;
+		blob = replay->payload + INTERNAL_captureArgs[op];
+		blobLength = length - INTERNAL_captureArgs[op];
+
+		switch (op)
+		{
+		case CAPTURE_CREATEVERTEXBUFFER:
+			if (args[1] < 0 || (unsigned long long) args[1] > SIZE_MAX) {
+				return 0;
+			}
+			h = INTERNAL_replayAddHandle(
+				replay,
+				args[0],
+				gl->createVertexBuffer(gl->userdata, (size_t) args[1]),
+				0
+			);
+			if (h != NULL) {
+				h->size = (size_t) args[1];
+			}
+			break;
+		case CAPTURE_DELETEVERTEXBUFFER:
+		{
+			void *buffer = INTERNAL_replayRemoveHandle(replay, args[0]);
+			if (buffer != NULL) {
+				if (buffer == replay->vertexBuffer) {
+					replay->vertexBuffer = NULL;
+					replay->vertexBufferSize = 0;
+				}
+				gl->deleteVertexBuffer(gl->userdata, buffer);
+			}
+			break;
+		}
+		case CAPTURE_UPDATEVERTEXBUFFER:
+			h = INTERNAL_replayFindHandle(replay, args[0]);
+			if (	h == NULL ||
+				h->texture ||
+				!INTERNAL_replaySize(args[1], args[2], &size) ||
+				size > blobLength ||
+				size > h->size	) {
+				return 0;
+			}
+			gl->updateVertexBuffer(
+				gl->userdata,
+				h->handle,
+				blob,
+				(int) args[1],
+				(size_t) args[2]
+			);
+			break;
+		case CAPTURE_CREATETEXTURE:
+			if (args[2] <= 0 || args[2] > INT_MAX || args[3] <= 0 || args[3] > INT_MAX) {
+				return 0;
+			}
+			h = INTERNAL_replayAddHandle(
+				replay,
+				args[0],
+				gl->createTexture(
+					gl->userdata,
+					(int) args[1],
+					(int) args[2],
+					(int) args[3],
+					(int) args[4],
+					(int) args[5],
+					(int) args[6]
+				),
+				1
+			);
+			if (h != NULL) {
+				h->width = (int) args[2];
+				h->height = (int) args[3];
+				h->bpp = args[1] ? 4 : 1;
+			}
+			break;
+		case CAPTURE_DELETETEXTURE:
+		{
+			void *texture = INTERNAL_replayRemoveHandle(replay, args[0]);
+			if (texture != NULL) {
+				gl->deleteTexture(gl->userdata, texture);
+			}
+			break;
+		}
+		case CAPTURE_UPDATETEXTURE:
+			h = INTERNAL_replayFindHandle(replay, args[0]);
+			if (	h == NULL ||
+				!h->texture ||
+				args[1] < 0 || args[1] > h->width ||
+				args[2] < 0 || args[2] > h->height ||
+				args[3] < 0 || args[3] > h->width - args[1] ||
+				args[4] < 0 || args[4] > h->height - args[2] ||
+				!INTERNAL_replaySize(args[3] * args[4], h->bpp, &size) ||
+				size > blobLength	) {
+				return 0;
+			}
+			gl->updateTexture(
+				gl->userdata,
+				h->handle,
+				(int) args[1],
+				(int) args[2],
+				(int) args[3],
+				(int) args[4],
+				blob
+			);
+			break;
+		case CAPTURE_UPDATEUNIFORMBUFFER:
+			gl->updateUniformBuffer(gl->userdata, blob, blobLength);
+			break;
+		case CAPTURE_UPDATESHADER:
+			gl->updateShader(gl->userdata, (int) args[0], (int) args[1], (int) args[2]);
+			break;
+		case CAPTURE_UPDATESAMPLER:
+			h = INTERNAL_replayFindHandle(replay, args[0]);
+			if (h == NULL || !h->texture) {
+				return 0;
+			}
+			gl->updateSampler(gl->userdata, h->handle);
+			break;
+		case CAPTURE_SETVIEWPORT:
+			gl->setViewport(gl->userdata, fargs[0], fargs[1]);
+			break;
+		case CAPTURE_UPDATEVERTEXTRANSFORM:
+			gl->updateVertexTransform(gl->userdata, fargs);
+			break;
+		case CAPTURE_RESETSTATE:
+			gl->resetState(gl->userdata);
+			break;
+		case CAPTURE_TOGGLECOLORWRITEMASK:
+			gl->toggleColorWriteMask(gl->userdata, (int) args[0]);
+			break;
+		case CAPTURE_UPDATEBLENDFUNCTION:
+		{
+			NVGcompositeOperationState blendOp;
+			blendOp.srcRGB = (int) args[0];
+			blendOp.dstRGB = (int) args[1];
+			blendOp.srcAlpha = (int) args[2];
+			blendOp.dstAlpha = (int) args[3];
+			gl->updateBlendFunction(gl->userdata, blendOp);
+			break;
+		}
+		case CAPTURE_TOGGLESTENCIL:
+			gl->toggleStencil(gl->userdata, (int) args[0]);
+			break;
+		case CAPTURE_UPDATESTENCILFUNCTION:
+			gl->updateStencilFunction(
+				gl->userdata,
+				(nvgStencilCompareFunction) args[0],
+				(nvgStencilOperation) args[1],
+				(nvgStencilOperation) args[2],
+				(nvgStencilOperation) args[3],
+				(nvgStencilOperation) args[4],
+				(nvgStencilOperation) args[5],
+				(nvgStencilOperation) args[6]
+			);
+			break;
+		case CAPTURE_TOGGLECULLMODE:
+			gl->toggleCullMode(gl->userdata, (int) args[0]);
+			break;
+		case CAPTURE_APPLYSTATE:
+			h = INTERNAL_replayFindHandle(replay, args[0]);
+			if (h == NULL || h->texture) {
+				return 0;
+			}
+			replay->vertexBuffer = h->handle;
+			replay->vertexBufferSize = h->size;
+			gl->applyState(gl->userdata, h->handle);
+			break;
+		case CAPTURE_DRAWPRIMITIVES:
+			if (	args[1] < 0 || args[1] > INT_MAX ||
+				args[2] < 0 || args[2] > INT_MAX ||
+				!INTERNAL_replaySize(args[1] + args[2], sizeof(NVGvertex), &size) ||
+				size > replay->vertexBufferSize	) {
+				return 0;
+			}
+			gl->drawPrimitives(gl->userdata, (int) args[0], (int) args[1], (int) args[2]);
+			break;
+		case CAPTURE_CREATERENDERTARGET:
+			if (args[1] <= 0 || args[1] > INT_MAX || args[2] <= 0 || args[2] > INT_MAX) {
+				return 0;
+			}
+			h = INTERNAL_replayAddHandle(
+				replay,
+				args[0],
+				gl->createRenderTarget(gl->userdata, (int) args[1], (int) args[2]),
+				1
+			);
+			if (h != NULL) {
+				h->width = (int) args[1];
+				h->height = (int) args[2];
+				h->bpp = 4;
+			}
+			break;
+		case CAPTURE_SETRENDERTARGET:
+			// 0 is the default target, any other handle has to exist
+			h = INTERNAL_replayFindHandle(replay, args[0]);
+			if (args[0] != 0 && (h == NULL || !h->texture)) {
+				return 0;
+			}
+			gl->setRenderTarget(gl->userdata, (h != NULL) ? h->handle : NULL);
+			break;
+		case CAPTURE_ENDFRAME:
+			return 1;
+		default:
+			return 0;
+		}
+	}
+	return 0;
+}
+
+void nvgGpuReplayRewind(NVGgpuReplay *replay)
+{
+	INTERNAL_replayDeleteHandles(replay);
+	fseek(replay->file, replay->start, SEEK_SET);
+}
+
+void nvgGpuReplayClose(NVGgpuReplay *replay)
+{
+	INTERNAL_replayDeleteHandles(replay);
+	fclose(replay->file);
+	free(replay->payload);
+	free(replay->handles);
+	free(replay);
+}
@@ -71,6 +71,7 @@ typedef void (NVGGPUCALL *nvg_gpu_pfn_updateShader)(void* userdata, int enableAA
 typedef void (NVGGPUCALL *nvg_gpu_pfn_updateSampler)(void* userdata, void* texture);
 
 typedef void (NVGGPUCALL *nvg_gpu_pfn_setViewport)(void* userdata, float width, float height);
+typedef void (NVGGPUCALL *nvg_gpu_pfn_updateVertexTransform)(void* userdata, float* xform);
 
 typedef void (NVGGPUCALL *nvg_gpu_pfn_resetState)(void* userdata);
 typedef void (NVGGPUCALL *nvg_gpu_pfn_toggleColorWriteMask)(void* userdata, int enabled);
@@ -90,6 +91,9 @@ typedef void (NVGGPUCALL *nvg_gpu_pfn_toggleCullMode)(void* userdata, int enable
 typedef void (NVGGPUCALL *nvg_gpu_pfn_applyState)(void* userdata, void* vertexBuffer);
 typedef void (NVGGPUCALL *nvg_gpu_pfn_drawPrimitives)(void* userdata, int triStrip, int vertexOffset, int vertexCount);
 
+typedef void* (NVGGPUCALL *nvg_gpu_pfn_createRenderTarget)(void* userdata, int width, int height);
+typedef void (NVGGPUCALL *nvg_gpu_pfn_setRenderTarget)(void* userdata, void* texture);
+
 NVGGPUAPI NVGcontext* nvgGpuCreate(
 	void *userdata,
 	nvg_gpu_pfn_createContext createContext,
@@ -104,6 +108,7 @@ NVGGPUAPI NVGcontext* nvgGpuCreate(
 	nvg_gpu_pfn_updateShader updateShader,
 	nvg_gpu_pfn_updateSampler updateSampler,
 	nvg_gpu_pfn_setViewport setViewport,
+	nvg_gpu_pfn_updateVertexTransform updateVertexTransform,
 	nvg_gpu_pfn_resetState resetState,
 	nvg_gpu_pfn_toggleColorWriteMask toggleColorWriteMask,
 	nvg_gpu_pfn_updateBlendFunction updateBlendFunction,
@@ -111,10 +116,193 @@ NVGGPUAPI NVGcontext* nvgGpuCreate(
 	nvg_gpu_pfn_updateStencilFunction updateStencilFunction,
 	nvg_gpu_pfn_toggleCullMode toggleCullMode,
 	nvg_gpu_pfn_applyState applyState,
-	nvg_gpu_pfn_drawPrimitives drawPrimitives
+	nvg_gpu_pfn_drawPrimitives drawPrimitives,
+	nvg_gpu_pfn_createRenderTarget createRenderTarget,
+	nvg_gpu_pfn_setRenderTarget setRenderTarget
 );
 NVGGPUAPI void nvgGpuDelete(NVGcontext *ctx);
 
+/* Null backend: every callback is a no-op that only counts what it was
+ * given. Useful for measuring the CPU side of the renderer without a GPU.
+ * State change counts are per callback invocation, redundant or not.
+ */
+typedef struct NVGgpuNullCounters
+{
+	int drawCalls;
+	int verticesDrawn;
+	int vertexUploads;
+	int verticesUploaded;
+	size_t vertexBytesUploaded;
+	int uniformUploads;
+	size_t uniformBytesUploaded;
+	int textureUploads;
+	size_t texelsUploaded;
+	int vertexBuffersCreated;
+	int texturesCreated;
+
+	// State changes
+	int shaderChanges;
+	int samplerChanges;
+	int viewportChanges;
+	int vertexTransformChanges;
+	int stateResets;
+	int colorWriteMaskChanges;
+	int blendFunctionChanges;
+	int stencilToggles;
+	int stencilFunctionChanges;
+	int cullModeChanges;
+	int stateApplies;
+	int renderTargetChanges;
+} NVGgpuNullCounters;
+
+NVGGPUAPI NVGcontext* nvgGpuCreateNull(void);
+NVGGPUAPI void nvgGpuGetNullCounters(NVGcontext *ctx, NVGgpuNullCounters *counters);
+NVGGPUAPI void nvgGpuResetNullCounters(NVGcontext *ctx);
+
+/* Frame statistics, for the frame finished by the last nvgEndFrame. The
+ * nanovg counts and stage times are reset by nvgBeginFrame, so read these
+ * after nvgEndFrame. Calls are counted per nanovg draw when flushed: calls
+ * inside static geometry and instances count once per draw, as well as
+ * geometryCalls counting the geometry itself. Uploads include everything
+ * sent to the backend since the previous flush, including textures and
+ * static geometry. Stage times are 0 unless NVG_TICKS is defined.
+ */
+typedef struct NVGframeStats
+{
+	// nanovg
+	int drawCalls;
+	int fillTriangles;
+	int strokeTriangles;
+	int textTriangles;
+
+	// Renderer calls by type
+	int fillCalls;
+	int convexFillCalls;
+	int strokeCalls;
+	int triangleCalls;
+	int geometryCalls;
+	int targetCalls;
+
+	// Backend work
+	int backendDrawCalls;
+	int stencilPasses;
+	int verticesUploaded;
+	int vertexBytesUploaded;
+	int uniformBytesUploaded;
+	int textureBytesUploaded;
+
+	// CPU time, in milliseconds
+	float flattenTime;
+	float expandTime;
+	float flushTime;
+} NVGframeStats;
+
+NVGGPUAPI void nvgGetFrameStats(NVGcontext *ctx, NVGframeStats *stats);
+
+/* Buffer sizes: The per frame buffers, nanovg_gpu's calls, paths, vertices
+ * and uniforms as well as nanovg's commands and path cache, grow to fit the
+ * largest frame and by default never shrink. With a trim policy, a buffer is
+ * shrunk in nvgEndFrame once it has used less than fraction of its capacity
+ * for frames frames in a row, keeping 1.5x its use as headroom. frames = 0
+ * turns trimming off. The GPU vertex buffer is recreated when it shrinks.
+ *
+ * Reserve grows each buffer to at least the hint up front, and trimming
+ * never goes below it, so steady frames never realloc. The used sizes of a
+ * typical frame make a good hint. Sizes are in elements, not bytes.
+ */
+typedef struct NVGgpuBufferSizes
+{
+	// nanovg_gpu
+	int calls;
+	int paths;
+	int verts;
+	int uniforms;
+	int instanceCalls;
+
+	// nanovg
+	int commands;
+	int cachePoints;
+	int cachePaths;
+	int cacheVerts;
+} NVGgpuBufferSizes;
+
+NVGGPUAPI void nvgGpuSetTrimPolicy(NVGcontext *ctx, int frames, float fraction);
+NVGGPUAPI void nvgGpuReserve(NVGcontext *ctx, const NVGgpuBufferSizes *hint);
+
+/* Current capacity of each buffer, and the most of it used by the last frame.
+ * Either may be NULL.
+ */
+NVGGPUAPI void nvgGpuGetBufferSizes(NVGcontext *ctx, NVGgpuBufferSizes *capacity, NVGgpuBufferSizes *used);
+
+/* Static geometry: Everything drawn between BeginGeometry and EndGeometry is
+ * tessellated in local coordinates (the current transform and scissor are
+ * ignored) and uploaded once into its own vertex buffer. DrawGeometry then
+ * draws it with the current transform, applied in the vertex shader, so
+ * repeated draws cost only a transform update and the draw calls.
+ *
+ * Recording must happen between nvgBeginFrame and nvgEndFrame. Geometry is
+ * tessellated at scale 1, so drawing it heavily scaled up will show facets.
+ * Deleted geometry can no longer be drawn, but draws already queued this
+ * frame still happen; its id and vertex buffer are released at the flush.
+ */
+NVGGPUAPI void nvgGpuBeginGeometry(NVGcontext *ctx);
+NVGGPUAPI int nvgGpuEndGeometry(NVGcontext *ctx);
+NVGGPUAPI void nvgGpuDrawGeometry(NVGcontext *ctx, int geometry);
+NVGGPUAPI void nvgGpuDeleteGeometry(NVGcontext *ctx, int geometry);
+
+/* Draws static geometry once per transform. Each transform is 6 floats in
+ * nvgTransform order, applied on top of the current transform.
+ */
+NVGGPUAPI void nvgGpuDrawGeometryInstanced(NVGcontext *ctx, int geometry, const float *xforms, int count);
+
+/* Instancing: Like static geometry, but the recording only lives for the
+ * current frame. Everything drawn between BeginInstances and EndInstances is
+ * tessellated and uploaded once, then drawn once per transform.
+ */
+NVGGPUAPI void nvgGpuBeginInstances(NVGcontext *ctx);
+NVGGPUAPI void nvgGpuEndInstances(NVGcontext *ctx, const float *xforms, int count);
+
+/* Render targets: CreateRenderTarget returns an image handle for a
+ * premultiplied RGBA texture with a stencil buffer, deleted with
+ * nvgDeleteImage. BindRenderTarget redirects everything drawn after it, in
+ * draw order, to that image until it is called again with 0. Once unbound,
+ * the image can be drawn like any other, e.g. with nvgImageQuad.
+ *
+ * The render target has the same pixel coordinates as the image, the current
+ * transform and scissor are still applied. The backend's setRenderTarget
+ * receives NULL when the default target should be restored.
+ */
+NVGGPUAPI int nvgGpuCreateRenderTarget(NVGcontext *ctx, int width, int height);
+NVGGPUAPI void nvgGpuBindRenderTarget(NVGcontext *ctx, int image);
+
+/* Capture: Every backend callback made between BeginCapture and EndCapture is
+ * written to path along with its payload (vertex data, uniform blocks,
+ * texture uploads), one frame per nvgEndFrame. Call these between frames.
+ * Returns 0 if the file can't be opened or a capture is already running.
+ *
+ * Resources created before the capture are recreated on replay, but their
+ * contents can't be read back, so textures and static geometry uploaded
+ * before BeginCapture replay empty. Start capturing before loading the
+ * scene to get everything. Files are in native byte order.
+ */
+NVGGPUAPI int nvgGpuBeginCapture(NVGcontext *ctx, const char *path);
+NVGGPUAPI void nvgGpuEndCapture(NVGcontext *ctx);
+
+/* Replay: Feeds a capture into the backend of ctx, which can be any context
+ * from nvgGpuCreate (FNA3D, null, software...). ReplayFrame returns 1 once a
+ * whole frame has been submitted and 0 at the end of the file. Rewind and
+ * Close delete all resources the replay created.
+ *
+ * The replay calls the backend directly, so do not replay between
+ * nvgBeginFrame and nvgEndFrame.
+ */
+typedef struct NVGgpuReplay NVGgpuReplay;
+
+NVGGPUAPI NVGgpuReplay* nvgGpuReplayOpen(NVGcontext *ctx, const char *path);
+NVGGPUAPI int nvgGpuReplayFrame(NVGgpuReplay *replay);
+NVGGPUAPI void nvgGpuReplayRewind(NVGgpuReplay *replay);
+NVGGPUAPI void nvgGpuReplayClose(NVGgpuReplay *replay);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,851 @@
+#include "nanovg_soft.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Mirrors CALLBACK_* in example_native.c, with FNA3D replaced by a rasterizer
+
+typedef struct SoftTexture
+{
+	int isRGBA;
+	int width;
+	int height;
+	int nearest;
+	int repeatX;
+	int repeatY;
+	unsigned char *pixels;
+
+	// Render targets only
+	unsigned char *stencil;
+} SoftTexture;
+
+typedef struct SoftBuffer
+{
+	unsigned char *data;
+	size_t size;
+} SoftBuffer;
+
+typedef struct SoftState
+{
+	// Effect
+	float inverseViewSize[2];
+	float vertexXform[6];
+	float frag[11][4];
+	int edgeAA;
+	int type;
+	int texType;
+
+	// Blend
+	NVGcompositeOperationState blendOp;
+	int colorWrite;
+
+	// Depth/stencil, the reference value is always 0
+	int stencilEnable;
+	nvgStencilCompareFunction stencilFunc;
+	nvgStencilOperation stencilFail;
+	nvgStencilOperation stencilPass;
+	nvgStencilOperation ccwStencilFail;
+	nvgStencilOperation ccwStencilPass;
+
+	// Rasterizer
+	int cullClockwise;
+
+	SoftBuffer *vertexBuffer;
+} SoftState;
+
+struct NVGsoftDevice
+{
+	SoftTexture backbuffer;
+	SoftTexture *target;
+	SoftTexture *sampler;
+
+	// Set by the callbacks, copied to applied by applyState
+	SoftState pending;
+	SoftState applied;
+
+	NVGsoftStats stats;
+	unsigned short *overdraw;
+};
+
+typedef struct SoftVertex
+{
+	float x; // Pixel position
+	float y;
+	float fx; // fpos
+	float fy;
+	float u; // ftcoord
+	float v;
+} SoftVertex;
+
+// Pixel shader, see nanovg.fx
+
+static inline float INTERNAL_saturate(float a)
+{
+	return (a < 0.0f) ? 0.0f : ((a > 1.0f) ? 1.0f : a);
+}
+
+static inline void INTERNAL_mat3xFloat2(const float (*m)[4], float x, float y, float *ox, float *oy)
+{
+	*ox = m[0][0] * x + m[1][0] * y + m[2][0];
+	*oy = m[0][1] * x + m[1][1] * y + m[2][1];
+}
+
+static float INTERNAL_sdroundrect(float px, float py, float ex, float ey, float rad)
+{
+	float dx = fabsf(px) - (ex - rad);
+	float dy = fabsf(py) - (ey - rad);
+	float mx = fmaxf(dx, 0.0f);
+	float my = fmaxf(dy, 0.0f);
+	return fminf(fmaxf(dx, dy), 0.0f) + sqrtf(mx * mx + my * my) - rad;
+}
+
+static inline int INTERNAL_wrap(int i, int n, int repeat)
+{
+	if (repeat) {
+		i %= n;
+		return (i < 0) ? (i + n) : i;
+	}
+	return (i < 0) ? 0 : ((i >= n) ? (n - 1) : i);
+}
+
+static void INTERNAL_texel(SoftTexture *tex, int x, int y, float *out)
+{
+	const unsigned char *p;
+	x = INTERNAL_wrap(x, tex->width, tex->repeatX);
+	y = INTERNAL_wrap(y, tex->height, tex->repeatY);
+	if (tex->isRGBA) {
+		p = &tex->pixels[(y * tex->width + x) * 4];
+		out[0] = p[0] / 255.0f;
+		out[1] = p[1] / 255.0f;
+		out[2] = p[2] / 255.0f;
+		out[3] = p[3] / 255.0f;
+	} else {
+		// Alpha8 samples as (0, 0, 0, a)
+		out[0] = 0.0f;
+		out[1] = 0.0f;
+		out[2] = 0.0f;
+		out[3] = tex->pixels[y * tex->width + x] / 255.0f;
+	}
+}
+
+static void INTERNAL_tex2D(SoftTexture *tex, float u, float v, float *out)
+{
+	float tx, ty, fx, fy, t[4][4];
+	int x, y, i;
+
+	// Unbound samplers read as transparent black
+	if (tex == NULL || tex->pixels == NULL) {
+		out[0] = out[1] = out[2] = out[3] = 0.0f;
+		return;
+	}
+
+	tx = u * tex->width;
+	ty = v * tex->height;
+	if (tex->nearest) {
+		INTERNAL_texel(tex, (int) floorf(tx), (int) floorf(ty), out);
+		return;
+	}
+
+	tx -= 0.5f;
+	ty -= 0.5f;
+	x = (int) floorf(tx);
+	y = (int) floorf(ty);
+	fx = tx - x;
+	fy = ty - y;
+	INTERNAL_texel(tex, x, y, t[0]);
+	INTERNAL_texel(tex, x + 1, y, t[1]);
+	INTERNAL_texel(tex, x, y + 1, t[2]);
+	INTERNAL_texel(tex, x + 1, y + 1, t[3]);
+	for (i = 0; i < 4; i += 1) {
+		float top = t[0][i] + (t[1][i] - t[0][i]) * fx;
+		float bottom = t[2][i] + (t[3][i] - t[2][i]) * fx;
+		out[i] = top + (bottom - top) * fy;
+	}
+}
+
+static inline void INTERNAL_texType(int texType, float *color)
+{
+	if (texType == 1) {
+		color[0] *= color[3];
+		color[1] *= color[3];
+		color[2] *= color[3];
+	} else if (texType == 2) {
+		color[0] = color[1] = color[2] = color[3];
+	}
+}
+
+// Returns 0 if the fragment is discarded
+static int INTERNAL_pixelShader(NVGsoftDevice *dev, const SoftVertex *in, float *out)
+{
+	const SoftState *s = &dev->applied;
+	const float (*frag)[4] = s->frag;
+	float scissor, strokeAlpha, sx, sy, px, py, d, mul;
+	int i;
+
+	// scissorMask
+	INTERNAL_mat3xFloat2(&frag[0], in->fx, in->fy, &sx, &sy);
+	sx = 0.5f - (fabsf(sx) - frag[8][0]) * frag[8][2];
+	sy = 0.5f - (fabsf(sy) - frag[8][1]) * frag[8][3];
+	scissor = INTERNAL_saturate(sx) * INTERNAL_saturate(sy);
+
+	// strokeMask
+	if (s->edgeAA) {
+		strokeAlpha = fminf(1.0f, (1.0f - fabsf(in->u * 2.0f - 1.0f)) * frag[10][0]) * fminf(1.0f, in->v);
+		if (strokeAlpha < frag[10][1]) {
+			return 0;
+		}
+	} else {
+		strokeAlpha = 1.0f;
+	}
+
+	if (s->type == 0) { // Gradient
+		INTERNAL_mat3xFloat2(&frag[3], in->fx, in->fy, &px, &py);
+		d = INTERNAL_sdroundrect(px, py, frag[9][0], frag[9][1], frag[9][2]);
+		d = INTERNAL_saturate((d + frag[9][3] * 0.5f) / frag[9][3]);
+		mul = strokeAlpha * scissor;
+		for (i = 0; i < 4; i += 1) {
+			out[i] = (frag[6][i] + (frag[7][i] - frag[6][i]) * d) * mul;
+		}
+	} else if (s->type == 1) { // Image
+		INTERNAL_mat3xFloat2(&frag[3], in->fx, in->fy, &px, &py);
+		INTERNAL_tex2D(dev->sampler, px / frag[9][0], py / frag[9][1], out);
+		INTERNAL_texType(s->texType, out);
+		mul = strokeAlpha * scissor;
+		for (i = 0; i < 4; i += 1) {
+			out[i] *= frag[6][i] * mul;
+		}
+	} else if (s->type == 2) { // Stencil fill
+		out[0] = out[1] = out[2] = out[3] = 1.0f;
+	} else if (s->type == 3) { // Textured tris
+		INTERNAL_tex2D(dev->sampler, in->u, in->v, out);
+		INTERNAL_texType(s->texType, out);
+		for (i = 0; i < 4; i += 1) {
+			out[i] *= scissor * frag[6][i];
+		}
+	} else {
+		return 0; // Should never get here!!!
+	}
+	return 1;
+}
+
+// Output merger
+
+static int INTERNAL_stencilTest(nvgStencilCompareFunction func, unsigned char value)
+{
+	// (ref & mask) func (stencil & mask), ref is always 0
+	switch (func)
+	{
+	case NVG_STENCILCOMPAREFUNCTION_ALWAYS:		return 1;
+	case NVG_STENCILCOMPAREFUNCTION_NEVER:		return 0;
+	case NVG_STENCILCOMPAREFUNCTION_LESS:		return 0 < value;
+	case NVG_STENCILCOMPAREFUNCTION_LESSEQUAL:	return 1;
+	case NVG_STENCILCOMPAREFUNCTION_EQUAL:		return value == 0;
+	case NVG_STENCILCOMPAREFUNCTION_GREATEREQUAL:	return value == 0;
+	case NVG_STENCILCOMPAREFUNCTION_GREATER:	return 0;
+	case NVG_STENCILCOMPAREFUNCTION_NOTEQUAL:	return value != 0;
+	default: return 1;
+	}
+}
+
+static unsigned char INTERNAL_stencilOp(nvgStencilOperation op, unsigned char value)
+{
+	switch (op)
+	{
+	case NVG_STENCILOPERATION_KEEP:			return value;
+	case NVG_STENCILOPERATION_ZERO:			return 0;
+	case NVG_STENCILOPERATION_REPLACE:		return 0;
+	case NVG_STENCILOPERATION_INCREMENT:		return (unsigned char) (value + 1);
+	case NVG_STENCILOPERATION_DECREMENT:		return (unsigned char) (value - 1);
+	case NVG_STENCILOPERATION_INCREMENTSATURATION:	return (value == 0xFF) ? value : (value + 1);
+	case NVG_STENCILOPERATION_DECREMENTSATURATION:	return (value == 0) ? value : (value - 1);
+	case NVG_STENCILOPERATION_INVERT:		return (unsigned char) ~value;
+	default: return value;
+	}
+}
+
+static int INTERNAL_validBlend(int factor)
+{
+	return factor >= NVG_ZERO && factor <= NVG_SRC_ALPHA_SATURATE && !(factor & (factor - 1));
+}
+
+static float INTERNAL_blendFactor(int factor, const float *src, const float *dst, int channel)
+{
+	switch (factor)
+	{
+	case NVG_ZERO:			return 0.0f;
+	case NVG_ONE:			return 1.0f;
+	case NVG_SRC_COLOR:		return src[channel];
+	case NVG_ONE_MINUS_SRC_COLOR:	return 1.0f - src[channel];
+	case NVG_DST_COLOR:		return dst[channel];
+	case NVG_ONE_MINUS_DST_COLOR:	return 1.0f - dst[channel];
+	case NVG_SRC_ALPHA:		return src[3];
+	case NVG_ONE_MINUS_SRC_ALPHA:	return 1.0f - src[3];
+	case NVG_DST_ALPHA:		return dst[3];
+	case NVG_ONE_MINUS_DST_ALPHA:	return 1.0f - dst[3];
+	case NVG_SRC_ALPHA_SATURATE:	return (channel == 3) ? 1.0f : fminf(src[3], 1.0f - dst[3]);
+	default: return 0.0f;
+	}
+}
+
+static void INTERNAL_blend(const SoftState *s, const float *color, unsigned char *pixel)
+{
+	NVGcompositeOperationState op = s->blendOp;
+	float src[4], dst[4], sf, df;
+	int i;
+
+	// Same fallback as the FNA3D backends
+	if (	!INTERNAL_validBlend(op.srcRGB) ||
+		!INTERNAL_validBlend(op.dstRGB) ||
+		!INTERNAL_validBlend(op.srcAlpha) ||
+		!INTERNAL_validBlend(op.dstAlpha)	)
+	{
+		op.srcRGB = NVG_ONE;
+		op.dstRGB = NVG_ONE_MINUS_SRC_ALPHA;
+		op.srcAlpha = NVG_ONE;
+		op.dstAlpha = NVG_ONE_MINUS_SRC_ALPHA;
+	}
+
+	// UNORM targets clamp the shader output before blending
+	for (i = 0; i < 4; i += 1) {
+		src[i] = INTERNAL_saturate(color[i]);
+		dst[i] = pixel[i] / 255.0f;
+	}
+	for (i = 0; i < 4; i += 1) {
+		sf = INTERNAL_blendFactor((i == 3) ? op.srcAlpha : op.srcRGB, src, dst, i);
+		df = INTERNAL_blendFactor((i == 3) ? op.dstAlpha : op.dstRGB, src, dst, i);
+		pixel[i] = (unsigned char) (INTERNAL_saturate(src[i] * sf + dst[i] * df) * 255.0f + 0.5f);
+	}
+}
+
+// Rasterizer
+
+static inline float INTERNAL_edge(const SoftVertex *a, const SoftVertex *b, float px, float py)
+{
+	return (b->x - a->x) * (py - a->y) - (b->y - a->y) * (px - a->x);
+}
+
+// Top-left fill rule, for triangles with a positive INTERNAL_edge area
+static inline int INTERNAL_topLeft(const SoftVertex *a, const SoftVertex *b)
+{
+	float dx = b->x - a->x;
+	float dy = b->y - a->y;
+	return (dy < 0.0f) || (dy == 0.0f && dx > 0.0f);
+}
+
+static void INTERNAL_vertex(NVGsoftDevice *dev, const NVGvertex *src, SoftVertex *dst)
+{
+	const SoftState *s = &dev->applied;
+	const float *t = s->vertexXform;
+	float x = t[0] * src->x + t[2] * src->y + t[4];
+	float y = t[1] * src->x + t[3] * src->y + t[5];
+
+	// Clip space to the viewport, which always covers the whole target
+	dst->x = x * s->inverseViewSize[0] * dev->target->width;
+	dst->y = y * s->inverseViewSize[1] * dev->target->height;
+	dst->fx = src->x;
+	dst->fy = src->y;
+	dst->u = src->u;
+	dst->v = src->v;
+}
+
+static void INTERNAL_triangle(NVGsoftDevice *dev, SoftVertex *v0, SoftVertex *v1, SoftVertex *v2)
+{
+	const SoftState *s = &dev->applied;
+	SoftTexture *target = dev->target;
+	SoftVertex *swap, frag;
+	float area, w0, w1, w2, px, py, color[4];
+	int tl0, tl1, tl2, clockwise, x, y, minX, minY, maxX, maxY;
+	nvgStencilOperation failOp, passOp;
+	unsigned char *stencil;
+
+	dev->stats.triangles += 1;
+
+	// Positive area is clockwise on screen, y points down
+	area = INTERNAL_edge(v0, v1, v2->x, v2->y);
+	if (area == 0.0f || isnan(area)) {
+		return;
+	}
+	clockwise = area > 0.0f;
+	if (clockwise && s->cullClockwise) {
+		dev->stats.culledTriangles += 1;
+		return;
+	}
+	if (!clockwise) {
+		swap = v1;
+		v1 = v2;
+		v2 = swap;
+		area = -area;
+	}
+
+	// Two-sided stencil, clockwise faces use the regular ops
+	failOp = clockwise ? s->stencilFail : s->ccwStencilFail;
+	passOp = clockwise ? s->stencilPass : s->ccwStencilPass;
+
+	minX = (int) floorf(fminf(v0->x, fminf(v1->x, v2->x)));
+	minY = (int) floorf(fminf(v0->y, fminf(v1->y, v2->y)));
+	maxX = (int) ceilf(fmaxf(v0->x, fmaxf(v1->x, v2->x)));
+	maxY = (int) ceilf(fmaxf(v0->y, fmaxf(v1->y, v2->y)));
+	minX = (minX > 0) ? minX : 0;
+	minY = (minY > 0) ? minY : 0;
+	maxX = (maxX < target->width - 1) ? maxX : (target->width - 1);
+	maxY = (maxY < target->height - 1) ? maxY : (target->height - 1);
+
+	tl0 = INTERNAL_topLeft(v1, v2);
+	tl1 = INTERNAL_topLeft(v2, v0);
+	tl2 = INTERNAL_topLeft(v0, v1);
+
+	for (y = minY; y <= maxY; y += 1) {
+		py = y + 0.5f;
+		for (x = minX; x <= maxX; x += 1) {
+			px = x + 0.5f;
+			w0 = INTERNAL_edge(v1, v2, px, py);
+			w1 = INTERNAL_edge(v2, v0, px, py);
+			w2 = INTERNAL_edge(v0, v1, px, py);
+			if (	(w0 < 0.0f || (w0 == 0.0f && !tl0)) ||
+				(w1 < 0.0f || (w1 == 0.0f && !tl1)) ||
+				(w2 < 0.0f || (w2 == 0.0f && !tl2))	)
+			{
+				continue;
+			}
+
+			// Screen space interpolation, there is no perspective
+			w0 /= area;
+			w1 /= area;
+			w2 = 1.0f - w0 - w1;
+			frag.fx = w0 * v0->fx + w1 * v1->fx + w2 * v2->fx;
+			frag.fy = w0 * v0->fy + w1 * v1->fy + w2 * v2->fy;
+			frag.u = w0 * v0->u + w1 * v1->u + w2 * v2->u;
+			frag.v = w0 * v0->v + w1 * v1->v + w2 * v2->v;
+
+			dev->stats.fragments += 1;
+			if (target == &dev->backbuffer && dev->overdraw[y * target->width + x] < 0xFFFF) {
+				dev->overdraw[y * target->width + x] += 1;
+			}
+
+			// Discarded fragments never reach the stencil ops
+			if (!INTERNAL_pixelShader(dev, &frag, color)) {
+				dev->stats.discardedFragments += 1;
+				continue;
+			}
+
+			if (s->stencilEnable) {
+				stencil = &target->stencil[y * target->width + x];
+				if (!INTERNAL_stencilTest(s->stencilFunc, *stencil)) {
+					*stencil = INTERNAL_stencilOp(failOp, *stencil);
+					dev->stats.stencilFailedFragments += 1;
+					continue;
+				}
+				*stencil = INTERNAL_stencilOp(passOp, *stencil);
+			}
+
+			if (s->colorWrite) {
+				INTERNAL_blend(s, color, &target->pixels[(y * target->width + x) * 4]);
+				dev->stats.writtenFragments += 1;
+			}
+		}
+	}
+}
+
+// Callbacks
+
+static void SOFT_createContext(void* userdata)
+{
+	NVG_NOTUSED(userdata);
+}
+
+static void SOFT_deleteContext(void* userdata)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->target = &dev->backbuffer;
+	dev->sampler = NULL;
+	dev->pending.vertexBuffer = NULL;
+	dev->applied.vertexBuffer = NULL;
+}
+
+static void* SOFT_createVertexBuffer(void* userdata, size_t size)
+{
+	SoftBuffer *buffer = (SoftBuffer*) malloc(sizeof(SoftBuffer));
+	NVG_NOTUSED(userdata);
+	if (buffer == NULL) {
+		return NULL;
+	}
+	buffer->data = (unsigned char*) malloc(size);
+	buffer->size = size;
+	if (buffer->data == NULL) {
+		free(buffer);
+		return NULL;
+	}
+	return buffer;
+}
+
+static void SOFT_deleteVertexBuffer(void* userdata, void* buffer)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	SoftBuffer *buf = (SoftBuffer*) buffer;
+	if (dev->pending.vertexBuffer == buf) {
+		dev->pending.vertexBuffer = NULL;
+	}
+	if (dev->applied.vertexBuffer == buf) {
+		dev->applied.vertexBuffer = NULL;
+	}
+	free(buf->data);
+	free(buf);
+}
+
+static void SOFT_updateVertexBuffer(void* userdata, void* buffer, void* ptr, int count, size_t stride)
+{
+	SoftBuffer *buf = (SoftBuffer*) buffer;
+	size_t len = count * stride;
+	NVG_NOTUSED(userdata);
+	if (len > buf->size) {
+		len = buf->size; // Same as a GPU, the overflow is dropped
+	}
+	memcpy(buf->data, ptr, len);
+}
+
+static SoftTexture* INTERNAL_createTexture(int isRGBA, int width, int height, int nearest, int repeatX, int repeatY, int isRenderTarget)
+{
+	SoftTexture *tex = (SoftTexture*) malloc(sizeof(SoftTexture));
+	if (tex == NULL) {
+		return NULL;
+	}
+	tex->isRGBA = isRGBA;
+	tex->width = width;
+	tex->height = height;
+	tex->nearest = nearest;
+	tex->repeatX = repeatX;
+	tex->repeatY = repeatY;
+
+	// Render targets start out cleared, like the FNA3D backends leave them
+	tex->pixels = (unsigned char*) calloc((size_t) width * height, isRGBA ? 4 : 1);
+	tex->stencil = isRenderTarget ? (unsigned char*) calloc((size_t) width * height, 1) : NULL;
+	if (tex->pixels == NULL || (isRenderTarget && tex->stencil == NULL)) {
+		free(tex->pixels);
+		free(tex->stencil);
+		free(tex);
+		return NULL;
+	}
+	return tex;
+}
+
+static void* SOFT_createTexture(void* userdata, int isRGBA, int width, int height, int nearest, int repeatX, int repeatY)
+{
+	NVG_NOTUSED(userdata);
+	return INTERNAL_createTexture(isRGBA, width, height, nearest, repeatX, repeatY, 0);
+}
+
+static void SOFT_deleteTexture(void* userdata, void* texture)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	SoftTexture *tex = (SoftTexture*) texture;
+	if (dev->sampler == tex) {
+		dev->sampler = NULL;
+	}
+	if (dev->target == tex) {
+		dev->target = &dev->backbuffer;
+	}
+	free(tex->pixels);
+	free(tex->stencil);
+	free(tex);
+}
+
+static void SOFT_updateTexture(void* userdata, void* texture, int x, int y, int w, int h, void* data)
+{
+	SoftTexture *tex = (SoftTexture*) texture;
+	int bpp = tex->isRGBA ? 4 : 1;
+	const unsigned char *src = (const unsigned char*) data;
+	NVG_NOTUSED(userdata);
+
+	// data is the w * h rectangle, tightly packed
+	for (int row = 0; row < h; row += 1) {
+		memcpy(
+			&tex->pixels[((y + row) * tex->width + x) * bpp],
+			&src[row * w * bpp],
+			w * bpp
+		);
+	}
+}
+
+static void SOFT_updateUniformBuffer(void* userdata, void* uniforms, size_t uniformLength)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	if (uniformLength > sizeof(dev->pending.frag)) {
+		uniformLength = sizeof(dev->pending.frag);
+	}
+	memcpy(dev->pending.frag, uniforms, uniformLength);
+}
+
+static void SOFT_updateShader(void* userdata, int enableAA, int fillType, int texType)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+
+	// Same technique table as the FNA3D backends: index 0 is EdgeAA
+	dev->pending.edgeAA = !enableAA;
+	dev->pending.type = fillType;
+	dev->pending.texType = texType;
+}
+
+static void SOFT_updateSampler(void* userdata, void* texture)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->sampler = (SoftTexture*) texture;
+}
+
+static void SOFT_setViewport(void* userdata, float width, float height)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.inverseViewSize[0] = 1.0f / width;
+	dev->pending.inverseViewSize[1] = 1.0f / height;
+}
+
+static void SOFT_updateVertexTransform(void* userdata, float* xform)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	memcpy(dev->pending.vertexXform, xform, sizeof(dev->pending.vertexXform));
+}
+
+static void SOFT_resetState(void* userdata)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	SoftState *s = &dev->pending;
+
+	s->colorWrite = 1;
+	s->stencilEnable = 0;
+	s->stencilFunc = NVG_STENCILCOMPAREFUNCTION_ALWAYS;
+	s->stencilFail = NVG_STENCILOPERATION_KEEP;
+	s->stencilPass = NVG_STENCILOPERATION_KEEP;
+	s->ccwStencilFail = NVG_STENCILOPERATION_KEEP;
+	s->ccwStencilPass = NVG_STENCILOPERATION_KEEP;
+	s->cullClockwise = 1;
+}
+
+static void SOFT_toggleColorWriteMask(void* userdata, int enabled)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.colorWrite = enabled;
+}
+
+static void SOFT_updateBlendFunction(void* userdata, NVGcompositeOperationState blendOp)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.blendOp = blendOp;
+}
+
+static void SOFT_toggleStencil(void* userdata, int enabled)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.stencilEnable = enabled;
+}
+
+static void SOFT_updateStencilFunction(
+	void* userdata,
+	nvgStencilCompareFunction stencilFunc,
+	nvgStencilOperation stencilFail,
+	nvgStencilOperation stencilDepthBufferFail,
+	nvgStencilOperation stencilPass,
+	nvgStencilOperation ccwStencilFail,
+	nvgStencilOperation ccwStencilDepthBufferFail,
+	nvgStencilOperation ccwStencilPass
+) {
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+
+	// There is no depth buffer, so the depth fail ops never run
+	NVG_NOTUSED(stencilDepthBufferFail);
+	NVG_NOTUSED(ccwStencilDepthBufferFail);
+
+	dev->pending.stencilFunc = stencilFunc;
+	dev->pending.stencilFail = stencilFail;
+	dev->pending.stencilPass = stencilPass;
+	dev->pending.ccwStencilFail = ccwStencilFail;
+	dev->pending.ccwStencilPass = ccwStencilPass;
+}
+
+static void SOFT_toggleCullMode(void* userdata, int enabled)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.cullClockwise = enabled;
+}
+
+static void SOFT_applyState(void* userdata, void* vertexBuffer)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->pending.vertexBuffer = (SoftBuffer*) vertexBuffer;
+	dev->applied = dev->pending;
+}
+
+static void SOFT_drawPrimitives(void* userdata, int triStrip, int vertexOffset, int vertexCount)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	SoftBuffer *buf = dev->applied.vertexBuffer;
+	const NVGvertex *verts;
+	SoftVertex tri[3];
+	int i;
+
+	dev->stats.drawCalls += 1;
+
+	if (buf == NULL || vertexCount < 3) {
+		return;
+	}
+	if (	vertexOffset < 0 ||
+		((size_t) vertexOffset + vertexCount) * sizeof(NVGvertex) > buf->size	) {
+		// A GPU reads undefined vertices here, there's nothing to match
+		dev->stats.invalidDraws += 1;
+		return;
+	}
+	verts = ((const NVGvertex*) buf->data) + vertexOffset;
+
+	if (triStrip) {
+		INTERNAL_vertex(dev, &verts[0], &tri[0]);
+		INTERNAL_vertex(dev, &verts[1], &tri[1]);
+		for (i = 2; i < vertexCount; i += 1) {
+			INTERNAL_vertex(dev, &verts[i], &tri[i % 3]);
+			// Odd triangles are flipped to keep the strip's winding
+			if (i & 1) {
+				INTERNAL_triangle(dev, &tri[(i - 1) % 3], &tri[(i - 2) % 3], &tri[i % 3]);
+			} else {
+				INTERNAL_triangle(dev, &tri[(i - 2) % 3], &tri[(i - 1) % 3], &tri[i % 3]);
+			}
+		}
+	} else {
+		for (i = 0; i + 2 < vertexCount; i += 3) {
+			INTERNAL_vertex(dev, &verts[i + 0], &tri[0]);
+			INTERNAL_vertex(dev, &verts[i + 1], &tri[1]);
+			INTERNAL_vertex(dev, &verts[i + 2], &tri[2]);
+			INTERNAL_triangle(dev, &tri[0], &tri[1], &tri[2]);
+		}
+	}
+}
+
+static void* SOFT_createRenderTarget(void* userdata, int width, int height)
+{
+	NVG_NOTUSED(userdata);
+	return INTERNAL_createTexture(1, width, height, 0, 0, 0, 1);
+}
+
+static void SOFT_setRenderTarget(void* userdata, void* texture)
+{
+	NVGsoftDevice *dev = (NVGsoftDevice*) userdata;
+	dev->target = (texture != NULL) ? (SoftTexture*) texture : &dev->backbuffer;
+}
+
+// Public API
+
+NVGsoftDevice* nvgSoftCreateDevice(int width, int height)
+{
+	NVGsoftDevice *dev;
+
+	if (width <= 0 || height <= 0) {
+		return NULL;
+	}
+
+	dev = (NVGsoftDevice*) malloc(sizeof(NVGsoftDevice));
+	if (dev == NULL) {
+		return NULL;
+	}
+	memset(dev, '\0', sizeof(NVGsoftDevice));
+
+	dev->backbuffer.isRGBA = 1;
+	dev->backbuffer.width = width;
+	dev->backbuffer.height = height;
+	dev->backbuffer.pixels = (unsigned char*) calloc(width * height, 4);
+	dev->backbuffer.stencil = (unsigned char*) calloc(width * height, 1);
+	dev->overdraw = (unsigned short*) calloc(width * height, sizeof(unsigned short));
+	if (dev->backbuffer.pixels == NULL || dev->backbuffer.stencil == NULL || dev->overdraw == NULL) {
+		nvgSoftDeleteDevice(dev);
+		return NULL;
+	}
+	dev->target = &dev->backbuffer;
+
+	SOFT_resetState(dev);
+	nvgTransformIdentity(dev->pending.vertexXform);
+	dev->pending.inverseViewSize[0] = 1.0f / width;
+	dev->pending.inverseViewSize[1] = 1.0f / height;
+	dev->applied = dev->pending;
+	return dev;
+}
+
+void nvgSoftDeleteDevice(NVGsoftDevice *dev)
+{
+	if (dev == NULL) {
+		return;
+	}
+	free(dev->backbuffer.pixels);
+	free(dev->backbuffer.stencil);
+	free(dev->overdraw);
+	free(dev);
+}
+
+NVGcontext* nvgSoftCreate(NVGsoftDevice *dev)
+{
+	return nvgGpuCreate(
+		dev,
+		SOFT_createContext,
+		SOFT_deleteContext,
+		SOFT_createVertexBuffer,
+		SOFT_deleteVertexBuffer,
+		SOFT_updateVertexBuffer,
+		SOFT_createTexture,
+		SOFT_deleteTexture,
+		SOFT_updateTexture,
+		SOFT_updateUniformBuffer,
+		SOFT_updateShader,
+		SOFT_updateSampler,
+		SOFT_setViewport,
+		SOFT_updateVertexTransform,
+		SOFT_resetState,
+		SOFT_toggleColorWriteMask,
+		SOFT_updateBlendFunction,
+		SOFT_toggleStencil,
+		SOFT_updateStencilFunction,
+		SOFT_toggleCullMode,
+		SOFT_applyState,
+		SOFT_drawPrimitives,
+		SOFT_createRenderTarget,
+		SOFT_setRenderTarget
+	);
+}
+
+void nvgSoftClear(NVGsoftDevice *dev, NVGcolor color)
+{
+	SoftTexture *bb = &dev->backbuffer;
+	unsigned char rgba[4];
+	int i, count = bb->width * bb->height;
+
+	// The framebuffer is premultiplied
+	rgba[0] = (unsigned char) (INTERNAL_saturate(color.r * color.a) * 255.0f + 0.5f);
+	rgba[1] = (unsigned char) (INTERNAL_saturate(color.g * color.a) * 255.0f + 0.5f);
+	rgba[2] = (unsigned char) (INTERNAL_saturate(color.b * color.a) * 255.0f + 0.5f);
+	rgba[3] = (unsigned char) (INTERNAL_saturate(color.a) * 255.0f + 0.5f);
+	for (i = 0; i < count; i += 1) {
+		memcpy(&bb->pixels[i * 4], rgba, 4);
+	}
+	memset(bb->stencil, '\0', count);
+}
+
+const unsigned char* nvgSoftGetPixels(NVGsoftDevice *dev, int *width, int *height)
+{
+	if (width != NULL) {
+		*width = dev->backbuffer.width;
+	}
+	if (height != NULL) {
+		*height = dev->backbuffer.height;
+	}
+	return dev->backbuffer.pixels;
+}
+
+const unsigned short* nvgSoftGetOverdraw(NVGsoftDevice *dev)
+{
+	return dev->overdraw;
+}
+
+void nvgSoftGetStats(NVGsoftDevice *dev, NVGsoftStats *stats)
+{
+	*stats = dev->stats;
+}
+
+void nvgSoftResetStats(NVGsoftDevice *dev)
+{
+	memset(&dev->stats, '\0', sizeof(dev->stats));
+	memset(dev->overdraw, '\0', dev->backbuffer.width * dev->backbuffer.height * sizeof(unsigned short));
+}
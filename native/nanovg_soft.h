@@ -0,0 +1,70 @@
+#ifndef NANOVG_SOFT_H
+#define NANOVG_SOFT_H
+
+#include "nanovg_gpu.h"
+
+#ifdef _WIN32
+#define NVGSOFTAPI __declspec(dllexport)
+#else
+#define NVGSOFTAPI
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Reference software device for the nvg_gpu callbacks. Every callback is
+ * executed on a CPU framebuffer with an 8-bit stencil buffer, following the
+ * same state rules as the FNA3D backends and the nanovg.fx pixel shader math
+ * for each technique. It is meant for checking nanovg_gpu.c's output without
+ * a GPU (golden images, overdraw), not for speed.
+ *
+ * The framebuffer is premultiplied RGBA8, top row first. State, uniforms and
+ * the vertex buffer only take effect on applyState, like FNA3D effects.
+ */
+typedef struct NVGsoftDevice NVGsoftDevice;
+
+typedef struct NVGsoftStats
+{
+	int drawCalls;
+	int triangles;
+	int culledTriangles;
+	/* Pixel shader invocations, including stencil-only passes */
+	long long fragments;
+	long long discardedFragments;
+	long long stencilFailedFragments;
+	/* Fragments blended into a color buffer */
+	long long writtenFragments;
+	/* Draws reading past the end of the vertex buffer, which are skipped.
+	 * nanovg_gpu never makes these, so any at all is a bug to look into.
+	 */
+	int invalidDraws;
+} NVGsoftStats;
+
+NVGSOFTAPI NVGsoftDevice* nvgSoftCreateDevice(int width, int height);
+NVGSOFTAPI void nvgSoftDeleteDevice(NVGsoftDevice *dev);
+
+/* Creates a context drawing into dev, delete it with nvgGpuDelete before
+ * deleting the device.
+ */
+NVGSOFTAPI NVGcontext* nvgSoftCreate(NVGsoftDevice *dev);
+
+/* Clears the default framebuffer to color and its stencil buffer to 0 */
+NVGSOFTAPI void nvgSoftClear(NVGsoftDevice *dev, NVGcolor color);
+
+/* The default framebuffer, width * height * 4 bytes */
+NVGSOFTAPI const unsigned char* nvgSoftGetPixels(NVGsoftDevice *dev, int *width, int *height);
+
+/* Pixel shader invocations per pixel of the default framebuffer since the
+ * last reset. Counts saturate at 65535.
+ */
+NVGSOFTAPI const unsigned short* nvgSoftGetOverdraw(NVGsoftDevice *dev);
+
+NVGSOFTAPI void nvgSoftGetStats(NVGsoftDevice *dev, NVGsoftStats *stats);
+NVGSOFTAPI void nvgSoftResetStats(NVGsoftDevice *dev);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NANOVG_SOFT_H */
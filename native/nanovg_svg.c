@@ -1,7 +1,24 @@
 #include "nanovg_svg.h"
+#include "nanovg_gpu.h"
 
 #include <assert.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NVG_SVG_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifndef NSVG_IMAGE_MALLOC
+#define NSVG_IMAGE_MALLOC malloc
+#endif
+
+#ifndef NVG_TRACE_BEGIN
+#define NVG_TRACE_BEGIN(name, detail)
+#define NVG_TRACE_END()
+#endif
 
 // SVG renderer based on old nanosvg report:
 // https://github.com/memononen/nanosvg/issues/58
@@ -26,7 +43,9 @@ static NVGcolor getNVGColor(unsigned int color)
 	);
 }
 
-static NVGpaint getPaint(NVGcontext *vg, NSVGpaint *p)
+// nanovg paints don't depend on the context, so each gradient's paint is made
+// once, when a view is made, and reused for every shape and every draw
+static NVGpaint getPaint(const NSVGpaint *p)
 {
 	NSVGgradient *g;
 	NVGcolor icol, ocol;
@@ -47,11 +66,11 @@ static NVGpaint getPaint(NVGcontext *vg, NSVGpaint *p)
 
 	if (p->type == NSVG_PAINT_LINEAR_GRADIENT)
 	{
-		return nvgLinearGradient(vg, s.x, s.y, e.x, e.y, icol, ocol);
+		return nvgLinearGradient(NULL, s.x, s.y, e.x, e.y, icol, ocol);
 	}
 	else
 	{
-		return nvgRadialGradient(vg, s.x, s.y, 0.0, 160, icol, ocol);
+		return nvgRadialGradient(NULL, s.x, s.y, 0.0, 160, icol, ocol);
 	}
 }
 
@@ -73,152 +92,706 @@ static float getLineCrossing(Vec p0, Vec p1, Vec p2, Vec p3)
 	return -(d.x * b.y - d.y * b.x) / m;
 }
 
-void nvgDrawSVG(NVGcontext *vg, NSVGimage *svg)
+// Compact render view
+
+// An NSVGpaint, with gradients already made into nanovg paints
+typedef struct NVGsvgPaint
+{
+	signed char type;
+	union
+	{
+		unsigned int color;
+		const NVGpaint *gradient; // Shared by every shape using the same NSVGgradient
+	};
+} NVGsvgPaint;
+
+// Only what drawing reads, the rest stays behind in the NSVGshape
+typedef struct NVGsvgShape
+{
+	NVGsvgPaint fill;
+	NVGsvgPaint stroke;
+	float opacity;
+	float strokeWidth;
+	float bounds[4];
+	const float *xform; // An instance's symbolXform, NULL for other shapes
+	int first; // First path, or for an instance the first shape of its symbol
+	int count;
+	unsigned char flags;
+	char strokeLineJoin;
+	char strokeLineCap;
+} NVGsvgShape;
+
+typedef struct NVGsvgPath
+{
+	const float *pts;
+	const NSVGpackedPts *packed;
+	float offset[2];
+	int npts;
+	char closed;
+	char winding;
+} NVGsvgPath;
+
+struct NVGsvgView
+{
+	// The image's shapes come first, then those of each symbol they use
+	NVGsvgShape *shapes;
+	NVGsvgPath *paths;
+	NVGpaint *gradients;
+	// Side table of the NSVGshapes, for ids and anything else drawing skips
+	const NSVGshape **sources;
+	int nshapes;
+	int nimageShapes;
+	int npaths;
+	int ngradients;
+	// The image's size, for baking
+	float width;
+	float height;
+};
+
+// Where each symbol or gradient of the image went in a view being made.
+// Only what the view's shapes use gets an entry, so a view of one small part
+// of an image never walks the rest of it.
+typedef struct ViewMapSlot
+{
+	const void *key; // NULL for an empty slot
+	int value;
+} ViewMapSlot;
+
+typedef struct ViewMap
+{
+	ViewMapSlot *slots;
+	int mask;
+} ViewMap;
+
+static ViewMapSlot* findSlot(const ViewMap *map, const void *key)
+{
+	unsigned int hash = (unsigned int) (((size_t) key >> 3) * 2654435761u);
+	int i = (int) ((hash ^ (hash >> 15)) & map->mask);
+	while (map->slots[i].key != NULL && map->slots[i].key != key)
+	{
+		i = (i + 1) & map->mask;
+	}
+	return &map->slots[i];
+}
+
+// Room for count keys at no more than half full
+static int mapCapacity(int count)
+{
+	int capacity = 16;
+	while (capacity < count * 2)
+	{
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+// What a view of some shapes needs: its sizes, and the symbols they use in
+// the order they were found, nested ones included
+typedef struct ViewCounts
+{
+	int nshapes;
+	int npaths;
+	int ngradients; // Gradient paints, at least as many as distinct gradients
+	ViewMap symbolMap;
+	const NSVGsymbol **symbols;
+	int nsymbols;
+	int csymbols;
+} ViewCounts;
+
+// Point i of a path, with its offset, whether its points are packed or not
+static Vec getPoint(NSVGpath *path, int i)
 {
-	// Iterate shape linked list
-	for (NSVGshape *shape = svg->shapes; shape; shape = shape->next)
+	Vec v;
+	const NSVGpackedPts *packed = path->packed;
+	if (packed != NULL)
+	{
+		v.x = (packed->pts[i*2+0] * packed->scale[0] + packed->origin[0]) + path->offset[0];
+		v.y = (packed->pts[i*2+1] * packed->scale[1] + packed->origin[1]) + path->offset[1];
+	}
+	else
 	{
-		// Visibility
-		if (!(shape->flags & NSVG_FLAGS_VISIBLE))
+		v.x = path->pts[i*2+0] + path->offset[0];
+		v.y = path->pts[i*2+1] + path->offset[1];
+	}
+	return v;
+}
+
+static int getWinding(NSVGpath *path, NSVGpath *paths)
+{
+	// Compute whether this is a hole or a solid.
+	// Assume that no paths are crossing (usually true for normal SVG graphics).
+	// Also assume that the topology is the same if we use straight lines rather than Beziers (not always the case but usually true).
+	// Using the even-odd fill rule, if we draw a line from a point on the path to a point outside the boundary (e.g. top left) and count the number of times it crosses another path, the parity of this count determines whether the path is a hole (odd) or solid (even).
+	int crossings = 0;
+	Vec p0, p1;
+	p0 = getPoint(path, 0);
+	p1.x = path->bounds[0] - 1.0;
+	p1.y = path->bounds[1] - 1.0;
+	// Iterate all other paths
+	for (NSVGpath *path2 = paths; path2; path2 = path2->next)
+	{
+		if (path2 == path)
 		{
 			continue;
 		}
 
-		nvgSave(vg);
-
-		// Opacity
-		if (shape->opacity < 1.0)
+		// Iterate all lines on the path
+		if (path2->npts < 4)
 		{
-			nvgGlobalAlpha(vg, shape->opacity);
+			continue;
 		}
-
-		// Build path
-		nvgBeginPath(vg);
-
-		// Iterate path linked list
-		for (NSVGpath *path = shape->paths; path; path = path->next)
+		for (int i = 1; i < path2->npts + 3; i += 3)
 		{
-			nvgMoveTo(vg, path->pts[0], path->pts[1]);
-			for (int i = 1; i < path->npts; i += 3)
+			// The previous point
+			Vec p2 = getPoint(path2, i - 1);
+			// The current point
+			Vec p3 = getPoint(path2, (i < path2->npts) ? (i + 2) : 0);
+			float crossing = getLineCrossing(p0, p1, p2, p3);
+			float crossing2 = getLineCrossing(p2, p3, p0, p1);
+			if (0.0 <= crossing && crossing < 1.0 && 0.0 <= crossing2)
 			{
-				float *p = &path->pts[2*i];
-				nvgBezierTo(vg, p[0], p[1], p[2], p[3], p[4], p[5]);
-				// nvgLineTo(vg, p[4], p[5]);
+				crossings++;
 			}
+		}
+	}
 
-			// Close path
-			if (path->closed)
-			{
-				nvgClosePath(vg);
-			}
+	return (crossings % 2 == 0) ? NVG_SOLID : NVG_HOLE;
+}
+
+static int isGradient(const NSVGpaint *paint)
+{
+	return paint->type == NSVG_PAINT_LINEAR_GRADIENT || paint->type == NSVG_PAINT_RADIAL_GRADIENT;
+}
 
-			// Compute whether this is a hole or a solid.
-			// Assume that no paths are crossing (usually true for normal SVG graphics).
-			// Also assume that the topology is the same if we use straight lines rather than Beziers (not always the case but usually true).
-			// Using the even-odd fill rule, if we draw a line from a point on the path to a point outside the boundary (e.g. top left) and count the number of times it crosses another path, the parity of this count determines whether the path is a hole (odd) or solid (even).
-			int crossings = 0;
-			Vec p0, p1;
-			p0.x = path->pts[0];
-			p0.y = path->pts[1];
-			p1.x = path->bounds[0] - 1.0;
-			p1.y = path->bounds[1] - 1.0;
-			// Iterate all other paths
-			for (NSVGpath *path2 = shape->paths; path2; path2 = path2->next)
+static int addSymbol(ViewCounts *counts, const NSVGsymbol *symbol)
+{
+	ViewMapSlot *slot;
+
+	if (counts->nsymbols > 0 && findSlot(&counts->symbolMap, symbol)->key != NULL)
+	{
+		return 1;
+	}
+	if ((counts->nsymbols + 1) * 2 > counts->csymbols)
+	{
+		// Grow the map and rehash what is in it, in the order found
+		int csymbols = mapCapacity(counts->nsymbols + 1);
+		ViewMapSlot *slots = (ViewMapSlot*) malloc(sizeof(ViewMapSlot) * csymbols);
+		const NSVGsymbol **symbols = (const NSVGsymbol**) realloc(
+			counts->symbols,
+			sizeof(NSVGsymbol*) * csymbols
+		);
+		if (slots == NULL || symbols == NULL)
+		{
+			free(slots);
+			if (symbols != NULL)
 			{
-				if (path2 == path)
-				{
-					continue;
-				}
-
-				// Iterate all lines on the path
-				if (path2->npts < 4)
-				{
-					continue;
-				}
-				for (int i = 1; i < path2->npts + 3; i += 3)
-				{
-					float *p = &path2->pts[2*i];
-					Vec p2, p3;
-					// The previous point
-					p2.x = p[-2];
-					p2.y = p[-1];
-					// The current point
-					if (i < path2->npts)
-					{
-						p3.x = p[4];
-						p3.y = p[5];
-					}
-					else
-					{
-						p3.x = path2->pts[0];
-						p3.y = path2->pts[1];
-					}
-					float crossing = getLineCrossing(p0, p1, p2, p3);
-					float crossing2 = getLineCrossing(p2, p3, p0, p1);
-					if (0.0 <= crossing && crossing < 1.0 && 0.0 <= crossing2)
-					{
-						crossings++;
-					}
-				}
+				counts->symbols = symbols;
 			}
+			return 0;
+		}
+		memset(slots, '\0', sizeof(ViewMapSlot) * csymbols);
+		free(counts->symbolMap.slots);
+		counts->symbolMap.slots = slots;
+		counts->symbolMap.mask = csymbols - 1;
+		counts->symbols = symbols;
+		counts->csymbols = csymbols;
+		for (int i = 0; i < counts->nsymbols; i += 1)
+		{
+			slot = findSlot(&counts->symbolMap, symbols[i]);
+			slot->key = symbols[i];
+			slot->value = i;
+		}
+	}
+	slot = findSlot(&counts->symbolMap, symbol);
+	slot->key = symbol;
+	slot->value = counts->nsymbols;
+	counts->symbols[counts->nsymbols++] = symbol;
+	return 1;
+}
+
+// Counts count shapes from shapes on, or the whole list if count < 0, noting
+// each symbol they use. Returns 0 when out of memory.
+static int countShapes(ViewCounts *counts, NSVGshape *shapes, int count)
+{
+	for (NSVGshape *shape = shapes; shape && count != 0; shape = shape->next, count -= 1)
+	{
+		counts->nshapes += 1;
+		counts->ngradients += isGradient(&shape->fill) + isGradient(&shape->stroke);
+		for (NSVGpath *path = shape->paths; path; path = path->next)
+		{
+			counts->npaths += 1;
+		}
+		if (shape->symbol != NULL && !addSymbol(counts, shape->symbol))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void setPaint(NVGsvgView *view, ViewMap *gradientMap, NVGsvgPaint *dst, const NSVGpaint *src)
+{
+	dst->type = src->type;
+	if (!isGradient(src))
+	{
+		dst->color = src->color;
+		return;
+	}
+
+	// Each gradient's paint is made once, by the first shape using it
+	ViewMapSlot *slot = findSlot(gradientMap, src->gradient);
+	if (slot->key == NULL)
+	{
+		slot->key = src->gradient;
+		slot->value = view->ngradients;
+		view->gradients[view->ngradients++] = getPaint(src);
+	}
+	dst->gradient = &view->gradients[slot->value];
+}
+
+static void addShapes(NVGsvgView *view, ViewMap *gradientMap, NSVGshape *shapes, int count)
+{
+	for (NSVGshape *shape = shapes; shape && count != 0; shape = shape->next, count -= 1)
+	{
+		NVGsvgShape *s = &view->shapes[view->nshapes];
+		view->sources[view->nshapes] = shape;
+		view->nshapes += 1;
+
+		setPaint(view, gradientMap, &s->fill, &shape->fill);
+		setPaint(view, gradientMap, &s->stroke, &shape->stroke);
+		s->opacity = shape->opacity;
+		s->strokeWidth = shape->strokeWidth;
+		memcpy(s->bounds, shape->bounds, sizeof(s->bounds));
+		s->xform = (shape->symbol != NULL) ? shape->symbolXform : NULL;
+		s->first = view->npaths;
+		s->count = 0;
+		s->flags = shape->flags;
+		s->strokeLineJoin = shape->strokeLineJoin;
+		s->strokeLineCap = shape->strokeLineCap;
+
+		for (NSVGpath *path = shape->paths; path; path = path->next)
+		{
+			NVGsvgPath *p = &view->paths[view->npaths];
+			p->pts = path->pts;
+			p->packed = path->packed;
+			p->offset[0] = path->offset[0];
+			p->offset[1] = path->offset[1];
+			p->npts = path->npts;
+			p->closed = path->closed;
+			p->winding = (char) getWinding(path, shape->paths);
+			view->npaths += 1;
+			s->count += 1;
+		}
+	}
+}
+
+#define VIEW_ALIGN(size) (((size) + 15) & ~((size_t) 15))
 
-			if (crossings % 2 == 0)
+// A view of count image shapes from first on, or all of them if count < 0,
+// along with the symbols they use. The view and its arrays are one block.
+static NVGsvgView* createView(NSVGimage *svg, NSVGshape *first, int count)
+{
+	NVGsvgView *view = NULL;
+	ViewCounts counts;
+	ViewMap gradientMap;
+	int *symbolFirst = NULL;
+	size_t shapesAt, pathsAt, sourcesAt, size;
+	unsigned char *block;
+
+	memset(&counts, '\0', sizeof(counts));
+	if (!countShapes(&counts, first, count))
+	{
+		goto cleanup;
+	}
+	for (int i = 0; i < counts.nsymbols; i += 1)
+	{
+		// Symbols found here may use more symbols, which get counted in turn
+		if (!countShapes(&counts, counts.symbols[i]->shapes, -1))
+		{
+			goto cleanup;
+		}
+	}
+
+	shapesAt = VIEW_ALIGN(sizeof(NVGsvgView) + sizeof(NVGpaint) * counts.ngradients);
+	pathsAt = VIEW_ALIGN(shapesAt + sizeof(NVGsvgShape) * counts.nshapes);
+	sourcesAt = VIEW_ALIGN(pathsAt + sizeof(NVGsvgPath) * counts.npaths);
+	size = sourcesAt + sizeof(NSVGshape*) * counts.nshapes;
+	block = (unsigned char*) NSVG_IMAGE_MALLOC(size);
+	gradientMap.mask = mapCapacity(counts.ngradients) - 1;
+	gradientMap.slots = (ViewMapSlot*) malloc(
+		sizeof(ViewMapSlot) * (gradientMap.mask + 1) +
+		sizeof(int) * (counts.nsymbols + 1)
+	);
+	if (block == NULL || gradientMap.slots == NULL)
+	{
+		free(block);
+		free(gradientMap.slots);
+		goto cleanup;
+	}
+	memset(gradientMap.slots, '\0', sizeof(ViewMapSlot) * (gradientMap.mask + 1));
+	symbolFirst = (int*) &gradientMap.slots[gradientMap.mask + 1];
+
+	view = (NVGsvgView*) block;
+	memset(view, '\0', sizeof(NVGsvgView));
+	view->gradients = (NVGpaint*) (view + 1);
+	view->shapes = (NVGsvgShape*) (block + shapesAt);
+	view->paths = (NVGsvgPath*) (block + pathsAt);
+	view->sources = (const NSVGshape**) (block + sourcesAt);
+	view->width = svg->width;
+	view->height = svg->height;
+
+	addShapes(view, &gradientMap, first, count);
+	view->nimageShapes = view->nshapes;
+	for (int i = 0; i < counts.nsymbols; i += 1)
+	{
+		symbolFirst[i] = view->nshapes;
+		addShapes(view, &gradientMap, counts.symbols[i]->shapes, -1);
+	}
+	symbolFirst[counts.nsymbols] = view->nshapes;
+
+	// Point each instance at its symbol's range of shapes
+	for (int i = 0; i < view->nshapes; i += 1)
+	{
+		const NSVGsymbol *symbol = view->sources[i]->symbol;
+		if (symbol != NULL)
+		{
+			int k = findSlot(&counts.symbolMap, symbol)->value;
+			view->shapes[i].first = symbolFirst[k];
+			view->shapes[i].count = symbolFirst[k + 1] - symbolFirst[k];
+		}
+	}
+	free(gradientMap.slots);
+
+cleanup:
+	free(counts.symbolMap.slots);
+	free(counts.symbols);
+	return view;
+}
+
+NVGsvgView* nvgCreateSVGView(NSVGimage *svg)
+{
+	return createView(svg, svg->shapes, -1);
+}
+
+void nvgDeleteSVGView(NVGsvgView *view)
+{
+	// The arrays are in the same block
+	free(view);
+}
+
+// Bezier segments decoded onto the stack at a time
+#define DECODE_SEGMENTS 64
+
+// Writes count points of a path, from first on, as floats with the offset
+// added. Deduplicated paths share their points, see nsvgDedupePaths, and
+// packed ones are 16-bit, see nsvgQuantizePaths.
+static void decodePoints(const NVGsvgPath *path, int first, int count, float *out)
+{
+	const float ox = path->offset[0];
+	const float oy = path->offset[1];
+	int i = 0;
+
+	if (path->packed != NULL)
+	{
+		const NSVGpackedPts *packed = path->packed;
+		const short *q = &packed->pts[first * 2];
+#ifdef NVG_SVG_SSE2
+		const __m128 scale = _mm_setr_ps(packed->scale[0], packed->scale[1], packed->scale[0], packed->scale[1]);
+		const __m128 origin = _mm_setr_ps(packed->origin[0], packed->origin[1], packed->origin[0], packed->origin[1]);
+		const __m128 offset = _mm_setr_ps(ox, oy, ox, oy);
+		for (; i + 4 <= count; i += 4)
+		{
+			// Sign extend 4 points' worth of shorts, then scale them
+			__m128i v = _mm_loadu_si128((const __m128i*) &q[i * 2]);
+			__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+			__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+			_mm_storeu_ps(&out[i * 2], _mm_add_ps(_mm_add_ps(_mm_mul_ps(lo, scale), origin), offset));
+			_mm_storeu_ps(&out[i * 2 + 4], _mm_add_ps(_mm_add_ps(_mm_mul_ps(hi, scale), origin), offset));
+		}
+#endif
+		for (; i < count; i += 1)
+		{
+			out[i * 2 + 0] = (q[i * 2 + 0] * packed->scale[0] + packed->origin[0]) + ox;
+			out[i * 2 + 1] = (q[i * 2 + 1] * packed->scale[1] + packed->origin[1]) + oy;
+		}
+	}
+	else
+	{
+		const float *p = &path->pts[first * 2];
+#ifdef NVG_SVG_SSE2
+		const __m128 offset = _mm_setr_ps(ox, oy, ox, oy);
+		for (; i + 2 <= count; i += 2)
+		{
+			_mm_storeu_ps(&out[i * 2], _mm_add_ps(_mm_loadu_ps(&p[i * 2]), offset));
+		}
+#endif
+		for (; i < count; i += 1)
+		{
+			out[i * 2 + 0] = p[i * 2 + 0] + ox;
+			out[i * 2 + 1] = p[i * 2 + 1] + oy;
+		}
+	}
+}
+
+static void appendPath(NVGcontext *vg, const NVGsvgPath *path)
+{
+	float points[DECODE_SEGMENTS * 6];
+	int nsegments = (path->npts - 1) / 3;
+
+	// Plain points go straight into the command buffer
+	if (path->packed == NULL && path->offset[0] == 0.0f && path->offset[1] == 0.0f)
+	{
+		nvgMoveTo(vg, path->pts[0], path->pts[1]);
+		nvgPolyBezierTo(vg, &path->pts[2], nsegments);
+		return;
+	}
+
+	decodePoints(path, 0, 1, points);
+	nvgMoveTo(vg, points[0], points[1]);
+	for (int i = 0; i < nsegments; i += DECODE_SEGMENTS)
+	{
+		int n = (nsegments - i < DECODE_SEGMENTS) ? (nsegments - i) : DECODE_SEGMENTS;
+		decodePoints(path, 1 + i * 3, n * 3, points);
+		nvgPolyBezierTo(vg, points, n);
+	}
+}
+
+// The paint a symbol's shape draws with for one instance, taking what it left
+// unset from the instance's paint. Both keep their opacity in the color's
+// alpha even without a color, gradients aside.
+static NVGsvgPaint inheritPaint(
+	const NVGsvgPaint *own,
+	const NVGsvgPaint *inherited,
+	int flags,
+	int paintFlag,
+	int opacityFlag
+) {
+	NVGsvgPaint paint = (flags & paintFlag) ? *inherited : *own;
+	const NVGsvgPaint *opacity = (flags & opacityFlag) ? inherited : own;
+	int gradient = (
+		opacity->type == NSVG_PAINT_LINEAR_GRADIENT ||
+		opacity->type == NSVG_PAINT_RADIAL_GRADIENT
+	);
+	if (paint.type == NSVG_PAINT_COLOR && !gradient)
+	{
+		paint.color = (paint.color & 0x00ffffff) | (opacity->color & 0xff000000);
+	}
+	return paint;
+}
+
+static void drawShapes(NVGcontext *vg, const NVGsvgView *view, int first, int count, float alpha, const NVGsvgShape *instance);
+
+static void drawShape(NVGcontext *vg, const NVGsvgView *view, int index, float alpha, const NVGsvgShape *instance)
+{
+	const NVGsvgShape *shape = &view->shapes[index];
+	NVGsvgPaint fill = shape->fill;
+	NVGsvgPaint stroke = shape->stroke;
+
+	// Visibility
+	if (!(shape->flags & NSVG_FLAGS_VISIBLE))
+	{
+		return;
+	}
+
+	NVG_TRACE_BEGIN("nvgDrawSVG shape", view->sources[index]->id[0] ? view->sources[index]->id : NULL);
+	nvgSave(vg);
+
+	// Opacity, including that of the <use> drawing us, if any
+	if (shape->opacity * alpha < 1.0)
+	{
+		nvgGlobalAlpha(vg, shape->opacity * alpha);
+	}
+
+	// Instances share their symbol's paths, placed by their own transform
+	if (shape->xform != NULL)
+	{
+		const float *t = shape->xform;
+		nvgTransform(vg, t[0], t[1], t[2], t[3], t[4], t[5]);
+		drawShapes(vg, view, shape->first, shape->count, shape->opacity * alpha, shape);
+		nvgRestore(vg);
+		NVG_TRACE_END();
+		return;
+	}
+
+	// A symbol's shapes may leave their paints to the <use> drawing them
+	if (instance != NULL)
+	{
+		fill = inheritPaint(&shape->fill, &instance->fill, shape->flags, NSVG_FLAGS_INHERIT_FILL, NSVG_FLAGS_INHERIT_FILL_OPACITY);
+		stroke = inheritPaint(&shape->stroke, &instance->stroke, shape->flags, NSVG_FLAGS_INHERIT_STROKE, NSVG_FLAGS_INHERIT_STROKE_OPACITY);
+	}
+
+	// Build path
+	nvgBeginPath(vg);
+
+	// Iterate the shape's paths
+	for (int j = shape->first; j < shape->first + shape->count; j += 1)
+	{
+		const NVGsvgPath *path = &view->paths[j];
+
+		appendPath(vg, path);
+
+		// Close path
+		if (path->closed)
+		{
+			nvgClosePath(vg);
+		}
+
+		// Hole or solid, worked out when the view was made
+		nvgPathWinding(vg, path->winding);
+	}
+
+	// Fill shape
+	if (fill.type)
+	{
+		switch (fill.type)
+		{
+			case NSVG_PAINT_COLOR:
 			{
-				nvgPathWinding(vg, NVG_SOLID);
+				NVGcolor color = getNVGColor(fill.color);
+				nvgFillColor(vg, color);
+				break;
 			}
-			else
+			case NSVG_PAINT_LINEAR_GRADIENT:
+			case NSVG_PAINT_RADIAL_GRADIENT:
 			{
-				nvgPathWinding(vg, NVG_HOLE);
+				nvgFillPaint(vg, *fill.gradient);
+				break;
 			}
 		}
+		nvgFill(vg);
+	}
 
-		// Fill shape
-		if (shape->fill.type)
+	// Stroke shape
+	if (stroke.type)
+	{
+		nvgStrokeWidth(vg, shape->strokeWidth);
+		// strokeDashOffset, strokeDashArray, strokeDashCount not yet supported
+		nvgLineCap(vg, shape->strokeLineCap);
+		nvgLineJoin(vg, (int) shape->strokeLineJoin);
+
+		switch (stroke.type)
 		{
-			switch (shape->fill.type)
+			case NSVG_PAINT_COLOR:
 			{
-				case NSVG_PAINT_COLOR:
-				{
-					NVGcolor color = getNVGColor(shape->fill.color);
-					nvgFillColor(vg, color);
-					break;
-				}
-				case NSVG_PAINT_LINEAR_GRADIENT:
-				case NSVG_PAINT_RADIAL_GRADIENT:
-				{
-					nvgFillPaint(vg, getPaint(vg, &shape->fill));
-					break;
-				}
+				NVGcolor color = getNVGColor(stroke.color);
+				nvgStrokeColor(vg, color);
+				break;
 			}
-			nvgFill(vg);
-		}
-
-		// Stroke shape
-		if (shape->stroke.type)
-		{
-			nvgStrokeWidth(vg, shape->strokeWidth);
-			// strokeDashOffset, strokeDashArray, strokeDashCount not yet supported
-			nvgLineCap(vg, shape->strokeLineCap);
-			nvgLineJoin(vg, (int) shape->strokeLineJoin);
-
-			switch (shape->stroke.type)
+			case NSVG_PAINT_LINEAR_GRADIENT:
 			{
-				case NSVG_PAINT_COLOR:
-				{
-					NVGcolor color = getNVGColor(shape->stroke.color);
-					nvgStrokeColor(vg, color);
-					break;
-				}
-				case NSVG_PAINT_LINEAR_GRADIENT:
-				{
-					// NSVGgradient *g = shape->stroke.gradient;
-					// printf("		lin grad: %f\t%f\n", g->fx, g->fy);
-					break;
-				}
+				break;
 			}
-			nvgStroke(vg);
 		}
+		nvgStroke(vg);
+	}
 
-		nvgRestore(vg);
+	nvgRestore(vg);
+	NVG_TRACE_END();
+}
+
+static void drawShapes(NVGcontext *vg, const NVGsvgView *view, int first, int count, float alpha, const NVGsvgShape *instance)
+{
+	// Iterate the shape array
+	for (int i = first; i < first + count; i += 1)
+	{
+		drawShape(vg, view, i, alpha, instance);
+	}
+}
+
+void nvgDrawSVGView(NVGcontext *vg, const NVGsvgView *view)
+{
+	if (view == NULL)
+	{
+		return;
 	}
+	NVG_TRACE_BEGIN("nvgDrawSVG", NULL);
+	drawShapes(vg, view, 0, view->nimageShapes, 1.0f, NULL);
+	NVG_TRACE_END();
+}
+
+void nvgDrawSVGViewSubset(NVGcontext *vg, const NVGsvgView *view, const NSVGshapeRange *range)
+{
+	// A range past the view's shapes is from after the view was made
+	if (	view == NULL ||
+		range == NULL ||
+		range->index < 0 ||
+		range->index + range->count > view->nimageShapes	)
+	{
+		return;
+	}
+	NVG_TRACE_BEGIN("nvgDrawSVGSubset", NULL);
+	drawShapes(vg, view, range->index, range->count, 1.0f, NULL);
+	NVG_TRACE_END();
+}
+
+void nvgDrawSVG(NVGcontext *vg, NSVGimage *svg)
+{
+	// A view only for this draw, callers drawing every frame should keep one
+	NVGsvgView *view = nvgCreateSVGView(svg);
+	nvgDrawSVGView(vg, view);
+	nvgDeleteSVGView(view);
+}
+
+int nvgDrawSVGSubset(NVGcontext *vg, NSVGimage *svg, const char *id)
+{
+	NSVGshapeRange range;
+	if (!nsvgFindShapes(svg, id, &range))
+	{
+		return 0;
+	}
+
+	// Only the part's shapes and the symbols they use, the rest is untouched
+	NVGsvgView *view = createView(svg, range.first, range.count);
+	if (view != NULL)
+	{
+		NVG_TRACE_BEGIN("nvgDrawSVGSubset", id);
+		drawShapes(vg, view, 0, view->nimageShapes, 1.0f, NULL);
+		NVG_TRACE_END();
+		nvgDeleteSVGView(view);
+	}
+	return 1;
+}
+
+void nvgDrawSVGViewInstanced(NVGcontext *vg, const NVGsvgView *view, const float *xforms, int count)
+{
+	if (view == NULL || count <= 0)
+	{
+		return;
+	}
+
+	nvgGpuBeginInstances(vg);
+	nvgDrawSVGView(vg, view);
+	nvgGpuEndInstances(vg, xforms, count);
+}
+
+void nvgBakeSVGView(NVGcontext *vg, const NVGsvgView *view, int image, int x, int y, int w, int h)
+{
+	if (	view == NULL ||
+		w <= 0 ||
+		h <= 0 ||
+		view->width <= 0.0f ||
+		view->height <= 0.0f	)
+	{
+		return;
+	}
+
+	nvgGpuBindRenderTarget(vg, image);
+	nvgSave(vg);
+	nvgResetTransform(vg);
+	nvgScissor(vg, (float) x, (float) y, (float) w, (float) h);
+
+	// Clear the slot, whatever was baked there before may be bigger
+	nvgGlobalCompositeOperation(vg, NVG_COPY);
+	nvgBeginPath(vg);
+	nvgRect(vg, (float) x, (float) y, (float) w, (float) h);
+	nvgFillColor(vg, nvgRGBA(0, 0, 0, 0));
+	nvgFill(vg);
+	nvgGlobalCompositeOperation(vg, NVG_SOURCE_OVER);
+
+	nvgTranslate(vg, (float) x, (float) y);
+	nvgScale(vg, w / view->width, h / view->height);
+	nvgDrawSVGView(vg, view);
+
+	nvgRestore(vg);
+	nvgGpuBindRenderTarget(vg, 0);
 }
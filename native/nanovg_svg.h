@@ -14,8 +14,58 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/* Draws the image. This is a convenience for one-off draws: it makes and
+ * deletes a view for the image each time, so images drawn every frame should
+ * keep a view and draw that with nvgDrawSVGView instead.
+ */
 NVGSVGAPI void nvgDrawSVG(NVGcontext *vg, NSVGimage *svg);
 
+/* A compact copy of what drawing reads from an image: contiguous arrays of
+ * shapes and paths, with each path's hole/solid winding and each gradient's
+ * nanovg paint worked out up front.
+ * Ids, gradient names and other data drawing skips stay in the image.
+ * The view points into the image, so delete the view first, and make a new
+ * one after changing the image, e.g. with nsvgDedupePaths.
+ * Making a view costs one pass over the image's shapes, plus those of the
+ * symbols they use.
+ * Returns NULL when out of memory.
+ */
+typedef struct NVGsvgView NVGsvgView;
+NVGSVGAPI NVGsvgView* nvgCreateSVGView(NSVGimage *svg);
+NVGSVGAPI void nvgDeleteSVGView(NVGsvgView *view);
+NVGSVGAPI void nvgDrawSVGView(NVGcontext *vg, const NVGsvgView *view);
+
+/* Draws only the shapes of the element with this id, e.g. one sprite of a
+ * sheet, where it sits in the image. See nsvgFindShapes for what ids are
+ * found. Like nvgDrawSVG this is a convenience for one-off draws: each call
+ * looks the id up and makes a view of just those shapes and the symbols they
+ * use, which costs about as much as the part but nothing for the rest.
+ * Returns 0 if no element has the id.
+ */
+NVGSVGAPI int nvgDrawSVGSubset(NVGcontext *vg, NSVGimage *svg, const char *id);
+
+/* Draws a range from nsvgFindShapes out of a view of the whole image.
+ * This is the way to draw parts every frame: find each part's range once,
+ * keep one view of the image, and draw from it with no lookups or copies.
+ * Changing the image, e.g. with nsvgCullShapes, needs a new view anyway,
+ * and the range must be found again along with it.
+ */
+NVGSVGAPI void nvgDrawSVGViewSubset(NVGcontext *vg, const NVGsvgView *view, const NSVGshapeRange *range);
+
+/* Draws a view once per transform, tessellating it only once.
+ * Each transform is 6 floats in nvgTransform order, applied on top of the
+ * current transform. Requires a context made by nvgGpuCreate.
+ */
+NVGSVGAPI void nvgDrawSVGViewInstanced(NVGcontext *vg, const NVGsvgView *view, const float *xforms, int count);
+
+/* Rasterizes a view's image, scaled from the image's width and height, into
+ * the (x, y, w, h) pixel rectangle of a render target made by
+ * nvgGpuCreateRenderTarget, clearing that rectangle first.
+ * The rest of the target is left alone, so many images can share one atlas.
+ * Draw the result with nvgImageQuad.
+ */
+NVGSVGAPI void nvgBakeSVGView(NVGcontext *vg, const NVGsvgView *view, int image, int x, int y, int w, int h);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
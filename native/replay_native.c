@@ -0,0 +1,147 @@
+/* SVG4FNA - SVG Container and Renderer for FNA
+ *
+ * Copyright (c) 2024 Ethan Lee
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software in a
+ * product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ * Ethan "flibitijibibo" Lee <flibitijibibo@flibitijibibo.com>
+ *
+ */
+
+#include <SDL.h>
+#include <stdio.h>
+
+#include "svg4fna.c"
+
+// Replays an nvgGpuBeginCapture file and times each frame, no GPU needed.
+// Usage: replay_native [-loops N] [-soft WIDTH HEIGHT] file.nvgcap
+//
+// By default the capture is fed to the null backend, measuring the cost of
+// the callbacks themselves. With -soft, it is drawn by the software device
+// instead, which also reports the fragment work per frame.
+
+static double milliseconds(Uint64 ticks)
+{
+	return (double) ticks * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+int main(int argc, char **argv) {
+	int loops = 1;
+	int softWidth = 0, softHeight = 0;
+	int arg = 1;
+
+	for (; arg < argc; arg += 1) {
+		if (SDL_strcmp(argv[arg], "-loops") == 0 && arg + 1 < argc) {
+			arg += 1;
+			loops = SDL_max(1, SDL_atoi(argv[arg]));
+		} else if (SDL_strcmp(argv[arg], "-soft") == 0 && arg + 2 < argc) {
+			softWidth = SDL_max(1, SDL_atoi(argv[arg + 1]));
+			softHeight = SDL_max(1, SDL_atoi(argv[arg + 2]));
+			arg += 2;
+		} else {
+			break;
+		}
+	}
+	if (arg >= argc) {
+		printf("Usage: replay_native [-loops N] [-soft WIDTH HEIGHT] file.nvgcap\n");
+		return -1;
+	}
+	const char *file = argv[arg];
+
+	NVGsoftDevice *dev = NULL;
+	NVGcontext *vg;
+	if (softWidth > 0) {
+		dev = nvgSoftCreateDevice(softWidth, softHeight);
+		vg = nvgSoftCreate(dev);
+	} else {
+		vg = nvgGpuCreateNull();
+	}
+	if (vg == NULL) {
+		printf("NVGcontext creation failed\n");
+		return -1;
+	}
+
+	NVGgpuReplay *replay = nvgGpuReplayOpen(vg, file);
+	if (replay == NULL) {
+		printf("Could not open capture %s\n", file);
+		nvgGpuDelete(vg);
+		return -1;
+	}
+
+	int frames = 0;
+	Uint64 total = 0, minTime = ~0ULL, maxTime = 0;
+	for (int loop = 0; loop < loops; loop += 1) {
+		if (loop > 0) {
+			nvgGpuReplayRewind(replay);
+		}
+		for (;;) {
+			if (dev != NULL) {
+				nvgSoftClear(dev, nvgRGBA(0, 0, 0, 0));
+			}
+			Uint64 start = SDL_GetPerformanceCounter();
+			int more = nvgGpuReplayFrame(replay);
+			Uint64 time = SDL_GetPerformanceCounter() - start;
+			if (!more) {
+				break;
+			}
+			frames += 1;
+			total += time;
+			minTime = SDL_min(minTime, time);
+			maxTime = SDL_max(maxTime, time);
+		}
+	}
+	if (frames == 0) {
+		printf("%s has no complete frames\n", file);
+		nvgGpuReplayClose(replay);
+		nvgGpuDelete(vg);
+		if (dev != NULL) {
+			nvgSoftDeleteDevice(dev);
+		}
+		return -1;
+	}
+
+	printf("%s, %d frames, %s backend\n", file, frames, (dev != NULL) ? "software" : "null");
+	printf("frame time (ms):     %.3f average, %.3f min, %.3f max\n",
+		milliseconds(total) / frames,
+		milliseconds(minTime),
+		milliseconds(maxTime)
+	);
+	if (dev != NULL) {
+		NVGsoftStats stats;
+		nvgSoftGetStats(dev, &stats);
+		printf("draw calls:          %d per frame\n", stats.drawCalls / frames);
+		printf("triangles:           %d per frame\n", stats.triangles / frames);
+		printf("fragments:           %lld per frame\n", stats.fragments / frames);
+	} else {
+		NVGgpuNullCounters counters;
+		nvgGpuGetNullCounters(vg, &counters);
+		printf("draw calls:          %d per frame\n", counters.drawCalls / frames);
+		printf("vertices drawn:      %d per frame\n", counters.verticesDrawn / frames);
+		printf("vertices uploaded:   %d per frame\n", counters.verticesUploaded / frames);
+		printf("uniform bytes:       %d per frame\n", (int) (counters.uniformBytesUploaded / frames));
+		printf("texels uploaded:     %d per frame\n", (int) (counters.texelsUploaded / frames));
+	}
+
+	nvgGpuReplayClose(replay);
+	nvgGpuDelete(vg);
+	if (dev != NULL) {
+		nvgSoftDeleteDevice(dev);
+	}
+	return 0;
+}
@@ -0,0 +1,156 @@
+/* SVG4FNA - SVG Container and Renderer for FNA
+ *
+ * Copyright (c) 2024 Ethan Lee
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software in a
+ * product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ * Ethan "flibitijibibo" Lee <flibitijibibo@flibitijibibo.com>
+ *
+ */
+
+#include <SDL.h>
+#include <stdio.h>
+
+#include "svg4fna.c"
+
+// Runs nvgDrawSVG through the nvg_gpu callbacks on the software device.
+// Usage: softrender_native [file.svg] [out.tga] [golden.tga]
+// With a golden image, exits with 1 if any byte of the output differs.
+// `make check` runs it against golden/shapes.tga.
+
+#define TGA_HEADER 18
+
+// Uncompressed 32-bit TGA, top row first, straight alpha
+static unsigned char* encodeTGA(const unsigned char *rgba, int width, int height, size_t *size)
+{
+	unsigned char *tga, *dst;
+	int i;
+
+	*size = TGA_HEADER + (size_t) width * height * 4;
+	tga = (unsigned char*) SDL_malloc(*size);
+	SDL_memset(tga, '\0', TGA_HEADER);
+	tga[2] = 2;
+	tga[12] = width & 0xFF;
+	tga[13] = (width >> 8) & 0xFF;
+	tga[14] = height & 0xFF;
+	tga[15] = (height >> 8) & 0xFF;
+	tga[16] = 32;
+	tga[17] = 8 | 0x20;
+
+	dst = tga + TGA_HEADER;
+	for (i = 0; i < width * height; i += 1, rgba += 4, dst += 4) {
+		int a = rgba[3];
+		if (a == 0) {
+			SDL_memset(dst, '\0', 4);
+			continue;
+		}
+		dst[0] = (unsigned char) SDL_min(255, (rgba[2] * 255 + a / 2) / a);
+		dst[1] = (unsigned char) SDL_min(255, (rgba[1] * 255 + a / 2) / a);
+		dst[2] = (unsigned char) SDL_min(255, (rgba[0] * 255 + a / 2) / a);
+		dst[3] = (unsigned char) a;
+	}
+	return tga;
+}
+
+int main(int argc, char **argv) {
+	const char *file = (argc > 1) ? argv[1] : "23.svg";
+	const char *out = (argc > 2) ? argv[2] : NULL;
+	const char *golden = (argc > 3) ? argv[3] : NULL;
+	int result = 0;
+
+	NSVGimage *svg = nsvgParseFromFile(file, "px", 96);
+	if (svg == NULL || svg->width <= 0.0f || svg->height <= 0.0f) {
+		printf("Could not load SVG.\n");
+		return -1;
+	}
+
+	int width = (int) SDL_ceilf(svg->width);
+	int height = (int) SDL_ceilf(svg->height);
+	NVGsoftDevice *dev = nvgSoftCreateDevice(width, height);
+	NVGcontext *vg = nvgSoftCreate(dev);
+	if (vg == NULL) {
+		printf("NVGcontext creation failed\n");
+		return -1;
+	}
+
+	nvgSoftClear(dev, nvgRGBA(0, 0, 0, 0));
+	nvgBeginFrame(vg, (float) width, (float) height, 1.0f);
+	nvgDrawSVG(vg, svg);
+	nvgEndFrame(vg);
+
+	NVGsoftStats stats;
+	nvgSoftGetStats(dev, &stats);
+	const unsigned short *overdraw = nvgSoftGetOverdraw(dev);
+	int covered = 0, maxOverdraw = 0;
+	for (int i = 0; i < width * height; i += 1) {
+		if (overdraw[i] > 0) {
+			covered += 1;
+		}
+		maxOverdraw = SDL_max(maxOverdraw, overdraw[i]);
+	}
+
+	printf("%s, %dx%d\n", file, width, height);
+	printf("draw calls:          %d\n", stats.drawCalls);
+	printf("triangles:           %d (%d culled)\n", stats.triangles, stats.culledTriangles);
+	printf("fragments:           %lld\n", stats.fragments);
+	printf("  discarded:         %lld\n", stats.discardedFragments);
+	printf("  stencil failed:    %lld\n", stats.stencilFailedFragments);
+	printf("  written:           %lld\n", stats.writtenFragments);
+	printf("overdraw:            %.2f average, %d max\n",
+		covered ? ((double) stats.fragments / covered) : 0.0,
+		maxOverdraw
+	);
+	printf("invalid draws:       %d\n", stats.invalidDraws);
+	if (stats.invalidDraws > 0) {
+		result = 1;
+	}
+
+	size_t size;
+	unsigned char *tga = encodeTGA(nvgSoftGetPixels(dev, NULL, NULL), width, height, &size);
+	if (out != NULL) {
+		SDL_RWops *rw = SDL_RWFromFile(out, "wb");
+		if (rw == NULL) {
+			printf("Could not write %s\n", out);
+			result = -1;
+		} else {
+			SDL_RWwrite(rw, tga, 1, size);
+			SDL_RWclose(rw);
+		}
+	}
+	if (golden != NULL) {
+		size_t goldenSize;
+		unsigned char *expected = (unsigned char*) SDL_LoadFile(golden, &goldenSize);
+		if (expected == NULL) {
+			printf("Could not read %s\n", golden);
+			result = -1;
+		} else if (goldenSize != size || SDL_memcmp(expected, tga, size) != 0) {
+			printf("golden:              MISMATCH\n");
+			result = 1;
+		} else {
+			printf("golden:              match\n");
+		}
+		SDL_free(expected);
+	}
+
+	SDL_free(tga);
+	nvgGpuDelete(vg);
+	nvgSoftDeleteDevice(dev);
+	nsvgDelete(svg);
+	return result;
+}
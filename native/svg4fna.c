@@ -26,12 +26,21 @@
 
 #include <SDL.h>
 
+#include "svg4fna.h"
+
 #define assert SDL_assert
 #define printf SDL_Log
 
-#define free SDL_free
-#define malloc SDL_malloc
-#define realloc SDL_realloc
+/* Allocations are tagged by the file making them, see the includes below */
+#define free SVG4FNA_Free
+#define malloc(size) SVG4FNA_Malloc(size, SVG4FNA_MEMORY_TAG)
+#define realloc(ptr, size) SVG4FNA_Realloc(ptr, size, SVG4FNA_MEMORY_TAG)
+#define calloc(count, size) SVG4FNA_Calloc(count, size, SVG4FNA_MEMORY_TAG)
+
+static void* SVG4FNA_Malloc(size_t size, SVG4FNA_MemoryTag tag);
+static void* SVG4FNA_Realloc(void *ptr, size_t size, SVG4FNA_MemoryTag tag);
+static void* SVG4FNA_Calloc(size_t count, size_t size, SVG4FNA_MemoryTag tag);
+static void SVG4FNA_Free(void *ptr);
 
 #define memcpy SDL_memcpy
 #define memset SDL_memset
@@ -71,7 +80,447 @@
 
 /* FIXME: Macro out fopen and friends */
 
+#define NVG_TICKS() SDL_GetPerformanceCounter()
+#define NVG_TICKS_FREQUENCY() SDL_GetPerformanceFrequency()
+#define NSVG_TICKS() SDL_GetPerformanceCounter()
+#define NSVG_TICKS_FREQUENCY() SDL_GetPerformanceFrequency()
+
+#define NVG_TRACE_BEGIN(name, detail) SVG4FNA_TRACE_BEGIN(name, detail)
+#define NVG_TRACE_END() SVG4FNA_TRACE_END()
+#define NSVG_TRACE_BEGIN(name, detail) SVG4FNA_TRACE_BEGIN(name, detail)
+#define NSVG_TRACE_END() SVG4FNA_TRACE_END()
+
+#define NSVG_IMAGE_MALLOC(size) SVG4FNA_Malloc(size, SVG4FNA_MEMORY_IMAGE)
+
+#define STBI_MALLOC(size) SVG4FNA_Malloc(size, SVG4FNA_MEMORY_OTHER)
+#define STBI_REALLOC(ptr, size) SVG4FNA_Realloc(ptr, size, SVG4FNA_MEMORY_OTHER)
+#define STBI_FREE(ptr) SVG4FNA_Free(ptr)
+
+/* .svgz support uses stb_image's zlib, which nanovg.c compiles in */
+#define NSVG_INFLATE(out, outlen, in, inlen) stbi_zlib_decode_noheader_buffer(out, outlen, in, inlen)
+
+/* nanovg.c switches to SVG4FNA_MEMORY_FONTATLAS for fontstash */
+#define SVG4FNA_MEMORY_TAG SVG4FNA_MEMORY_PATHCACHE
 #include "nanovg.c"
+#undef SVG4FNA_MEMORY_TAG
+
+#define SVG4FNA_MEMORY_TAG SVG4FNA_MEMORY_PARSER
 #include "nanosvg.c"
 #include "nanovg_svg.c"
+#undef SVG4FNA_MEMORY_TAG
+
+#define SVG4FNA_MEMORY_TAG SVG4FNA_MEMORY_RENDERER
 #include "nanovg_gpu.c"
+#undef SVG4FNA_MEMORY_TAG
+
+#define SVG4FNA_MEMORY_TAG SVG4FNA_MEMORY_OTHER
+#include "nanosvg_cpu.c"
+#include "nanovg_soft.c"
+
+/* Memory, see svg4fna.h */
+
+typedef union MemoryHeader
+{
+	struct
+	{
+		size_t size;
+		SVG4FNA_MemoryTag tag;
+	};
+	char align[16]; // Keep the allocation 16-byte aligned for SIMD
+} MemoryHeader;
+
+static void* SVG4FNACALL INTERNAL_defaultMalloc(void *userdata, size_t size, SVG4FNA_MemoryTag tag)
+{
+	(void) userdata;
+	(void) tag;
+	return SDL_malloc(size);
+}
+
+static void* SVG4FNACALL INTERNAL_defaultRealloc(void *userdata, void *ptr, size_t size, SVG4FNA_MemoryTag tag)
+{
+	(void) userdata;
+	(void) tag;
+	return SDL_realloc(ptr, size);
+}
+
+static void SVG4FNACALL INTERNAL_defaultFree(void *userdata, void *ptr, SVG4FNA_MemoryTag tag)
+{
+	(void) userdata;
+	(void) tag;
+	SDL_free(ptr);
+}
+
+static struct
+{
+	svg4fna_pfn_malloc mallocFunc;
+	svg4fna_pfn_realloc reallocFunc;
+	svg4fna_pfn_free freeFunc;
+	void *userdata;
+
+	SDL_SpinLock lock;
+	size_t live[SVG4FNA_MEMORY_TAGCOUNT];
+	size_t peak[SVG4FNA_MEMORY_TAGCOUNT];
+	size_t total;
+} memory = {
+	INTERNAL_defaultMalloc,
+	INTERNAL_defaultRealloc,
+	INTERNAL_defaultFree,
+	NULL,
+	0,
+	{ 0 },
+	{ 0 },
+	0
+};
+
+static void INTERNAL_countMemory(SVG4FNA_MemoryTag tag, size_t added, size_t removed)
+{
+	SDL_AtomicLock(&memory.lock);
+	memory.live[tag] = memory.live[tag] + added - removed;
+	memory.total = memory.total + added - removed;
+	if (memory.live[tag] > memory.peak[tag]) {
+		memory.peak[tag] = memory.live[tag];
+	}
+	SDL_AtomicUnlock(&memory.lock);
+}
+
+static void* SVG4FNA_Malloc(size_t size, SVG4FNA_MemoryTag tag)
+{
+	MemoryHeader *header;
+
+	if (size > ((size_t) -1) - sizeof(MemoryHeader)) {
+		return NULL;
+	}
+	header = (MemoryHeader*) memory.mallocFunc(memory.userdata, sizeof(MemoryHeader) + size, tag);
+	if (header == NULL) {
+		return NULL;
+	}
+	header->size = sizeof(MemoryHeader) + size;
+	header->tag = tag;
+	INTERNAL_countMemory(tag, header->size, 0);
+	return header + 1;
+}
+
+static void* SVG4FNA_Realloc(void *ptr, size_t size, SVG4FNA_MemoryTag tag)
+{
+	MemoryHeader *header;
+	size_t oldSize;
+
+	if (ptr == NULL) {
+		return SVG4FNA_Malloc(size, tag);
+	}
+	if (size > ((size_t) -1) - sizeof(MemoryHeader)) {
+		return NULL;
+	}
+
+	// The block keeps the tag it was first allocated with
+	header = ((MemoryHeader*) ptr) - 1;
+	oldSize = header->size;
+	tag = header->tag;
+	header = (MemoryHeader*) memory.reallocFunc(memory.userdata, header, sizeof(MemoryHeader) + size, tag);
+	if (header == NULL) {
+		return NULL;
+	}
+	header->size = sizeof(MemoryHeader) + size;
+	INTERNAL_countMemory(tag, header->size, oldSize);
+	return header + 1;
+}
+
+static void* SVG4FNA_Calloc(size_t count, size_t size, SVG4FNA_MemoryTag tag)
+{
+	void *ptr;
+
+	if (size != 0 && count > ((size_t) -1) / size) {
+		return NULL;
+	}
+	ptr = SVG4FNA_Malloc(count * size, tag);
+	if (ptr != NULL) {
+		SDL_memset(ptr, '\0', count * size);
+	}
+	return ptr;
+}
+
+static void SVG4FNA_Free(void *ptr)
+{
+	MemoryHeader *header;
+
+	if (ptr == NULL) {
+		return;
+	}
+	header = ((MemoryHeader*) ptr) - 1;
+	INTERNAL_countMemory(header->tag, 0, header->size);
+	memory.freeFunc(memory.userdata, header, header->tag);
+}
+
+int SVG4FNA_SetAllocator(
+	svg4fna_pfn_malloc mallocFunc,
+	svg4fna_pfn_realloc reallocFunc,
+	svg4fna_pfn_free freeFunc,
+	void *userdata
+) {
+	int result = 0;
+
+	SDL_AtomicLock(&memory.lock);
+	if (memory.total == 0) {
+		if (mallocFunc == NULL || reallocFunc == NULL || freeFunc == NULL) {
+			memory.mallocFunc = INTERNAL_defaultMalloc;
+			memory.reallocFunc = INTERNAL_defaultRealloc;
+			memory.freeFunc = INTERNAL_defaultFree;
+			memory.userdata = NULL;
+		} else {
+			memory.mallocFunc = mallocFunc;
+			memory.reallocFunc = reallocFunc;
+			memory.freeFunc = freeFunc;
+			memory.userdata = userdata;
+		}
+		result = 1;
+	}
+	SDL_AtomicUnlock(&memory.lock);
+	return result;
+}
+
+void SVG4FNA_GetMemoryStats(SVG4FNA_MemoryStats *stats)
+{
+	SDL_AtomicLock(&memory.lock);
+	SDL_memcpy(stats->live, memory.live, sizeof(memory.live));
+	SDL_memcpy(stats->peak, memory.peak, sizeof(memory.peak));
+	SDL_AtomicUnlock(&memory.lock);
+}
+
+void SVG4FNA_ResetMemoryPeaks(void)
+{
+	SDL_AtomicLock(&memory.lock);
+	SDL_memcpy(memory.peak, memory.live, sizeof(memory.live));
+	SDL_AtomicUnlock(&memory.lock);
+}
+
+#ifdef SVG4FNA_TRACE
+
+/* Tracing, see svg4fna.h */
+
+#define TRACE_MAX_DEPTH 64
+#define TRACE_MAX_DETAIL 32
+
+typedef struct TraceZone
+{
+	const char *name;
+	char detail[TRACE_MAX_DETAIL];
+	Uint64 start;
+	Uint64 duration;
+	SDL_threadID thread;
+} TraceZone;
+
+#if defined(_MSC_VER)
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+static struct
+{
+	svg4fna_pfn_traceBegin begin;
+	svg4fna_pfn_traceEnd end;
+	void *userdata;
+
+	// Ring buffer of finished zones, shared by every thread
+	SDL_SpinLock lock;
+	TraceZone *zones;
+	int capacity;
+	Uint64 count;
+	Uint64 base;
+} trace;
+
+// Zones that have begun but not ended yet, one stack per thread
+static TRACE_THREAD_LOCAL struct
+{
+	TraceZone stack[TRACE_MAX_DEPTH];
+	int depth;
+} traceThread;
+
+void SVG4FNA_SetTraceCallbacks(
+	svg4fna_pfn_traceBegin begin,
+	svg4fna_pfn_traceEnd end,
+	void *userdata
+) {
+	trace.begin = begin;
+	trace.end = end;
+	trace.userdata = userdata;
+	traceThread.depth = 0;
+}
+
+int SVG4FNA_StartTrace(int capacity)
+{
+	TraceZone *zones;
+
+	SVG4FNA_StopTrace();
+	if (capacity <= 0) {
+		return 0;
+	}
+	zones = (TraceZone*) malloc(sizeof(TraceZone) * capacity);
+	if (zones == NULL) {
+		return 0;
+	}
+	SDL_AtomicLock(&trace.lock);
+	trace.capacity = capacity;
+	trace.count = 0;
+	trace.base = SDL_GetPerformanceCounter();
+	SDL_AtomicSetPtr((void**) &trace.zones, zones);
+	SDL_AtomicUnlock(&trace.lock);
+	traceThread.depth = 0;
+	return 1;
+}
+
+void SVG4FNA_StopTrace(void)
+{
+	TraceZone *zones;
+
+	SDL_AtomicLock(&trace.lock);
+	zones = (TraceZone*) SDL_AtomicSetPtr((void**) &trace.zones, NULL);
+	trace.capacity = 0;
+	trace.count = 0;
+	SDL_AtomicUnlock(&trace.lock);
+	free(zones);
+}
+
+void SVG4FNA_TraceBegin(const char *name, const char *detail)
+{
+	TraceZone *zone;
+
+	if (trace.begin != NULL) {
+		trace.begin(trace.userdata, name, detail);
+		return;
+	}
+	if (SDL_AtomicGetPtr((void**) &trace.zones) == NULL) {
+		return;
+	}
+
+	// Zones nested too deep are counted but not recorded
+	traceThread.depth += 1;
+	if (traceThread.depth > TRACE_MAX_DEPTH) {
+		return;
+	}
+	zone = &traceThread.stack[traceThread.depth - 1];
+	zone->name = name;
+	if (detail != NULL) {
+		SDL_strlcpy(zone->detail, detail, TRACE_MAX_DETAIL);
+	} else {
+		zone->detail[0] = '\0';
+	}
+	zone->thread = SDL_ThreadID();
+	zone->start = SDL_GetPerformanceCounter();
+}
+
+void SVG4FNA_TraceEnd(void)
+{
+	TraceZone *zone;
+
+	if (trace.end != NULL) {
+		trace.end(trace.userdata);
+		return;
+	}
+	if (traceThread.depth == 0) {
+		return;
+	}
+
+	traceThread.depth -= 1;
+	if (traceThread.depth >= TRACE_MAX_DEPTH) {
+		return;
+	}
+	zone = &traceThread.stack[traceThread.depth];
+	zone->duration = SDL_GetPerformanceCounter() - zone->start;
+
+	// The trace may have stopped since this zone began
+	SDL_AtomicLock(&trace.lock);
+	if (trace.zones != NULL) {
+		trace.zones[trace.count % trace.capacity] = *zone;
+		trace.count += 1;
+	}
+	SDL_AtomicUnlock(&trace.lock);
+}
+
+static void INTERNAL_writeTrace(SDL_RWops *rw, const char *str)
+{
+	SDL_RWwrite(rw, str, 1, SDL_strlen(str));
+}
+
+// Escaped for a JSON string
+static void INTERNAL_writeTraceString(SDL_RWops *rw, const char *str)
+{
+	char c[8];
+	for (; *str != '\0'; str += 1) {
+		if (*str == '"' || *str == '\\') {
+			c[0] = '\\';
+			c[1] = *str;
+			SDL_RWwrite(rw, c, 1, 2);
+		} else if ((unsigned char) *str < 0x20) {
+			SDL_snprintf(c, sizeof(c), "\\u%04x", *str);
+			SDL_RWwrite(rw, c, 1, 6);
+		} else {
+			SDL_RWwrite(rw, str, 1, 1);
+		}
+	}
+}
+
+int SVG4FNA_WriteTrace(const char *path)
+{
+	SDL_RWops *rw;
+	char line[256];
+	TraceZone *zones = NULL;
+	Uint64 first, count = 0, base = 0, i;
+	double usPerTick;
+	int len;
+
+	// Copy the finished zones so other threads can keep tracing meanwhile
+	SDL_AtomicLock(&trace.lock);
+	if (trace.zones != NULL) {
+		first = (trace.count > (Uint64) trace.capacity) ? (trace.count - trace.capacity) : 0;
+		count = trace.count - first;
+		zones = (TraceZone*) malloc(sizeof(TraceZone) * (count > 0 ? count : 1));
+		if (zones != NULL) {
+			for (i = 0; i < count; i += 1) {
+				zones[i] = trace.zones[(first + i) % trace.capacity];
+			}
+		}
+		base = trace.base;
+	}
+	SDL_AtomicUnlock(&trace.lock);
+	if (zones == NULL) {
+		return 0;
+	}
+
+	rw = SDL_RWFromFile(path, "wb");
+	if (rw == NULL) {
+		free(zones);
+		return 0;
+	}
+
+	usPerTick = 1000000.0 / (double) SDL_GetPerformanceFrequency();
+
+	INTERNAL_writeTrace(rw, "{\"traceEvents\":[\n");
+	for (i = 0; i < count; i += 1) {
+		const TraceZone *zone = &zones[i];
+		len = SDL_snprintf(
+			line,
+			sizeof(line),
+			"%s{\"name\":\"%s\",\"cat\":\"svg4fna\",\"ph\":\"X\",\"pid\":1,"
+			"\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f",
+			(i == 0) ? "" : ",\n",
+			zone->name,
+			(unsigned long) zone->thread,
+			(double) (zone->start - base) * usPerTick,
+			(double) zone->duration * usPerTick
+		);
+		SDL_RWwrite(rw, line, 1, len);
+		if (zone->detail[0] != '\0') {
+			INTERNAL_writeTrace(rw, ",\"args\":{\"detail\":\"");
+			INTERNAL_writeTraceString(rw, zone->detail);
+			INTERNAL_writeTrace(rw, "\"}");
+		}
+		INTERNAL_writeTrace(rw, "}");
+	}
+	INTERNAL_writeTrace(rw, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	SDL_RWclose(rw);
+	free(zones);
+	return 1;
+}
+
+#endif /* SVG4FNA_TRACE */
@@ -0,0 +1,121 @@
+#ifndef SVG4FNA_H
+#define SVG4FNA_H
+
+#include <stddef.h>
+
+#ifdef _WIN32
+#define SVG4FNAAPI __declspec(dllexport)
+#define SVG4FNACALL __cdecl
+#else
+#define SVG4FNAAPI
+#define SVG4FNACALL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Memory: Every allocation made by the native library goes through one
+ * allocator and is tagged with what it belongs to. Live and peak bytes are
+ * counted per tag; the counts include a 16-byte header per allocation.
+ */
+typedef enum SVG4FNA_MemoryTag
+{
+	/* Rasterizer scratch, software device, decoded images, anything else */
+	SVG4FNA_MEMORY_OTHER,
+	/* nsvgParse's temporary state, freed once parsing finishes */
+	SVG4FNA_MEMORY_PARSER,
+	/* Parsed NSVGimages: shapes, paths, points and gradients, and their
+	 * NVGsvgViews
+	 */
+	SVG4FNA_MEMORY_IMAGE,
+	/* nanovg's context, command buffer and path cache */
+	SVG4FNA_MEMORY_PATHCACHE,
+	/* nanovg_gpu's frame buffers (calls, paths, vertices, uniforms) and
+	 * static geometry
+	 */
+	SVG4FNA_MEMORY_RENDERER,
+	/* fontstash's atlas and glyph cache */
+	SVG4FNA_MEMORY_FONTATLAS,
+	SVG4FNA_MEMORY_TAGCOUNT
+} SVG4FNA_MemoryTag;
+
+typedef void* (SVG4FNACALL *svg4fna_pfn_malloc)(void* userdata, size_t size, SVG4FNA_MemoryTag tag);
+typedef void* (SVG4FNACALL *svg4fna_pfn_realloc)(void* userdata, void* ptr, size_t size, SVG4FNA_MemoryTag tag);
+typedef void (SVG4FNACALL *svg4fna_pfn_free)(void* userdata, void* ptr, SVG4FNA_MemoryTag tag);
+
+/* Replaces the allocator, which defaults to SDL_malloc and friends. Pass all
+ * NULL to restore the default. This can only be done while nothing is
+ * allocated, so before creating any context or image; returns 0 otherwise.
+ */
+SVG4FNAAPI int SVG4FNA_SetAllocator(
+	svg4fna_pfn_malloc mallocFunc,
+	svg4fna_pfn_realloc reallocFunc,
+	svg4fna_pfn_free freeFunc,
+	void *userdata
+);
+
+typedef struct SVG4FNA_MemoryStats
+{
+	size_t live[SVG4FNA_MEMORY_TAGCOUNT];
+	size_t peak[SVG4FNA_MEMORY_TAGCOUNT];
+} SVG4FNA_MemoryStats;
+
+SVG4FNAAPI void SVG4FNA_GetMemoryStats(SVG4FNA_MemoryStats *stats);
+
+/* Resets each tag's peak to its current live bytes */
+SVG4FNAAPI void SVG4FNA_ResetMemoryPeaks(void);
+
+/* Tracing: Only available when built with SVG4FNA_TRACE defined (see the
+ * Makefile's trace target), otherwise every trace point compiles out.
+ *
+ * Traced zones cover nsvgParse and its phases, nvgDrawSVG per shape, path
+ * flattening and expansion in nvgFill/nvgStroke, and the nvg_gpu flush.
+ * Zones are either sent to the begin/end callbacks, or when none are set,
+ * recorded into a ring buffer that WriteTrace saves as Chrome trace-event
+ * JSON (chrome://tracing, Perfetto). Any thread may trace: each keeps its own
+ * stack of nested zones, and a zone must end on the thread that began it.
+ */
+#ifdef SVG4FNA_TRACE
+
+/* name is a string literal, detail (e.g. a shape id) may be NULL and is only
+ * valid for the duration of the callback.
+ */
+typedef void (SVG4FNACALL *svg4fna_pfn_traceBegin)(void* userdata, const char *name, const char *detail);
+typedef void (SVG4FNACALL *svg4fna_pfn_traceEnd)(void* userdata);
+
+/* Pass NULL callbacks to go back to the ring buffer */
+SVG4FNAAPI void SVG4FNA_SetTraceCallbacks(
+	svg4fna_pfn_traceBegin begin,
+	svg4fna_pfn_traceEnd end,
+	void *userdata
+);
+
+/* Starts recording into a ring buffer of capacity zones, the oldest zones are
+ * dropped once it is full. Returns 0 if the buffer could not be allocated.
+ */
+SVG4FNAAPI int SVG4FNA_StartTrace(int capacity);
+SVG4FNAAPI void SVG4FNA_StopTrace(void);
+
+/* Writes the zones recorded since StartTrace, returns 0 on failure */
+SVG4FNAAPI int SVG4FNA_WriteTrace(const char *path);
+
+/* Application zones, shown alongside the renderer's own */
+SVG4FNAAPI void SVG4FNA_TraceBegin(const char *name, const char *detail);
+SVG4FNAAPI void SVG4FNA_TraceEnd(void);
+
+#define SVG4FNA_TRACE_BEGIN(name, detail) SVG4FNA_TraceBegin(name, detail)
+#define SVG4FNA_TRACE_END() SVG4FNA_TraceEnd()
+
+#else
+
+#define SVG4FNA_TRACE_BEGIN(name, detail)
+#define SVG4FNA_TRACE_END()
+
+#endif /* SVG4FNA_TRACE */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SVG4FNA_H */
@@ -1,5 +1,6 @@
 // Vertex parameters
 float2 inverseViewSize;
+float4 vertexXform[2]; // nanovg 2x3 transform: (a, b, c, d), (e, f, 0, 0)
 
 // Pixel parameters
 sampler2D tex : register(s0);
@@ -33,11 +34,15 @@ struct VSOutput
 VSOutput VS(VSInput input)
 {
 	VSOutput output;
+	float2 pos = float2(
+		vertexXform[0].x * input.vertex.x + vertexXform[0].z * input.vertex.y + vertexXform[1].x,
+		vertexXform[0].y * input.vertex.x + vertexXform[0].w * input.vertex.y + vertexXform[1].y
+	);
 	output.ftcoord = input.tcoord;
 	output.fpos = input.vertex;
 	output.position = float4(
-		2.0 * input.vertex.x * inverseViewSize.x - 1.0,
-		1.0 - 2.0 * input.vertex.y * inverseViewSize.y,
+		2.0 * pos.x * inverseViewSize.x - 1.0,
+		1.0 - 2.0 * pos.y * inverseViewSize.y,
 		0,
 		1
 	);
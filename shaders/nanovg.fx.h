@@ -14,6 +14,7 @@ technique EdgeAA_Gradient_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -21,23 +22,27 @@ technique EdgeAA_Gradient_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -118,6 +123,7 @@ technique EdgeAA_Gradient_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -125,23 +131,27 @@ technique EdgeAA_Gradient_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -222,6 +232,7 @@ technique EdgeAA_Gradient_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -229,23 +240,27 @@ technique EdgeAA_Gradient_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -326,6 +341,7 @@ technique EdgeAA_Image_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -333,23 +349,27 @@ technique EdgeAA_Image_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -421,6 +441,7 @@ technique EdgeAA_Image_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -428,23 +449,27 @@ technique EdgeAA_Image_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -517,6 +542,7 @@ technique EdgeAA_Image_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -524,23 +550,27 @@ technique EdgeAA_Image_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -612,6 +642,7 @@ technique EdgeAA_StencilFill_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -619,23 +650,27 @@ technique EdgeAA_StencilFill_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -685,6 +720,7 @@ technique EdgeAA_StencilFill_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -692,23 +728,27 @@ technique EdgeAA_StencilFill_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -758,6 +798,7 @@ technique EdgeAA_StencilFill_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -765,23 +806,27 @@ technique EdgeAA_StencilFill_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -831,6 +876,7 @@ technique EdgeAA_Tris_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -838,23 +884,27 @@ technique EdgeAA_Tris_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -918,6 +968,7 @@ technique EdgeAA_Tris_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -925,23 +976,27 @@ technique EdgeAA_Tris_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1006,6 +1061,7 @@ technique EdgeAA_Tris_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1013,23 +1069,27 @@ technique EdgeAA_Tris_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1093,6 +1153,7 @@ technique NoAA_Gradient_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1100,23 +1161,27 @@ technique NoAA_Gradient_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1184,6 +1249,7 @@ technique NoAA_Gradient_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1191,23 +1257,27 @@ technique NoAA_Gradient_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1275,6 +1345,7 @@ technique NoAA_Gradient_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1282,23 +1353,27 @@ technique NoAA_Gradient_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1366,6 +1441,7 @@ technique NoAA_Image_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1373,23 +1449,27 @@ technique NoAA_Image_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1449,6 +1529,7 @@ technique NoAA_Image_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1456,23 +1537,27 @@ technique NoAA_Image_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1533,6 +1618,7 @@ technique NoAA_Image_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1540,23 +1626,27 @@ technique NoAA_Image_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1616,6 +1706,7 @@ technique NoAA_StencilFill_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1623,23 +1714,27 @@ technique NoAA_StencilFill_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1667,6 +1762,7 @@ technique NoAA_StencilFill_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1674,23 +1770,27 @@ technique NoAA_StencilFill_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1718,6 +1818,7 @@ technique NoAA_StencilFill_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1725,23 +1826,27 @@ technique NoAA_StencilFill_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1769,6 +1874,7 @@ technique NoAA_Tris_Premultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1776,23 +1882,27 @@ technique NoAA_Tris_Premultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1847,6 +1957,7 @@ technique NoAA_Tris_Nonpremultiplied
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1854,23 +1965,27 @@ technique NoAA_Tris_Nonpremultiplied
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1926,6 +2041,7 @@ technique NoAA_Tris_Alpha
             // Parameters:
             //
             //   float2 inverseViewSize;
+            //   float4 vertexXform[2];
             //
             //
             // Registers:
@@ -1933,23 +2049,27 @@ technique NoAA_Tris_Alpha
             //   Name            Reg   Size
             //   --------------- ----- ----
             //   inverseViewSize c0       1
+            //   vertexXform     c1       2
             //
             
                 vs_3_0
-                def c1, 2, -1, 1, 0
+                def c3, 2, -1, 1, 0
                 dcl_position v0
                 dcl_texcoord v1
                 dcl_position o0
                 dcl_texcoord o1.xy
                 dcl_normal o2.xy
-                mul r0.xy, c0, v0
-                mad o0.x, r0.x, c1.x, c1.y
-                mad o0.y, r0.y, -c1.x, c1.z
-                mov o0.zw, c1.xywz
+                mul r0.xy, c1.zwzw, v0.y
+                mad r0.xy, c1, v0.x, r0
+                add r0.xy, r0, c2
+                mul r0.xy, r0, c0
+                mad o0.x, r0.x, c3.x, c3.y
+                mad o0.y, r0.y, -c3.x, c3.z
+                mov o0.zw, c3.xywz
                 mov o1.xy, v1
                 mov o2.xy, v0
             
-            // approximately 6 instruction slots used
+            // approximately 9 instruction slots used
             };
 
         pixelshader = 
@@ -1996,7 +2116,7 @@ technique NoAA_Tris_Alpha
 
 const unsigned char g_main[] =
 {
-      1,   9, 255, 254, 112,   9, 
+      1,   9, 255, 254, 188,   9, 
       0,   0,   0,   0,   0,   0, 
       3,   0,   0,   0,   1,   0, 
       0,   0,  40,   0,   0,   0, 
@@ -2400,246 +2520,446 @@ const unsigned char g_main[] =
       0,   0,  78, 111,  65,  65, 
      95,  84, 114, 105, 115,  95, 
      65, 108, 112, 104,  97,   0, 
-      3,   0,   0,   0,  24,   0, 
-      0,   0,  73,   0,   0,   0, 
-     49,   0,   0,   0,   4,   0, 
-      0,   0,  32,   0,   0,   0, 
+      3,   0,   0,   0,   1,   0, 
+      0,   0, 172,   9,   0,   0, 
+      0,   0,   0,   0,   2,   0, 
+      0,   0,   4,   0,   0,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  60,   0,   0,   0, 
-     80,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     92,   0,   0,   0, 120,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 108,   1, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 100,   1, 
       0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0, 146,   0, 
+     12,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   4,   0, 
+      0,   0,  24,   0,   0,   0, 
+     73,   0,   0,   0,  49,   0, 
+      0,   0,   4,   0,   0,   0, 
+     32,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     56,   1,   0,   0,  52,   1, 
-      0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0,  80,   1, 
-      0,   0,  76,   1,   0,   0, 
-    200,   1,   0,   0,   0,   0, 
+    112,   9,   0,   0, 140,   9, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,  60,   0, 
+      0,   0,  80,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,  92,   0,   0,   0, 
+    120,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    108,   1,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    192,   1,   0,   0,   0,   0, 
+    100,   1,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 148,   1,   0,   0, 
-    144,   1,   0,   0, 147,   0, 
+      0,   0,  56,   1,   0,   0, 
+     52,   1,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    172,   1,   0,   0, 168,   1, 
-      0,   0,  40,   2,   0,   0, 
+     80,   1,   0,   0,  76,   1, 
+      0,   0, 200,   1,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  32,   2,   0,   0, 
+      0,   0, 192,   1,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0, 244,   1, 
-      0,   0, 240,   1,   0,   0, 
+      0,   0,   0,   0, 148,   1, 
+      0,   0, 144,   1,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  12,   2,   0,   0, 
-      8,   2,   0,   0, 124,   2, 
+      0,   0, 172,   1,   0,   0, 
+    168,   1,   0,   0,  40,   2, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 116,   2, 
+      1,   0,   0,   0,  32,   2, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-     72,   2,   0,   0,  68,   2, 
+    244,   1,   0,   0, 240,   1, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0,  96,   2, 
-      0,   0,  92,   2,   0,   0, 
-    212,   2,   0,   0,   0,   0, 
+      0,   0,   0,   0,  12,   2, 
+      0,   0,   8,   2,   0,   0, 
+    124,   2,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    204,   2,   0,   0,   0,   0, 
+    116,   2,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 160,   2,   0,   0, 
-    156,   2,   0,   0, 147,   0, 
+      0,   0,  72,   2,   0,   0, 
+     68,   2,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    184,   2,   0,   0, 180,   2, 
-      0,   0,  48,   3,   0,   0, 
+     96,   2,   0,   0,  92,   2, 
+      0,   0, 212,   2,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  40,   3,   0,   0, 
+      0,   0, 204,   2,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0, 252,   2, 
-      0,   0, 248,   2,   0,   0, 
+      0,   0,   0,   0, 160,   2, 
+      0,   0, 156,   2,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  20,   3,   0,   0, 
-     16,   3,   0,   0, 128,   3, 
+      0,   0, 184,   2,   0,   0, 
+    180,   2,   0,   0,  48,   3, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 120,   3, 
+      1,   0,   0,   0,  40,   3, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-     76,   3,   0,   0,  72,   3, 
+    252,   2,   0,   0, 248,   2, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 100,   3, 
-      0,   0,  96,   3,   0,   0, 
-    224,   3,   0,   0,   0,   0, 
+      0,   0,   0,   0,  20,   3, 
+      0,   0,  16,   3,   0,   0, 
+    128,   3,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    216,   3,   0,   0,   0,   0, 
+    120,   3,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 172,   3,   0,   0, 
-    168,   3,   0,   0, 147,   0, 
+      0,   0,  76,   3,   0,   0, 
+     72,   3,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    196,   3,   0,   0, 192,   3, 
-      0,   0,  64,   4,   0,   0, 
+    100,   3,   0,   0,  96,   3, 
+      0,   0, 224,   3,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  56,   4,   0,   0, 
+      0,   0, 216,   3,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  12,   4, 
-      0,   0,   8,   4,   0,   0, 
+      0,   0,   0,   0, 172,   3, 
+      0,   0, 168,   3,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  36,   4,   0,   0, 
-     32,   4,   0,   0, 152,   4, 
+      0,   0, 196,   3,   0,   0, 
+    192,   3,   0,   0,  64,   4, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 144,   4, 
+      1,   0,   0,   0,  56,   4, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-    100,   4,   0,   0,  96,   4, 
+     12,   4,   0,   0,   8,   4, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 124,   4, 
-      0,   0, 120,   4,   0,   0, 
-    240,   4,   0,   0,   0,   0, 
+      0,   0,   0,   0,  36,   4, 
+      0,   0,  32,   4,   0,   0, 
+    152,   4,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    232,   4,   0,   0,   0,   0, 
+    144,   4,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 188,   4,   0,   0, 
-    184,   4,   0,   0, 147,   0, 
+      0,   0, 100,   4,   0,   0, 
+     96,   4,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    212,   4,   0,   0, 208,   4, 
-      0,   0,  76,   5,   0,   0, 
+    124,   4,   0,   0, 120,   4, 
+      0,   0, 240,   4,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  68,   5,   0,   0, 
+      0,   0, 232,   4,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  24,   5, 
-      0,   0,  20,   5,   0,   0, 
+      0,   0,   0,   0, 188,   4, 
+      0,   0, 184,   4,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  48,   5,   0,   0, 
-     44,   5,   0,   0, 156,   5, 
+      0,   0, 212,   4,   0,   0, 
+    208,   4,   0,   0,  76,   5, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 148,   5, 
+      1,   0,   0,   0,  68,   5, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-    104,   5,   0,   0, 100,   5, 
+     24,   5,   0,   0,  20,   5, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 128,   5, 
-      0,   0, 124,   5,   0,   0, 
-    244,   5,   0,   0,   0,   0, 
+      0,   0,   0,   0,  48,   5, 
+      0,   0,  44,   5,   0,   0, 
+    156,   5,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    236,   5,   0,   0,   0,   0, 
+    148,   5,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 192,   5,   0,   0, 
-    188,   5,   0,   0, 147,   0, 
+      0,   0, 104,   5,   0,   0, 
+    100,   5,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    216,   5,   0,   0, 212,   5, 
-      0,   0,  80,   6,   0,   0, 
+    128,   5,   0,   0, 124,   5, 
+      0,   0, 244,   5,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  72,   6,   0,   0, 
+      0,   0, 236,   5,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  28,   6, 
-      0,   0,  24,   6,   0,   0, 
+      0,   0,   0,   0, 192,   5, 
+      0,   0, 188,   5,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  52,   6,   0,   0, 
-     48,   6,   0,   0, 160,   6, 
+      0,   0, 216,   5,   0,   0, 
+    212,   5,   0,   0,  80,   6, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 152,   6, 
+      1,   0,   0,   0,  72,   6, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-    108,   6,   0,   0, 104,   6, 
+     28,   6,   0,   0,  24,   6, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 132,   6, 
-      0,   0, 128,   6,   0,   0, 
-    248,   6,   0,   0,   0,   0, 
+      0,   0,   0,   0,  52,   6, 
+      0,   0,  48,   6,   0,   0, 
+    160,   6,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    240,   6,   0,   0,   0,   0, 
+    152,   6,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 196,   6,   0,   0, 
-    192,   6,   0,   0, 147,   0, 
+      0,   0, 108,   6,   0,   0, 
+    104,   6,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    220,   6,   0,   0, 216,   6, 
-      0,   0,  80,   7,   0,   0, 
+    132,   6,   0,   0, 128,   6, 
+      0,   0, 248,   6,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  72,   7,   0,   0, 
+      0,   0, 240,   6,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  28,   7, 
-      0,   0,  24,   7,   0,   0, 
+      0,   0,   0,   0, 196,   6, 
+      0,   0, 192,   6,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  52,   7,   0,   0, 
-     48,   7,   0,   0, 160,   7, 
+      0,   0, 220,   6,   0,   0, 
+    216,   6,   0,   0,  80,   7, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 152,   7, 
+      1,   0,   0,   0,  72,   7, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-    108,   7,   0,   0, 104,   7, 
+     28,   7,   0,   0,  24,   7, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 132,   7, 
-      0,   0, 128,   7,   0,   0, 
-    252,   7,   0,   0,   0,   0, 
+      0,   0,   0,   0,  52,   7, 
+      0,   0,  48,   7,   0,   0, 
+    160,   7,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    244,   7,   0,   0,   0,   0, 
+    152,   7,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 200,   7,   0,   0, 
-    196,   7,   0,   0, 147,   0, 
+      0,   0, 108,   7,   0,   0, 
+    104,   7,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    224,   7,   0,   0, 220,   7, 
-      0,   0,  92,   8,   0,   0, 
+    132,   7,   0,   0, 128,   7, 
+      0,   0, 252,   7,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  84,   8,   0,   0, 
+      0,   0, 244,   7,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  40,   8, 
-      0,   0,  36,   8,   0,   0, 
+      0,   0,   0,   0, 200,   7, 
+      0,   0, 196,   7,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  64,   8,   0,   0, 
-     60,   8,   0,   0, 176,   8, 
+      0,   0, 224,   7,   0,   0, 
+    220,   7,   0,   0,  92,   8, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 168,   8, 
+      1,   0,   0,   0,  84,   8, 
       0,   0,   0,   0,   0,   0, 
       2,   0,   0,   0, 146,   0, 
       0,   0,   0,   0,   0,   0, 
-    124,   8,   0,   0, 120,   8, 
+     40,   8,   0,   0,  36,   8, 
       0,   0, 147,   0,   0,   0, 
-      0,   0,   0,   0, 148,   8, 
-      0,   0, 144,   8,   0,   0, 
-      4,   9,   0,   0,   0,   0, 
+      0,   0,   0,   0,  64,   8, 
+      0,   0,  60,   8,   0,   0, 
+    176,   8,   0,   0,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-    252,   8,   0,   0,   0,   0, 
+    168,   8,   0,   0,   0,   0, 
       0,   0,   2,   0,   0,   0, 
     146,   0,   0,   0,   0,   0, 
-      0,   0, 208,   8,   0,   0, 
-    204,   8,   0,   0, 147,   0, 
+      0,   0, 124,   8,   0,   0, 
+    120,   8,   0,   0, 147,   0, 
       0,   0,   0,   0,   0,   0, 
-    232,   8,   0,   0, 228,   8, 
-      0,   0,  92,   9,   0,   0, 
+    148,   8,   0,   0, 144,   8, 
+      0,   0,   4,   9,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,  84,   9,   0,   0, 
+      0,   0, 252,   8,   0,   0, 
       0,   0,   0,   0,   2,   0, 
       0,   0, 146,   0,   0,   0, 
-      0,   0,   0,   0,  40,   9, 
-      0,   0,  36,   9,   0,   0, 
+      0,   0,   0,   0, 208,   8, 
+      0,   0, 204,   8,   0,   0, 
     147,   0,   0,   0,   0,   0, 
-      0,   0,  64,   9,   0,   0, 
-     60,   9,   0,   0,   0,   0, 
-      0,   0,  48,   0,   0,   0, 
-     23,   0,   0,   0,   0,   0, 
+      0,   0, 232,   8,   0,   0, 
+    228,   8,   0,   0,  92,   9, 
+      0,   0,   0,   0,   0,   0, 
+      1,   0,   0,   0,  84,   9, 
+      0,   0,   0,   0,   0,   0, 
+      2,   0,   0,   0, 146,   0, 
+      0,   0,   0,   0,   0,   0, 
+     40,   9,   0,   0,  36,   9, 
+      0,   0, 147,   0,   0,   0, 
+      0,   0,   0,   0,  64,   9, 
+      0,   0,  60,   9,   0,   0, 
+      0,   0,   0,   0,  48,   0, 
+      0,   0,  23,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   1,   0,   0,   0, 
+      0,   0,   0,   0,  72,   2, 
+      0,   0,   0,   3, 255, 255, 
+    254, 255,  87,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+     39,   1,   0,   0,   0,   3, 
+    255, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32,  32,   1,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   9,   0,   0,   0, 
+     76,   0,   0,   0,  92,   0, 
+      0,   0,  12,   1,   0,   0, 
+      3,   0,   0,   0,   1,   0, 
+      2,   0,  16,   1,   0,   0, 
+      0,   0,   0,   0, 102, 114, 
+     97, 103,   0, 171, 171, 171, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,  11,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    116, 101, 120,   0,   4,   0, 
+     12,   0,   1,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 112, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   9,   0,  15, 160, 
+      0,   0,   0,  63,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      0,   0,   3, 144,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      1,   0,   3, 144,  31,   0, 
+      0,   2,   0,   0,   0, 144, 
+      0,   8,  15, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      1,   0, 228, 160,   1,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   0,   0, 
+    228, 160,   1,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 139,   8,   0, 228, 161, 
+      1,   0,   0,   2,   0,   0, 
+     12, 128,   8,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+     19, 128,   0,   0, 228, 128, 
+      0,   0, 238, 129,   9,   0, 
+      0, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 128,   0,   0,   0, 128, 
+     66,   0,   0,   3,   1,   0, 
+     15, 128,   0,   0, 228, 144, 
+      0,   8, 228, 160,   5,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,   0, 128,   1,   0, 
+    255, 128,   5,   0,   0,   3, 
+      0,   8,  15, 128,   0,   0, 
+      0, 128,   6,   0, 228, 160, 
+    255, 255,   0,   0,  23,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     22,   0,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
       1,   0,   0,   0,   0,   0, 
-      0,   0,  72,   2,   0,   0, 
+      0,   0,  88,   2,   0,   0, 
       0,   3, 255, 255, 254, 255, 
      87,   0,  67,  84,  65,  66, 
      28,   0,   0,   0,  39,   1, 
@@ -2732,25 +3052,31 @@ const unsigned char g_main[] =
       0,   3,   1,   0,  15, 128, 
       0,   0, 228, 144,   0,   8, 
     228, 160,   5,   0,   0,   3, 
-      0,   0,   1, 128,   0,   0, 
-      0, 128,   1,   0, 255, 128, 
-      5,   0,   0,   3,   0,   8, 
+      1,   0,   7, 128,   1,   0, 
+    255, 128,   1,   0, 228, 128, 
+      5,   0,   0,   3,   0,   0, 
      15, 128,   0,   0,   0, 128, 
-      6,   0, 228, 160, 255, 255, 
-      0,   0,  23,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
+      1,   0, 228, 128,   5,   0, 
+      0,   3,   0,   8,  15, 128, 
+      0,   0, 228, 128,   6,   0, 
+    228, 160, 255, 255,   0,   0, 
+     22,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
+      0,   3, 254, 255, 254, 255, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
       0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+    176,   0,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
       0,   0, 105, 110, 118, 101, 
     114, 115, 101,  86, 105, 101, 
     119,  83, 105, 122, 101,   0, 
@@ -2759,9 +3085,19 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
      32,  40,  82,  41,  32,  72, 
      76,  83,  76,  32,  83, 104, 
      97, 100, 101, 114,  32,  67, 
@@ -2769,7 +3105,7 @@ const unsigned char g_main[] =
     114,  32,  57,  46,  50,  57, 
      46,  57,  53,  50,  46,  51, 
      49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
+      0,   5,   3,   0,  15, 160, 
       0,   0,   0,  64,   0,   0, 
     128, 191,   0,   0, 128,  63, 
       0,   0,   0,   0,  31,   0, 
@@ -2784,42 +3120,50 @@ const unsigned char g_main[] =
       0,   2,   3,   0,   0, 128, 
       2,   0,   3, 224,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  22,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     88,   2,   0,   0,   0,   3, 
-    255, 255, 254, 255,  87,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0,  39,   1,   0,   0, 
-      0,   3, 255, 255,   2,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  32,   1, 
-      0,   0,  68,   0,   0,   0, 
-      2,   0,   0,   0,   9,   0, 
-      0,   0,  76,   0,   0,   0, 
-     92,   0,   0,   0,  12,   1, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   2,   0,  16,   1, 
-      0,   0,   0,   0,   0,   0, 
-    102, 114,  97, 103,   0, 171, 
-    171, 171,   1,   0,   3,   0, 
-      1,   0,   4,   0,  11,   0, 
-      0,   0,   0,   0,   0,   0, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   0,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 224,   0,   0,   0, 128, 
+      3,   0,   0, 160,   3,   0, 
+     85, 160,   4,   0,   0,   4, 
+      0,   0,   2, 224,   0,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
+      0,   2,   0,   0,  12, 224, 
+      3,   0, 180, 160,   1,   0, 
+      0,   2,   1,   0,   3, 224, 
+      1,   0, 228, 144,   1,   0, 
+      0,   2,   2,   0,   3, 224, 
+      0,   0, 228, 144, 255, 255, 
+      0,   0,  21,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   1,   0,   0,   0, 
+      0,   0,   0,   0,  72,   2, 
+      0,   0,   0,   3, 255, 255, 
+    254, 255,  87,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+     39,   1,   0,   0,   0,   3, 
+    255, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32,  32,   1,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   9,   0,   0,   0, 
+     76,   0,   0,   0,  92,   0, 
+      0,   0,  12,   1,   0,   0, 
+      3,   0,   0,   0,   1,   0, 
+      2,   0,  16,   1,   0,   0, 
+      0,   0,   0,   0, 102, 114, 
+     97, 103,   0, 171, 171, 171, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,  11,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -2849,176 +3193,94 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 116, 101, 120,   0, 
-      4,   0,  12,   0,   1,   0, 
-      1,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 112, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   9,   0, 
-     15, 160,   0,   0,   0,  63, 
       0,   0,   0,   0,   0,   0, 
+    116, 101, 120,   0,   4,   0, 
+     12,   0,   1,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 112, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   9,   0,  15, 160, 
+      0,   0,   0,  63,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   0,   0,   3, 144, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   1,   0,   3, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 144,   0,   8,  15, 160, 
-      5,   0,   0,   3,   0,   0, 
-      3, 128,   1,   0, 228, 160, 
-      1,   0,  85, 144,   4,   0, 
-      0,   4,   0,   0,   3, 128, 
-      0,   0, 228, 160,   1,   0, 
-      0, 144,   0,   0, 228, 128, 
-      2,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 128, 
-      2,   0, 228, 160,   2,   0, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      0,   0,   3, 144,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      1,   0,   3, 144,  31,   0, 
+      0,   2,   0,   0,   0, 144, 
+      0,   8,  15, 160,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 139,   8,   0, 
-    228, 161,   1,   0,   0,   2, 
-      0,   0,  12, 128,   8,   0, 
-    228, 160,   4,   0,   0,   4, 
-      0,   0,  19, 128,   0,   0, 
-    228, 128,   0,   0, 238, 129, 
-      9,   0,   0, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,  85, 128,   0,   0, 
-      0, 128,  66,   0,   0,   3, 
-      1,   0,  15, 128,   0,   0, 
-    228, 144,   0,   8, 228, 160, 
-      5,   0,   0,   3,   1,   0, 
-      7, 128,   1,   0, 255, 128, 
-      1,   0, 228, 128,   5,   0, 
+      1,   0, 228, 160,   1,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   0,   0, 
+    228, 160,   1,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 139,   8,   0, 228, 161, 
+      1,   0,   0,   2,   0,   0, 
+     12, 128,   8,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+     19, 128,   0,   0, 228, 128, 
+      0,   0, 238, 129,   9,   0, 
+      0, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 128,   0,   0,   0, 128, 
+     66,   0,   0,   3,   1,   0, 
+     15, 128,   0,   0, 228, 144, 
+      0,   8, 228, 160,   5,   0, 
       0,   3,   0,   0,  15, 128, 
       0,   0,   0, 128,   1,   0, 
     228, 128,   5,   0,   0,   3, 
       0,   8,  15, 128,   0,   0, 
     228, 128,   6,   0, 228, 160, 
-    255, 255,   0,   0,  22,   0, 
+    255, 255,   0,   0,  21,   0, 
       0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
       2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
-    118, 101, 114, 115, 101,  86, 
-    105, 101, 119,  83, 105, 122, 
-    101,   0,   1,   0,   3,   0, 
-      1,   0,   2,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 118, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
-     15, 160,   0,   0,   0,  64, 
-      0,   0, 128, 191,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,  15, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 224, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,   3, 224, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   2,   0,   3, 224, 
-      5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
-      0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
-      4,   0,   0,   4,   0,   0, 
-      2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
-    170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
-    180, 160,   1,   0,   0,   2, 
-      1,   0,   3, 224,   1,   0, 
-    228, 144,   1,   0,   0,   2, 
-      2,   0,   3, 224,   0,   0, 
-    228, 144, 255, 255,   0,   0, 
-     21,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
       1,   0,   0,   0,   0,   0, 
-      0,   0,  72,   2,   0,   0, 
-      0,   3, 255, 255, 254, 255, 
-     87,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0,  39,   1, 
-      0,   0,   0,   3, 255, 255, 
-      2,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     32,   1,   0,   0,  68,   0, 
-      0,   0,   2,   0,   0,   0, 
-      9,   0,   0,   0,  76,   0, 
-      0,   0,  92,   0,   0,   0, 
-     12,   1,   0,   0,   3,   0, 
-      0,   0,   1,   0,   2,   0, 
-     16,   1,   0,   0,   0,   0, 
-      0,   0, 102, 114,  97, 103, 
-      0, 171, 171, 171,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-     11,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 116, 101, 
-    120,   0,   4,   0,  12,   0, 
-      1,   0,   1,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    112, 115,  95,  51,  95,  48, 
+    118, 115,  95,  51,  95,  48, 
       0,  77, 105,  99, 114, 111, 
     115, 111, 102, 116,  32,  40, 
      82,  41,  32,  72,  76,  83, 
@@ -3028,397 +3290,395 @@ const unsigned char g_main[] =
      57,  46,  50,  57,  46,  57, 
      53,  50,  46,  51,  49,  49, 
      49,   0,  81,   0,   0,   5, 
-      9,   0,  15, 160,   0,   0, 
-      0,  63,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
       0,   0,  31,   0,   0,   2, 
-      5,   0,   0, 128,   0,   0, 
-      3, 144,  31,   0,   0,   2, 
-      3,   0,   0, 128,   1,   0, 
-      3, 144,  31,   0,   0,   2, 
-      0,   0,   0, 144,   0,   8, 
-     15, 160,   5,   0,   0,   3, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
       0,   0,   3, 128,   1,   0, 
-    228, 160,   1,   0,  85, 144, 
+    238, 160,   0,   0,  85, 144, 
       4,   0,   0,   4,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      1,   0,   0, 144,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
     228, 128,   2,   0,   0,   3, 
       0,   0,   3, 128,   0,   0, 
     228, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 139, 
-      8,   0, 228, 161,   1,   0, 
-      0,   2,   0,   0,  12, 128, 
-      8,   0, 228, 160,   4,   0, 
-      0,   4,   0,   0,  19, 128, 
-      0,   0, 228, 128,   0,   0, 
-    238, 129,   9,   0,   0, 160, 
       5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,  85, 128, 
-      0,   0,   0, 128,  66,   0, 
-      0,   3,   1,   0,  15, 128, 
-      0,   0, 228, 144,   0,   8, 
-    228, 160,   5,   0,   0,   3, 
-      0,   0,  15, 128,   0,   0, 
-      0, 128,   1,   0, 228, 128, 
-      5,   0,   0,   3,   0,   8, 
-     15, 128,   0,   0, 228, 128, 
-      6,   0, 228, 160, 255, 255, 
-      0,   0,  21,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     20,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 136,   0,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     22,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0,  35,   0, 
+      0,   0,   0,   3, 255, 255, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   1,   0,  32, 
+     28,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   0,   0, 
+     15, 160,   0,   0, 128,  63, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
+      1,   0,   0,   2,   0,   8, 
+     15, 128,   0,   0,   0, 160, 
     255, 255,   0,   0,  20,   0, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
+    255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    136,   0,   0,   0,   0,   3, 
-    255, 255, 254, 255,  22,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0,  35,   0,   0,   0, 
-      0,   3, 255, 255,   0,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   1,   0,  32,  28,   0, 
-      0,   0, 112, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   0,   0,  15, 160, 
-      0,   0, 128,  63,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   2,   0,   8,  15, 128, 
-      0,   0,   0, 160, 255, 255, 
-      0,   0,  20,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
       1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  19,   0, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    136,   0,   0,   0,   0,   3, 
-    255, 255, 254, 255,  22,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0,  35,   0,   0,   0, 
-      0,   3, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   1,   0,  32,  28,   0, 
-      0,   0, 112, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   0,   0,  15, 160, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
       0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     19,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 136,   0,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     22,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0,  35,   0, 
+      0,   0,   0,   3, 255, 255, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   2,   0,   8,  15, 128, 
-      0,   0,   0, 160, 255, 255, 
-      0,   0,  19,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  18,   0, 
+      0,   0,   0,   1,   0,  32, 
+     28,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   0,   0, 
+     15, 160,   0,   0, 128,  63, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    136,   0,   0,   0,   0,   3, 
-    255, 255, 254, 255,  22,   0, 
+      1,   0,   0,   2,   0,   8, 
+     15, 128,   0,   0,   0, 160, 
+    255, 255,   0,   0,  19,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0,  35,   0,   0,   0, 
-      0,   3, 255, 255,   0,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   1,   0,  32,  28,   0, 
-      0,   0, 112, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   0,   0,  15, 160, 
-      0,   0, 128,  63,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   2,   0,   8,  15, 128, 
-      0,   0,   0, 160, 255, 255, 
-      0,   0,  18,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
       1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  17,   0, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    152,   2,   0,   0,   0,   3, 
-    255, 255, 254, 255,  87,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     18,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 136,   0,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     22,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0,  35,   0, 
+      0,   0,   0,   3, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   1,   0,  32, 
+     28,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   0,   0, 
+     15, 160,   0,   0, 128,  63, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      1,   0,   0,   2,   0,   8, 
+     15, 128,   0,   0,   0, 160, 
+    255, 255,   0,   0,  18,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0,  39,   1,   0,   0, 
-      0,   3, 255, 255,   2,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  32,   1, 
+      0,   1,   0,  32, 176,   0, 
       0,   0,  68,   0,   0,   0, 
-      2,   0,   0,   0,  10,   0, 
-      0,   0,  76,   0,   0,   0, 
-     92,   0,   0,   0,  12,   1, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   2,   0,  16,   1, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    102, 114,  97, 103,   0, 171, 
-    171, 171,   1,   0,   3,   0, 
-      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     17,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 152,   2,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     87,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0,  39,   1, 
+      0,   0,   0,   3, 255, 255, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+     32,   1,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+     10,   0,   0,   0,  76,   0, 
+      0,   0,  92,   0,   0,   0, 
+     12,   1,   0,   0,   3,   0, 
+      0,   0,   1,   0,   2,   0, 
+     16,   1,   0,   0,   0,   0, 
+      0,   0, 102, 114,  97, 103, 
+      0, 171, 171, 171,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+     11,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -3441,152 +3701,182 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 116, 101, 120,   0, 
-      4,   0,  12,   0,   1,   0, 
-      1,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 112, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,  10,   0, 
-     15, 160,   0,   0,   0,  63, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   0,   0,   3, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 144,   0,   8,  15, 160, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 116, 101, 
+    120,   0,   4,   0,  12,   0, 
+      1,   0,   1,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+    112, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+     10,   0,  15, 160,   0,   0, 
+      0,  63,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      3,   0,   0, 128,   0,   0, 
+      3, 144,  31,   0,   0,   2, 
+      0,   0,   0, 144,   0,   8, 
+     15, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   4,   0, 
+    228, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   3,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   5,   0, 228, 160, 
+      6,   0,   0,   2,   1,   0, 
+      1, 128,   9,   0,   0, 160, 
+      6,   0,   0,   2,   1,   0, 
+      2, 128,   9,   0,  85, 160, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   4,   0, 228, 160, 
-      0,   0,  85, 144,   4,   0, 
-      0,   4,   0,   0,   3, 128, 
-      3,   0, 228, 160,   0,   0, 
-      0, 144,   0,   0, 228, 128, 
-      2,   0,   0,   3,   0,   0, 
       3, 128,   0,   0, 228, 128, 
-      5,   0, 228, 160,   6,   0, 
-      0,   2,   1,   0,   1, 128, 
-      9,   0,   0, 160,   6,   0, 
-      0,   2,   1,   0,   2, 128, 
-      9,   0,  85, 160,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 128,   1,   0, 
-    228, 128,  66,   0,   0,   3, 
+      1,   0, 228, 128,  66,   0, 
+      0,   3,   0,   0,  15, 128, 
+      0,   0, 228, 128,   0,   8, 
+    228, 160,   5,   0,   0,   3, 
       0,   0,  15, 128,   0,   0, 
-    228, 128,   0,   8, 228, 160, 
-      5,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0, 255, 128, 
-      6,   0, 228, 160,   5,   0, 
-      0,   3,   1,   0,   3, 128, 
-      1,   0, 228, 160,   0,   0, 
-     85, 144,   4,   0,   0,   4, 
-      1,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0,   0, 144, 
-      1,   0, 228, 128,   2,   0, 
+    255, 128,   6,   0, 228, 160, 
+      5,   0,   0,   3,   1,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   1,   0,   3, 128, 
+      0,   0, 228, 160,   0,   0, 
+      0, 144,   1,   0, 228, 128, 
+      2,   0,   0,   3,   1,   0, 
+      3, 128,   1,   0, 228, 128, 
+      2,   0, 228, 160,   2,   0, 
       0,   3,   1,   0,   3, 128, 
-      1,   0, 228, 128,   2,   0, 
-    228, 160,   2,   0,   0,   3, 
-      1,   0,   3, 128,   1,   0, 
-    228, 139,   8,   0, 228, 161, 
-      1,   0,   0,   2,   1,   0, 
-     12, 128,   8,   0, 228, 160, 
-      4,   0,   0,   4,   1,   0, 
-     19, 128,   1,   0, 228, 128, 
-      1,   0, 238, 129,  10,   0, 
-      0, 160,   5,   0,   0,   3, 
-      1,   0,   1, 128,   1,   0, 
-     85, 128,   1,   0,   0, 128, 
-      5,   0,   0,   3,   0,   8, 
-     15, 128,   0,   0, 228, 128, 
-      1,   0,   0, 128, 255, 255, 
-      0,   0,  17,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
+      1,   0, 228, 139,   8,   0, 
+    228, 161,   1,   0,   0,   2, 
+      1,   0,  12, 128,   8,   0, 
+    228, 160,   4,   0,   0,   4, 
+      1,   0,  19, 128,   1,   0, 
+    228, 128,   1,   0, 238, 129, 
+     10,   0,   0, 160,   5,   0, 
+      0,   3,   1,   0,   1, 128, 
+      1,   0,  85, 128,   1,   0, 
+      0, 128,   5,   0,   0,   3, 
+      0,   8,  15, 128,   0,   0, 
+    228, 128,   1,   0,   0, 128, 
+    255, 255,   0,   0,  17,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
       1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  16,   0, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    168,   2,   0,   0,   0,   3, 
-    255, 255, 254, 255,  87,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0,  39,   1,   0,   0, 
-      0,   3, 255, 255,   2,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  32,   1, 
-      0,   0,  68,   0,   0,   0, 
-      2,   0,   0,   0,  10,   0, 
-      0,   0,  76,   0,   0,   0, 
-     92,   0,   0,   0,  12,   1, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   2,   0,  16,   1, 
       0,   0,   0,   0,   0,   0, 
-    102, 114,  97, 103,   0, 171, 
-    171, 171,   1,   0,   3,   0, 
-      1,   0,   4,   0,  11,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+     16,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 168,   2,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     87,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0,  39,   1, 
+      0,   0,   0,   3, 255, 255, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+     32,   1,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+     10,   0,   0,   0,  76,   0, 
+      0,   0,  92,   0,   0,   0, 
+     12,   1,   0,   0,   3,   0, 
+      0,   0,   1,   0,   2,   0, 
+     16,   1,   0,   0,   0,   0, 
+      0,   0, 102, 114,  97, 103, 
+      0, 171, 171, 171,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+     11,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -3616,11 +3906,109 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 116, 101, 
+    120,   0,   4,   0,  12,   0, 
+      1,   0,   1,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 116, 101, 120,   0, 
-      4,   0,  12,   0,   1,   0, 
-      1,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 112, 115, 
+    112, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+     10,   0,  15, 160,   0,   0, 
+      0,  63,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      3,   0,   0, 128,   0,   0, 
+      3, 144,  31,   0,   0,   2, 
+      0,   0,   0, 144,   0,   8, 
+     15, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   4,   0, 
+    228, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   3,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   5,   0, 228, 160, 
+      6,   0,   0,   2,   1,   0, 
+      1, 128,   9,   0,   0, 160, 
+      6,   0,   0,   2,   1,   0, 
+      2, 128,   9,   0,  85, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      1,   0, 228, 128,  66,   0, 
+      0,   3,   0,   0,  15, 128, 
+      0,   0, 228, 128,   0,   8, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   7, 128,   0,   0, 
+    255, 128,   0,   0, 228, 128, 
+      5,   0,   0,   3,   0,   0, 
+     15, 128,   0,   0, 228, 128, 
+      6,   0, 228, 160,   5,   0, 
+      0,   3,   1,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      1,   0,   3, 128,   0,   0, 
+    228, 160,   0,   0,   0, 144, 
+      1,   0, 228, 128,   2,   0, 
+      0,   3,   1,   0,   3, 128, 
+      1,   0, 228, 128,   2,   0, 
+    228, 160,   2,   0,   0,   3, 
+      1,   0,   3, 128,   1,   0, 
+    228, 139,   8,   0, 228, 161, 
+      1,   0,   0,   2,   1,   0, 
+     12, 128,   8,   0, 228, 160, 
+      4,   0,   0,   4,   1,   0, 
+     19, 128,   1,   0, 228, 128, 
+      1,   0, 238, 129,  10,   0, 
+      0, 160,   5,   0,   0,   3, 
+      1,   0,   1, 128,   1,   0, 
+     85, 128,   1,   0,   0, 128, 
+      5,   0,   0,   3,   0,   8, 
+     15, 128,   0,   0, 228, 128, 
+      1,   0,   0, 128, 255, 255, 
+      0,   0,  16,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
+      0,   0,   0,   3, 254, 255, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
      95,  51,  95,  48,   0,  77, 
     105,  99, 114, 111, 115, 111, 
     102, 116,  32,  40,  82,  41, 
@@ -3630,142 +4018,66 @@ const unsigned char g_main[] =
     108, 101, 114,  32,  57,  46, 
      50,  57,  46,  57,  53,  50, 
      46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,  10,   0, 
-     15, 160,   0,   0,   0,  63, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   0,   0,   3, 144, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
      31,   0,   0,   2,   0,   0, 
-      0, 144,   0,   8,  15, 160, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   4,   0, 228, 160, 
+      3, 128,   1,   0, 238, 160, 
       0,   0,  85, 144,   4,   0, 
       0,   4,   0,   0,   3, 128, 
-      3,   0, 228, 160,   0,   0, 
+      1,   0, 228, 160,   0,   0, 
       0, 144,   0,   0, 228, 128, 
       2,   0,   0,   3,   0,   0, 
       3, 128,   0,   0, 228, 128, 
-      5,   0, 228, 160,   6,   0, 
-      0,   2,   1,   0,   1, 128, 
-      9,   0,   0, 160,   6,   0, 
-      0,   2,   1,   0,   2, 128, 
-      9,   0,  85, 160,   5,   0, 
+      2,   0, 228, 160,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 128,   1,   0, 
-    228, 128,  66,   0,   0,   3, 
-      0,   0,  15, 128,   0,   0, 
-    228, 128,   0,   8, 228, 160, 
-      5,   0,   0,   3,   0,   0, 
-      7, 128,   0,   0, 255, 128, 
-      0,   0, 228, 128,   5,   0, 
-      0,   3,   0,   0,  15, 128, 
-      0,   0, 228, 128,   6,   0, 
-    228, 160,   5,   0,   0,   3, 
-      1,   0,   3, 128,   1,   0, 
-    228, 160,   0,   0,  85, 144, 
-      4,   0,   0,   4,   1,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0,   0, 144,   1,   0, 
-    228, 128,   2,   0,   0,   3, 
-      1,   0,   3, 128,   1,   0, 
-    228, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   1,   0, 
-      3, 128,   1,   0, 228, 139, 
-      8,   0, 228, 161,   1,   0, 
-      0,   2,   1,   0,  12, 128, 
-      8,   0, 228, 160,   4,   0, 
-      0,   4,   1,   0,  19, 128, 
-      1,   0, 228, 128,   1,   0, 
-    238, 129,  10,   0,   0, 160, 
-      5,   0,   0,   3,   1,   0, 
-      1, 128,   1,   0,  85, 128, 
-      1,   0,   0, 128,   5,   0, 
-      0,   3,   0,   8,  15, 128, 
-      0,   0, 228, 128,   1,   0, 
-      0, 128, 255, 255,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
+      1,   0,   0,   2,   0,   0, 
+     12, 224,   3,   0, 180, 160, 
+      1,   0,   0,   2,   1,   0, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,  15,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
-      0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
+    152,   2,   0,   0,   0,   3, 
+    255, 255, 254, 255,  87,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0,  39,   1,   0,   0, 
+      0,   3, 255, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32,  32,   1, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,  10,   0, 
+      0,   0,  76,   0,   0,   0, 
+     92,   0,   0,   0,  12,   1, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   2,   0,  16,   1, 
       0,   0,   0,   0,   0,   0, 
+    102, 114,  97, 103,   0, 171, 
+    171, 171,   1,   0,   3,   0, 
+      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
-      4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,  15,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0, 152,   2, 
-      0,   0,   0,   3, 255, 255, 
-    254, 255,  87,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-     39,   1,   0,   0,   0,   3, 
-    255, 255,   2,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  32,   1,   0,   0, 
-     68,   0,   0,   0,   2,   0, 
-      0,   0,  10,   0,   0,   0, 
-     76,   0,   0,   0,  92,   0, 
-      0,   0,  12,   1,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      2,   0,  16,   1,   0,   0, 
-      0,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -3795,347 +4107,171 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0, 116, 101, 120,   0, 
+      4,   0,  12,   0,   1,   0, 
+      1,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  10,   0, 
+     15, 160,   0,   0,   0,  63, 
       0,   0,   0,   0,   0,   0, 
-    116, 101, 120,   0,   4,   0, 
-     12,   0,   1,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 112, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,  10,   0,  15, 160, 
-      0,   0,   0,  63,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      0,   0,   3, 144,  31,   0, 
-      0,   2,   0,   0,   0, 144, 
-      0,   8,  15, 160,   5,   0, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   0,   0,   3, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 144,   0,   8,  15, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   4,   0, 228, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      3,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      5,   0, 228, 160,   6,   0, 
+      0,   2,   1,   0,   1, 128, 
+      9,   0,   0, 160,   6,   0, 
+      0,   2,   1,   0,   2, 128, 
+      9,   0,  85, 160,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      4,   0, 228, 160,   0,   0, 
+      0,   0, 228, 128,   1,   0, 
+    228, 128,  66,   0,   0,   3, 
+      0,   0,  15, 128,   0,   0, 
+    228, 128,   0,   8, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+     15, 128,   0,   0, 228, 128, 
+      6,   0, 228, 160,   5,   0, 
+      0,   3,   1,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
      85, 144,   4,   0,   0,   4, 
-      0,   0,   3, 128,   3,   0, 
+      1,   0,   3, 128,   0,   0, 
     228, 160,   0,   0,   0, 144, 
-      0,   0, 228, 128,   2,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 128,   5,   0, 
-    228, 160,   6,   0,   0,   2, 
-      1,   0,   1, 128,   9,   0, 
-      0, 160,   6,   0,   0,   2, 
-      1,   0,   2, 128,   9,   0, 
-     85, 160,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 128,   1,   0, 228, 128, 
-     66,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0, 228, 128, 
-      0,   8, 228, 160,   5,   0, 
-      0,   3,   0,   0,  15, 128, 
-      0,   0, 228, 128,   6,   0, 
-    228, 160,   5,   0,   0,   3, 
+      1,   0, 228, 128,   2,   0, 
+      0,   3,   1,   0,   3, 128, 
+      1,   0, 228, 128,   2,   0, 
+    228, 160,   2,   0,   0,   3, 
       1,   0,   3, 128,   1,   0, 
-    228, 160,   0,   0,  85, 144, 
+    228, 139,   8,   0, 228, 161, 
+      1,   0,   0,   2,   1,   0, 
+     12, 128,   8,   0, 228, 160, 
       4,   0,   0,   4,   1,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0,   0, 144,   1,   0, 
-    228, 128,   2,   0,   0,   3, 
-      1,   0,   3, 128,   1,   0, 
-    228, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   1,   0, 
-      3, 128,   1,   0, 228, 139, 
-      8,   0, 228, 161,   1,   0, 
-      0,   2,   1,   0,  12, 128, 
-      8,   0, 228, 160,   4,   0, 
-      0,   4,   1,   0,  19, 128, 
-      1,   0, 228, 128,   1,   0, 
-    238, 129,  10,   0,   0, 160, 
-      5,   0,   0,   3,   1,   0, 
-      1, 128,   1,   0,  85, 128, 
-      1,   0,   0, 128,   5,   0, 
-      0,   3,   0,   8,  15, 128, 
-      0,   0, 228, 128,   1,   0, 
-      0, 128, 255, 255,   0,   0, 
-     15,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
+     19, 128,   1,   0, 228, 128, 
+      1,   0, 238, 129,  10,   0, 
+      0, 160,   5,   0,   0,   3, 
+      1,   0,   1, 128,   1,   0, 
+     85, 128,   1,   0,   0, 128, 
+      5,   0,   0,   3,   0,   8, 
+     15, 128,   0,   0, 228, 128, 
+      1,   0,   0, 128, 255, 255, 
+      0,   0,  15,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
       0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
-      4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,  14,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0,  24,   3, 
-      0,   0,   0,   3, 255, 255, 
-    254, 255,  77,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    255,   0,   0,   0,   0,   3, 
-    255, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32, 248,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,  10,   0,   0,   0, 
-     56,   0,   0,   0,  72,   0, 
-      0,   0, 102, 114,  97, 103, 
-      0, 171, 171, 171,   1,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
       3,   0,   1,   0,   4,   0, 
-     11,   0,   0,   0,   0,   0, 
+      2,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
+      1,   0,   0,   2,   0,   0, 
+     12, 224,   3,   0, 180, 160, 
+      1,   0,   0,   2,   1,   0, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,  14,   0, 
       0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 112, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,  10,   0, 
-     15, 160,   0,   0,   0,  63, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   0,   0,   3, 144, 
-      5,   0,   0,   3,   0,   0, 
-      3, 128,   4,   0, 228, 160, 
-      0,   0,  85, 144,   4,   0, 
-      0,   4,   0,   0,   3, 128, 
-      3,   0, 228, 160,   0,   0, 
-      0, 144,   0,   0, 228, 128, 
-      2,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 128, 
-      5,   0, 228, 160,   2,   0, 
-      0,   3,   0,   0,  12, 128, 
-      9,   0, 170, 161,   9,   0, 
-     68, 160,   2,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    238, 129,   0,   0, 228, 139, 
-     11,   0,   0,   3,   1,   0, 
-      3, 128,   0,   0, 228, 128, 
-     10,   0,  85, 160,  11,   0, 
-      0,   3,   1,   0,   4, 128, 
-      0,   0,   0, 128,   0,   0, 
-     85, 128,  10,   0,   0,   3, 
-      0,   0,   1, 128,   1,   0, 
-    170, 128,  10,   0,  85, 160, 
-     90,   0,   0,   4,   0,   0, 
-      2, 128,   1,   0, 228, 128, 
-      1,   0, 228, 128,  10,   0, 
-     85, 160,   7,   0,   0,   2, 
-      0,   0,   2, 128,   0,   0, 
-     85, 128,   6,   0,   0,   2, 
-      0,   0,   2, 128,   0,   0, 
-     85, 128,   2,   0,   0,   3, 
-      0,   0,   1, 128,   0,   0, 
-     85, 128,   0,   0,   0, 128, 
-      2,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 128, 
-      9,   0, 170, 161,   1,   0, 
-      0,   2,   1,   0,   1, 128, 
-     10,   0,   0, 160,   4,   0, 
-      0,   4,   0,   0,   1, 128, 
-      9,   0, 255, 160,   1,   0, 
-      0, 128,   0,   0,   0, 128, 
-      6,   0,   0,   2,   0,   0, 
-      2, 128,   9,   0, 255, 160, 
-      5,   0,   0,   3,   0,   0, 
-     17, 128,   0,   0,  85, 128, 
-      0,   0,   0, 128,   1,   0, 
-      0,   2,   2,   0,  15, 128, 
-      6,   0, 228, 160,   2,   0, 
-      0,   3,   2,   0,  15, 128, 
-      2,   0, 228, 129,   7,   0, 
-    228, 160,   4,   0,   0,   4, 
-      0,   0,  15, 128,   0,   0, 
-      0, 128,   2,   0, 228, 128, 
-      6,   0, 228, 160,   5,   0, 
-      0,   3,   1,   0,   6, 128, 
-      1,   0, 208, 160,   0,   0, 
-     85, 144,   4,   0,   0,   4, 
-      1,   0,   6, 128,   0,   0, 
-    208, 160,   0,   0,   0, 144, 
-      1,   0, 228, 128,   2,   0, 
-      0,   3,   1,   0,   6, 128, 
-      1,   0, 228, 128,   2,   0, 
-    208, 160,   2,   0,   0,   3, 
-      1,   0,   6, 128,   1,   0, 
-    228, 139,   8,   0, 208, 161, 
-      4,   0,   0,   4,   1,   0, 
-     19, 128,   1,   0, 233, 128, 
-      8,   0, 238, 161,   1,   0, 
-      0, 128,   5,   0,   0,   3, 
-      1,   0,   1, 128,   1,   0, 
-     85, 128,   1,   0,   0, 128, 
-      5,   0,   0,   3,   0,   8, 
-     15, 128,   0,   0, 228, 128, 
-      1,   0,   0, 128, 255, 255, 
-      0,   0,  14,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,  13,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     24,   3,   0,   0,   0,   3, 
-    255, 255, 254, 255,  77,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0, 255,   0,   0,   0, 
-      0,   3, 255, 255,   1,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32, 248,   0, 
-      0,   0,  48,   0,   0,   0, 
-      2,   0,   0,   0,  10,   0, 
-      0,   0,  56,   0,   0,   0, 
-     72,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
+     24,   3,   0,   0,   0,   3, 
+    255, 255, 254, 255,  77,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 255,   0,   0,   0, 
+      0,   3, 255, 255,   1,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 248,   0, 
+      0,   0,  48,   0,   0,   0, 
+      2,   0,   0,   0,  10,   0, 
+      0,   0,  56,   0,   0,   0, 
+     72,   0,   0,   0, 102, 114, 
+     97, 103,   0, 171, 171, 171, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,  11,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -4254,69 +4390,91 @@ const unsigned char g_main[] =
       0, 128,   5,   0,   0,   3, 
       0,   8,  15, 128,   0,   0, 
     228, 128,   1,   0,   0, 128, 
-    255, 255,   0,   0,  13,   0, 
+    255, 255,   0,   0,  14,   0, 
       0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
       2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
-    118, 101, 114, 115, 101,  86, 
-    105, 101, 119,  83, 105, 122, 
-    101,   0,   1,   0,   3,   0, 
-      1,   0,   2,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 118, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
-     15, 160,   0,   0,   0,  64, 
-      0,   0, 128, 191,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,  15, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 224, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,   3, 224, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   2,   0,   3, 224, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
       0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
       4,   0,   0,   4,   0,   0, 
       2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
+      3,   0,   0, 161,   3,   0, 
     170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
+      0,   0,  12, 224,   3,   0, 
     180, 160,   1,   0,   0,   2, 
       1,   0,   3, 224,   1,   0, 
     228, 144,   1,   0,   0,   2, 
       2,   0,   3, 224,   0,   0, 
     228, 144, 255, 255,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
+     13,   0,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
       1,   0,   0,   0,   0,   0, 
       0,   0,  24,   3,   0,   0, 
@@ -4452,88 +4610,107 @@ const unsigned char g_main[] =
       0,   3,   0,   8,  15, 128, 
       0,   0, 228, 128,   1,   0, 
       0, 128, 255, 255,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
+     13,   0,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
       0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
       0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
+      2,   0,   0,   0,  28,   0, 
       0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
+    176,   0,   0,   0,  68,   0, 
       0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
+      0,   0, 105, 110, 118, 101, 
+    114, 115, 101,  86, 105, 101, 
+    119,  83, 105, 122, 101,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   1,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
-      4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,  11,   0,   0,   0, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   3,   0,  15, 160, 
+      0,   0,   0,  64,   0,   0, 
+    128, 191,   0,   0, 128,  63, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 144,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,  15, 144,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 224,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,   3, 224,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      2,   0,   3, 224,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   0,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 224,   0,   0,   0, 128, 
+      3,   0,   0, 160,   3,   0, 
+     85, 160,   4,   0,   0,   4, 
+      0,   0,   2, 224,   0,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
+      0,   2,   0,   0,  12, 224, 
+      3,   0, 180, 160,   1,   0, 
+      0,   2,   1,   0,   3, 224, 
+      1,   0, 228, 144,   1,   0, 
+      0,   2,   2,   0,   3, 224, 
+      0,   0, 228, 144, 255, 255, 
+      0,   0,  12,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0, 228,   2, 
+      0,   0,   0,   0,  24,   3, 
       0,   0,   0,   3, 255, 255, 
-    254, 255,  87,   0,  67,  84, 
+    254, 255,  77,   0,  67,  84, 
      65,  66,  28,   0,   0,   0, 
-     39,   1,   0,   0,   0,   3, 
-    255, 255,   2,   0,   0,   0, 
+    255,   0,   0,   0,   0,   3, 
+    255, 255,   1,   0,   0,   0, 
      28,   0,   0,   0,   0,   1, 
-      0,  32,  32,   1,   0,   0, 
-     68,   0,   0,   0,   2,   0, 
-      0,   0,  11,   0,   0,   0, 
-     76,   0,   0,   0,  92,   0, 
-      0,   0,  12,   1,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      2,   0,  16,   1,   0,   0, 
-      0,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
+      0,  32, 248,   0,   0,   0, 
+     48,   0,   0,   0,   2,   0, 
+      0,   0,  10,   0,   0,   0, 
+     56,   0,   0,   0,  72,   0, 
+      0,   0, 102, 114,  97, 103, 
+      0, 171, 171, 171,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+     11,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -4563,98 +4740,113 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  10,   0, 
+     15, 160,   0,   0,   0,  63, 
       0,   0,   0,   0,   0,   0, 
-    116, 101, 120,   0,   4,   0, 
-     12,   0,   1,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 112, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,  11,   0,  15, 160, 
-      0,   0,   0,  63,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  81,   0, 
-      0,   5,  12,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0, 128,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      0,   0,   3, 144,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      1,   0,   3, 144,  31,   0, 
-      0,   2,   0,   0,   0, 144, 
-      0,   8,  15, 160,   4,   0, 
-      0,   4,   0,   0,   1, 128, 
-      0,   0,   0, 144,  12,   0, 
-      0, 160,  12,   0,  85, 160, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   0,   0,   3, 144, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   4,   0, 228, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      3,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
       2,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 140, 
-     12,   0, 170, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 128,  10,   0, 
-      0, 160,  10,   0,   0,   3, 
-      1,   0,   1, 128,   0,   0, 
-      0, 128,  12,   0, 170, 160, 
-     10,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,  85, 144, 
-     12,   0, 170, 160,   4,   0, 
-      0,   4,   0,   0,   1, 128, 
-      1,   0,   0, 128,   0,   0, 
-      0, 128,  10,   0,  85, 161, 
-     88,   0,   0,   4,   0,   0, 
-     15, 128,   0,   0,   0, 128, 
-     12,   0, 255, 160,  12,   0, 
-     85, 160,  65,   0,   0,   1, 
-      0,   0,  15, 128,   5,   0, 
-      0,   3,   0,   0,   3, 128, 
-      1,   0, 228, 160,   1,   0, 
-     85, 144,   4,   0,   0,   4, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   1,   0,   0, 144, 
-      0,   0, 228, 128,   2,   0, 
-      0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 128,   2,   0, 
-    228, 160,   2,   0,   0,   3, 
+      3, 128,   0,   0, 228, 128, 
+      5,   0, 228, 160,   2,   0, 
+      0,   3,   0,   0,  12, 128, 
+      9,   0, 170, 161,   9,   0, 
+     68, 160,   2,   0,   0,   3, 
       0,   0,   3, 128,   0,   0, 
-    228, 139,   8,   0, 228, 161, 
-      1,   0,   0,   2,   0,   0, 
-     12, 128,   8,   0, 228, 160, 
-      4,   0,   0,   4,   0,   0, 
-     19, 128,   0,   0, 228, 128, 
-      0,   0, 238, 129,  11,   0, 
-      0, 160,   5,   0,   0,   3, 
+    238, 129,   0,   0, 228, 139, 
+     11,   0,   0,   3,   1,   0, 
+      3, 128,   0,   0, 228, 128, 
+     10,   0,  85, 160,  11,   0, 
+      0,   3,   1,   0,   4, 128, 
+      0,   0,   0, 128,   0,   0, 
+     85, 128,  10,   0,   0,   3, 
+      0,   0,   1, 128,   1,   0, 
+    170, 128,  10,   0,  85, 160, 
+     90,   0,   0,   4,   0,   0, 
+      2, 128,   1,   0, 228, 128, 
+      1,   0, 228, 128,  10,   0, 
+     85, 160,   7,   0,   0,   2, 
+      0,   0,   2, 128,   0,   0, 
+     85, 128,   6,   0,   0,   2, 
+      0,   0,   2, 128,   0,   0, 
+     85, 128,   2,   0,   0,   3, 
       0,   0,   1, 128,   0,   0, 
      85, 128,   0,   0,   0, 128, 
-     66,   0,   0,   3,   1,   0, 
-     15, 128,   0,   0, 228, 144, 
-      0,   8, 228, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
+      2,   0,   0,   3,   0,   0, 
+      1, 128,   0,   0,   0, 128, 
+      9,   0, 170, 161,   1,   0, 
+      0,   2,   1,   0,   1, 128, 
+     10,   0,   0, 160,   4,   0, 
+      0,   4,   0,   0,   1, 128, 
+      9,   0, 255, 160,   1,   0, 
+      0, 128,   0,   0,   0, 128, 
+      6,   0,   0,   2,   0,   0, 
+      2, 128,   9,   0, 255, 160, 
+      5,   0,   0,   3,   0,   0, 
+     17, 128,   0,   0,  85, 128, 
       0,   0,   0, 128,   1,   0, 
-    255, 128,   5,   0,   0,   3, 
-      0,   8,  15, 128,   0,   0, 
-      0, 128,   6,   0, 228, 160, 
-    255, 255,   0,   0,  11,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
+      0,   2,   2,   0,  15, 128, 
+      6,   0, 228, 160,   2,   0, 
+      0,   3,   2,   0,  15, 128, 
+      2,   0, 228, 129,   7,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,  15, 128,   0,   0, 
+      0, 128,   2,   0, 228, 128, 
+      6,   0, 228, 160,   5,   0, 
+      0,   3,   1,   0,   6, 128, 
+      1,   0, 208, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      1,   0,   6, 128,   0,   0, 
+    208, 160,   0,   0,   0, 144, 
+      1,   0, 228, 128,   2,   0, 
+      0,   3,   1,   0,   6, 128, 
+      1,   0, 228, 128,   2,   0, 
+    208, 160,   2,   0,   0,   3, 
+      1,   0,   6, 128,   1,   0, 
+    228, 139,   8,   0, 208, 161, 
+      4,   0,   0,   4,   1,   0, 
+     19, 128,   1,   0, 233, 128, 
+      8,   0, 238, 161,   1,   0, 
+      0, 128,   5,   0,   0,   3, 
+      1,   0,   1, 128,   1,   0, 
+     85, 128,   1,   0,   0, 128, 
+      5,   0,   0,   3,   0,   8, 
+     15, 128,   0,   0, 228, 128, 
+      1,   0,   0, 128, 255, 255, 
+      0,   0,  12,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
+      0,   0,   0,   3, 254, 255, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
     118, 101, 114, 115, 101,  86, 
     105, 101, 119,  83, 105, 122, 
     101,   0,   1,   0,   3,   0, 
@@ -4662,6 +4854,16 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0, 118, 115, 
      95,  51,  95,  48,   0,  77, 
     105,  99, 114, 111, 115, 111, 
@@ -4672,7 +4874,7 @@ const unsigned char g_main[] =
     108, 101, 114,  32,  57,  46, 
      50,  57,  46,  57,  53,  50, 
      46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
+     81,   0,   0,   5,   3,   0, 
      15, 160,   0,   0,   0,  64, 
       0,   0, 128, 191,   0,   0, 
     128,  63,   0,   0,   0,   0, 
@@ -4687,45 +4889,50 @@ const unsigned char g_main[] =
      31,   0,   0,   2,   3,   0, 
       0, 128,   2,   0,   3, 224, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
-      0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
-      4,   0,   0,   4,   0,   0, 
-      2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
-    170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
-    180, 160,   1,   0,   0,   2, 
-      1,   0,   3, 224,   1,   0, 
-    228, 144,   1,   0,   0,   2, 
-      2,   0,   3, 224,   0,   0, 
-    228, 144, 255, 255,   0,   0, 
-     10,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 244,   2,   0,   0, 
-      0,   3, 255, 255, 254, 255, 
-     87,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0,  39,   1, 
-      0,   0,   0,   3, 255, 255, 
-      2,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     32,   1,   0,   0,  68,   0, 
-      0,   0,   2,   0,   0,   0, 
-     11,   0,   0,   0,  76,   0, 
-      0,   0,  92,   0,   0,   0, 
-     12,   1,   0,   0,   3,   0, 
-      0,   0,   1,   0,   2,   0, 
-     16,   1,   0,   0,   0,   0, 
-      0,   0, 102, 114,  97, 103, 
-      0, 171, 171, 171,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-     11,   0,   0,   0,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
+      1,   0,   0,   2,   0,   0, 
+     12, 224,   3,   0, 180, 160, 
+      1,   0,   0,   2,   1,   0, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
+    228,   2,   0,   0,   0,   3, 
+    255, 255, 254, 255,  87,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0,  39,   1,   0,   0, 
+      0,   3, 255, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32,  32,   1, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,  11,   0, 
+      0,   0,  76,   0,   0,   0, 
+     92,   0,   0,   0,  12,   1, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   2,   0,  16,   1, 
       0,   0,   0,   0,   0,   0, 
+    102, 114,  97, 103,   0, 171, 
+    171, 171,   1,   0,   3,   0, 
+      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -4752,165 +4959,188 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 116, 101, 
-    120,   0,   4,   0,  12,   0, 
-      1,   0,   1,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    112, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-     11,   0,  15, 160,   0,   0, 
-      0,  63,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  81,   0,   0,   5, 
-     12,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0, 128,  31,   0,   0,   2, 
-      5,   0,   0, 128,   0,   0, 
-      3, 144,  31,   0,   0,   2, 
-      3,   0,   0, 128,   1,   0, 
-      3, 144,  31,   0,   0,   2, 
-      0,   0,   0, 144,   0,   8, 
-     15, 160,   4,   0,   0,   4, 
-      0,   0,   1, 128,   0,   0, 
-      0, 144,  12,   0,   0, 160, 
-     12,   0,  85, 160,   2,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 140,  12,   0, 
-    170, 160,   5,   0,   0,   3, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 116, 101, 120,   0, 
+      4,   0,  12,   0,   1,   0, 
+      1,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  11,   0, 
+     15, 160,   0,   0,   0,  63, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+     81,   0,   0,   5,  12,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0, 128, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   0,   0,   3, 144, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   1,   0,   3, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 144,   0,   8,  15, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   0,   0,   0, 144, 
+     12,   0,   0, 160,  12,   0, 
+     85, 160,   2,   0,   0,   3, 
       0,   0,   1, 128,   0,   0, 
-      0, 128,  10,   0,   0, 160, 
-     10,   0,   0,   3,   1,   0, 
+      0, 140,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
       1, 128,   0,   0,   0, 128, 
-     12,   0, 170, 160,  10,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,  85, 144,  12,   0, 
-    170, 160,   4,   0,   0,   4, 
-      0,   0,   1, 128,   1,   0, 
-      0, 128,   0,   0,   0, 128, 
-     10,   0,  85, 161,  88,   0, 
-      0,   4,   0,   0,  15, 128, 
+     10,   0,   0, 160,  10,   0, 
+      0,   3,   1,   0,   1, 128, 
       0,   0,   0, 128,  12,   0, 
-    255, 160,  12,   0,  85, 160, 
-     65,   0,   0,   1,   0,   0, 
-     15, 128,   5,   0,   0,   3, 
-      0,   0,   3, 128,   1,   0, 
-    228, 160,   1,   0,  85, 144, 
+    170, 160,  10,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 144,  12,   0, 170, 160, 
       4,   0,   0,   4,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      1,   0,   0, 144,   0,   0, 
-    228, 128,   2,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 139, 
-      8,   0, 228, 161,   1,   0, 
-      0,   2,   0,   0,  12, 128, 
-      8,   0, 228, 160,   4,   0, 
-      0,   4,   0,   0,  19, 128, 
-      0,   0, 228, 128,   0,   0, 
-    238, 129,  11,   0,   0, 160, 
+      1, 128,   1,   0,   0, 128, 
+      0,   0,   0, 128,  10,   0, 
+     85, 161,  88,   0,   0,   4, 
+      0,   0,  15, 128,   0,   0, 
+      0, 128,  12,   0, 255, 160, 
+     12,   0,  85, 160,  65,   0, 
+      0,   1,   0,   0,  15, 128, 
       5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,  85, 128, 
-      0,   0,   0, 128,  66,   0, 
-      0,   3,   1,   0,  15, 128, 
-      0,   0, 228, 144,   0,   8, 
-    228, 160,   5,   0,   0,   3, 
-      1,   0,   7, 128,   1,   0, 
-    255, 128,   1,   0, 228, 128, 
+      3, 128,   1,   0, 228, 160, 
+      1,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      0,   0, 228, 160,   1,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 139,   8,   0, 
+    228, 161,   1,   0,   0,   2, 
+      0,   0,  12, 128,   8,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,  19, 128,   0,   0, 
+    228, 128,   0,   0, 238, 129, 
+     11,   0,   0, 160,   5,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,  85, 128,   0,   0, 
+      0, 128,  66,   0,   0,   3, 
+      1,   0,  15, 128,   0,   0, 
+    228, 144,   0,   8, 228, 160, 
       5,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0,   0, 128, 
-      1,   0, 228, 128,   5,   0, 
+      1, 128,   0,   0,   0, 128, 
+      1,   0, 255, 128,   5,   0, 
       0,   3,   0,   8,  15, 128, 
-      0,   0, 228, 128,   6,   0, 
+      0,   0,   0, 128,   6,   0, 
     228, 160, 255, 255,   0,   0, 
-     10,   0,   0,   0,   0,   0, 
+     11,   0,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
       0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
       0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
+      2,   0,   0,   0,  28,   0, 
       0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
+    176,   0,   0,   0,  68,   0, 
       0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
+      0,   0, 105, 110, 118, 101, 
+    114, 115, 101,  86, 105, 101, 
+    119,  83, 105, 122, 101,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   1,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
-      4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,   9,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0, 228,   2, 
-      0,   0,   0,   3, 255, 255, 
-    254, 255,  87,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-     39,   1,   0,   0,   0,   3, 
-    255, 255,   2,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  32,   1,   0,   0, 
-     68,   0,   0,   0,   2,   0, 
-      0,   0,  11,   0,   0,   0, 
-     76,   0,   0,   0,  92,   0, 
-      0,   0,  12,   1,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      2,   0,  16,   1,   0,   0, 
-      0,   0,   0,   0, 102, 114, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   3,   0,  15, 160, 
+      0,   0,   0,  64,   0,   0, 
+    128, 191,   0,   0, 128,  63, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 144,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,  15, 144,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 224,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,   3, 224,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      2,   0,   3, 224,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   0,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 224,   0,   0,   0, 128, 
+      3,   0,   0, 160,   3,   0, 
+     85, 160,   4,   0,   0,   4, 
+      0,   0,   2, 224,   0,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
+      0,   2,   0,   0,  12, 224, 
+      3,   0, 180, 160,   1,   0, 
+      0,   2,   1,   0,   3, 224, 
+      1,   0, 228, 144,   1,   0, 
+      0,   2,   2,   0,   3, 224, 
+      0,   0, 228, 144, 255, 255, 
+      0,   0,  10,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   1,   0,   0,   0, 
+      0,   0,   0,   0, 244,   2, 
+      0,   0,   0,   3, 255, 255, 
+    254, 255,  87,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+     39,   1,   0,   0,   0,   3, 
+    255, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32,  32,   1,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,  11,   0,   0,   0, 
+     76,   0,   0,   0,  92,   0, 
+      0,   0,  12,   1,   0,   0, 
+      3,   0,   0,   0,   1,   0, 
+      2,   0,  16,   1,   0,   0, 
+      0,   0,   0,   0, 102, 114, 
      97, 103,   0, 171, 171, 171, 
       1,   0,   3,   0,   1,   0, 
       4,   0,  11,   0,   0,   0, 
@@ -5015,26 +5245,32 @@ const unsigned char g_main[] =
      66,   0,   0,   3,   1,   0, 
      15, 128,   0,   0, 228, 144, 
       0,   8, 228, 160,   5,   0, 
-      0,   3,   0,   0,  15, 128, 
-      0,   0,   0, 128,   1,   0, 
+      0,   3,   1,   0,   7, 128, 
+      1,   0, 255, 128,   1,   0, 
     228, 128,   5,   0,   0,   3, 
-      0,   8,  15, 128,   0,   0, 
-    228, 128,   6,   0, 228, 160, 
-    255, 255,   0,   0,   9,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
+      0,   0,  15, 128,   0,   0, 
+      0, 128,   1,   0, 228, 128, 
+      5,   0,   0,   3,   0,   8, 
+     15, 128,   0,   0, 228, 128, 
+      6,   0, 228, 160, 255, 255, 
+      0,   0,  10,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
+      0,   0,   0,   3, 254, 255, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
     118, 101, 114, 115, 101,  86, 
     105, 101, 119,  83, 105, 122, 
     101,   0,   1,   0,   3,   0, 
@@ -5042,6 +5278,16 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0, 118, 115, 
      95,  51,  95,  48,   0,  77, 
     105,  99, 114, 111, 115, 111, 
@@ -5052,7 +5298,7 @@ const unsigned char g_main[] =
     108, 101, 114,  32,  57,  46, 
      50,  57,  46,  57,  53,  50, 
      46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
+     81,   0,   0,   5,   3,   0, 
      15, 160,   0,   0,   0,  64, 
       0,   0, 128, 191,   0,   0, 
     128,  63,   0,   0,   0,   0, 
@@ -5067,35 +5313,47 @@ const unsigned char g_main[] =
      31,   0,   0,   2,   3,   0, 
       0, 128,   2,   0,   3, 224, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
-      0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
-      4,   0,   0,   4,   0,   0, 
-      2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
-    170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
-    180, 160,   1,   0,   0,   2, 
-      1,   0,   3, 224,   1,   0, 
-    228, 144,   1,   0,   0,   2, 
-      2,   0,   3, 224,   0,   0, 
-    228, 144, 255, 255,   0,   0, 
-      8,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 244,   1,   0,   0, 
-      0,   3, 255, 255, 254, 255, 
-     77,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 255,   0, 
-      0,   0,   0,   3, 255, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-    248,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-     11,   0,   0,   0,  56,   0, 
-      0,   0,  72,   0,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
+      1,   0,   0,   2,   0,   0, 
+     12, 224,   3,   0, 180, 160, 
+      1,   0,   0,   2,   1,   0, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,   9,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+    228,   2,   0,   0,   0,   3, 
+    255, 255, 254, 255,  87,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0,  39,   1,   0,   0, 
+      0,   3, 255, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32,  32,   1, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,  11,   0, 
+      0,   0,  76,   0,   0,   0, 
+     92,   0,   0,   0,  12,   1, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   2,   0,  16,   1, 
+      0,   0,   0,   0,   0,   0, 
     102, 114,  97, 103,   0, 171, 
     171, 171,   1,   0,   3,   0, 
       1,   0,   4,   0,  11,   0, 
@@ -5129,7 +5387,119 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 112, 115,  95,  51, 
+      0,   0, 116, 101, 120,   0, 
+      4,   0,  12,   0,   1,   0, 
+      1,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  11,   0, 
+     15, 160,   0,   0,   0,  63, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+     81,   0,   0,   5,  12,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0, 128, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   0,   0,   3, 144, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   1,   0,   3, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 144,   0,   8,  15, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   0,   0,   0, 144, 
+     12,   0,   0, 160,  12,   0, 
+     85, 160,   2,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+      0, 140,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
+      1, 128,   0,   0,   0, 128, 
+     10,   0,   0, 160,  10,   0, 
+      0,   3,   1,   0,   1, 128, 
+      0,   0,   0, 128,  12,   0, 
+    170, 160,  10,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 144,  12,   0, 170, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   1,   0,   0, 128, 
+      0,   0,   0, 128,  10,   0, 
+     85, 161,  88,   0,   0,   4, 
+      0,   0,  15, 128,   0,   0, 
+      0, 128,  12,   0, 255, 160, 
+     12,   0,  85, 160,  65,   0, 
+      0,   1,   0,   0,  15, 128, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      1,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      0,   0, 228, 160,   1,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 139,   8,   0, 
+    228, 161,   1,   0,   0,   2, 
+      0,   0,  12, 128,   8,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,  19, 128,   0,   0, 
+    228, 128,   0,   0, 238, 129, 
+     11,   0,   0, 160,   5,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,  85, 128,   0,   0, 
+      0, 128,  66,   0,   0,   3, 
+      1,   0,  15, 128,   0,   0, 
+    228, 144,   0,   8, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+     15, 128,   0,   0,   0, 128, 
+      1,   0, 228, 128,   5,   0, 
+      0,   3,   0,   8,  15, 128, 
+      0,   0, 228, 128,   6,   0, 
+    228, 160, 255, 255,   0,   0, 
+      9,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
+      0,   3, 254, 255, 254, 255, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
+      0,   0,   0,   3, 254, 255, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+    176,   0,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
+      0,   0, 105, 110, 118, 101, 
+    114, 115, 101,  86, 105, 101, 
+    119,  83, 105, 122, 101,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
      95,  48,   0,  77, 105,  99, 
     114, 111, 115, 111, 102, 116, 
      32,  40,  82,  41,  32,  72, 
@@ -5139,69 +5509,7 @@ const unsigned char g_main[] =
     114,  32,  57,  46,  50,  57, 
      46,  57,  53,  50,  46,  51, 
      49,  49,  49,   0,  81,   0, 
-      0,   5,  11,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0, 128,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      0,   0,   3, 144,   4,   0, 
-      0,   4,   0,   0,   1, 128, 
-      0,   0,   0, 144,  11,   0, 
-      0, 160,  11,   0,  85, 160, 
-      2,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 140, 
-     11,   0, 170, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 128,  10,   0, 
-      0, 160,  10,   0,   0,   3, 
-      1,   0,   1, 128,   0,   0, 
-      0, 128,  11,   0, 170, 160, 
-     10,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,  85, 144, 
-     11,   0, 170, 160,   4,   0, 
-      0,   4,   0,   0,   1, 128, 
-      1,   0,   0, 128,   0,   0, 
-      0, 128,  10,   0,  85, 161, 
-     88,   0,   0,   4,   0,   0, 
-     15, 128,   0,   0,   0, 128, 
-     11,   0, 255, 160,  11,   0, 
-     85, 160,  65,   0,   0,   1, 
-      0,   0,  15, 128,   1,   0, 
-      0,   2,   0,   8,  15, 128, 
-     11,   0, 170, 160, 255, 255, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
+      0,   5,   3,   0,  15, 160, 
       0,   0,   0,  64,   0,   0, 
     128, 191,   0,   0, 128,  63, 
       0,   0,   0,   0,  31,   0, 
@@ -5216,170 +5524,30 @@ const unsigned char g_main[] =
       0,   2,   3,   0,   0, 128, 
       2,   0,   3, 224,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
-      0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
-      0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
-      1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
-      1,   0,   0,   2,   1,   0, 
-      3, 224,   1,   0, 228, 144, 
-      1,   0,   0,   2,   2,   0, 
-      3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    244,   1,   0,   0,   0,   3, 
-    255, 255, 254, 255,  77,   0, 
-     67,  84,  65,  66,  28,   0, 
-      0,   0, 255,   0,   0,   0, 
-      0,   3, 255, 255,   1,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32, 248,   0, 
-      0,   0,  48,   0,   0,   0, 
-      2,   0,   0,   0,  11,   0, 
-      0,   0,  56,   0,   0,   0, 
-     72,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    112, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-     11,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0, 128,  31,   0,   0,   2, 
-      5,   0,   0, 128,   0,   0, 
-      3, 144,   4,   0,   0,   4, 
-      0,   0,   1, 128,   0,   0, 
-      0, 144,  11,   0,   0, 160, 
-     11,   0,  85, 160,   2,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 140,  11,   0, 
-    170, 160,   5,   0,   0,   3, 
-      0,   0,   1, 128,   0,   0, 
-      0, 128,  10,   0,   0, 160, 
-     10,   0,   0,   3,   1,   0, 
-      1, 128,   0,   0,   0, 128, 
-     11,   0, 170, 160,  10,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,  85, 144,  11,   0, 
-    170, 160,   4,   0,   0,   4, 
-      0,   0,   1, 128,   1,   0, 
-      0, 128,   0,   0,   0, 128, 
-     10,   0,  85, 161,  88,   0, 
-      0,   4,   0,   0,  15, 128, 
-      0,   0,   0, 128,  11,   0, 
-    255, 160,  11,   0,  85, 160, 
-     65,   0,   0,   1,   0,   0, 
-     15, 128,   1,   0,   0,   2, 
-      0,   8,  15, 128,  11,   0, 
-    170, 160, 255, 255,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
-      0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
       0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
+    228, 128,   0,   0, 228, 160, 
       4,   0,   0,   4,   0,   0, 
       1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
+      3,   0,   0, 160,   3,   0, 
      85, 160,   4,   0,   0,   4, 
       0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
       0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
+      3,   0, 180, 160,   1,   0, 
       0,   2,   1,   0,   3, 224, 
       1,   0, 228, 144,   1,   0, 
       0,   2,   2,   0,   3, 224, 
       0,   0, 228, 144, 255, 255, 
-      0,   0,   6,   0,   0,   0, 
+      0,   0,   8,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   1,   0,   0,   0, 
       0,   0,   0,   0, 244,   1, 
@@ -5466,235 +5634,39 @@ const unsigned char g_main[] =
       0,   1,   0,   0,  15, 128, 
       1,   0,   0,   2,   0,   8, 
      15, 128,  11,   0, 170, 160, 
-    255, 255,   0,   0,   6,   0, 
+    255, 255,   0,   0,   8,   0, 
       0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
       2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
-    118, 101, 114, 115, 101,  86, 
-    105, 101, 119,  83, 105, 122, 
-    101,   0,   1,   0,   3,   0, 
-      1,   0,   2,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 118, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
-     15, 160,   0,   0,   0,  64, 
-      0,   0, 128, 191,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,  15, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 224, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,   3, 224, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   2,   0,   3, 224, 
-      5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
-      0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
-      4,   0,   0,   4,   0,   0, 
-      2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
-    170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
-    180, 160,   1,   0,   0,   2, 
-      1,   0,   3, 224,   1,   0, 
-    228, 144,   1,   0,   0,   2, 
-      2,   0,   3, 224,   0,   0, 
-    228, 144, 255, 255,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  96,   3,   0,   0, 
-      0,   3, 255, 255, 254, 255, 
-     87,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0,  39,   1, 
-      0,   0,   0,   3, 255, 255, 
-      2,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     32,   1,   0,   0,  68,   0, 
-      0,   0,   2,   0,   0,   0, 
-     11,   0,   0,   0,  76,   0, 
-      0,   0,  92,   0,   0,   0, 
-     12,   1,   0,   0,   3,   0, 
-      0,   0,   1,   0,   2,   0, 
-     16,   1,   0,   0,   0,   0, 
-      0,   0, 102, 114,  97, 103, 
-      0, 171, 171, 171,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-     11,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 116, 101, 
-    120,   0,   4,   0,  12,   0, 
-      1,   0,   1,   0,   1,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    112, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-     11,   0,  15, 160,   0,   0, 
-      0,  63,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  81,   0,   0,   5, 
-     12,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0, 128,  31,   0,   0,   2, 
-      5,   0,   0, 128,   0,   0, 
-      3, 144,  31,   0,   0,   2, 
-      3,   0,   0, 128,   1,   0, 
-      3, 144,  31,   0,   0,   2, 
-      0,   0,   0, 144,   0,   8, 
-     15, 160,   4,   0,   0,   4, 
-      0,   0,   1, 128,   0,   0, 
-      0, 144,  12,   0,   0, 160, 
-     12,   0,  85, 160,   2,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 140,  12,   0, 
-    170, 160,   5,   0,   0,   3, 
-      0,   0,   1, 128,   0,   0, 
-      0, 128,  10,   0,   0, 160, 
-     10,   0,   0,   3,   1,   0, 
-      1, 128,   0,   0,   0, 128, 
-     12,   0, 170, 160,  10,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,  85, 144,  12,   0, 
-    170, 160,   5,   0,   0,   3, 
-      0,   0,   2, 128,   0,   0, 
-      0, 128,   1,   0,   0, 128, 
-      4,   0,   0,   4,   0,   0, 
-      1, 128,   1,   0,   0, 128, 
-      0,   0,   0, 128,  10,   0, 
-     85, 161,  88,   0,   0,   4, 
-      1,   0,  15, 128,   0,   0, 
-      0, 128,  12,   0, 255, 160, 
-     12,   0,  85, 160,  65,   0, 
-      0,   1,   1,   0,  15, 128, 
-      5,   0,   0,   3,   0,   0, 
-      5, 128,   1,   0, 212, 160, 
-      1,   0,  85, 144,   4,   0, 
-      0,   4,   0,   0,   5, 128, 
-      0,   0, 212, 160,   1,   0, 
-      0, 144,   0,   0, 228, 128, 
-      2,   0,   0,   3,   0,   0, 
-      5, 128,   0,   0, 228, 128, 
-      2,   0, 212, 160,   2,   0, 
-      0,   3,   0,   0,   5, 128, 
-      0,   0, 228, 139,   8,   0, 
-    212, 161,   1,   0,   0,   2, 
-      1,   0,  12, 128,   8,   0, 
-    228, 160,   4,   0,   0,   4, 
-      0,   0,  21, 128,   0,   0, 
-    228, 128,   1,   0, 246, 129, 
-     11,   0,   0, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0, 170, 128,   0,   0, 
-      0, 128,   5,   0,   0,   3, 
-      0,   0,  12, 128,   4,   0, 
-     68, 160,   1,   0,  85, 144, 
-      4,   0,   0,   4,   0,   0, 
-     12, 128,   3,   0,  68, 160, 
-      1,   0,   0, 144,   0,   0, 
-    228, 128,   2,   0,   0,   3, 
-      0,   0,  12, 128,   0,   0, 
-    228, 128,   5,   0,  68, 160, 
-      6,   0,   0,   2,   1,   0, 
-      1, 128,   9,   0,   0, 160, 
-      6,   0,   0,   2,   1,   0, 
-      2, 128,   9,   0,  85, 160, 
-      5,   0,   0,   3,   0,   0, 
-     12, 128,   0,   0, 228, 128, 
-      1,   0,  68, 128,  66,   0, 
-      0,   3,   1,   0,  15, 128, 
-      0,   0, 238, 128,   0,   8, 
-    228, 160,   5,   0,   0,   3, 
-      1,   0,  15, 128,   1,   0, 
-    255, 128,   6,   0, 228, 160, 
-      5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 128, 
-      0,   0,  85, 128,   5,   0, 
-      0,   3,   0,   8,  15, 128, 
-      0,   0,   0, 128,   1,   0, 
-    228, 128, 255, 255,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
-      0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -5708,7 +5680,7 @@ const unsigned char g_main[] =
      57,  46,  50,  57,  46,  57, 
      53,  50,  46,  51,  49,  49, 
      49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
+      3,   0,  15, 160,   0,   0, 
       0,  64,   0,   0, 128, 191, 
       0,   0, 128,  63,   0,   0, 
       0,   0,  31,   0,   0,   2, 
@@ -5722,42 +5694,47 @@ const unsigned char g_main[] =
       3, 224,  31,   0,   0,   2, 
       3,   0,   0, 128,   2,   0, 
       3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
       0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
       4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0, 112,   3, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0, 
+      7,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 244,   1,   0,   0, 
+      0,   3, 255, 255, 254, 255, 
+     77,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 255,   0, 
       0,   0,   0,   3, 255, 255, 
-    254, 255,  87,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-     39,   1,   0,   0,   0,   3, 
-    255, 255,   2,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32,  32,   1,   0,   0, 
-     68,   0,   0,   0,   2,   0, 
-      0,   0,  11,   0,   0,   0, 
-     76,   0,   0,   0,  92,   0, 
-      0,   0,  12,   1,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      2,   0,  16,   1,   0,   0, 
-      0,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
+      1,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+    248,   0,   0,   0,  48,   0, 
+      0,   0,   2,   0,   0,   0, 
+     11,   0,   0,   0,  56,   0, 
+      0,   0,  72,   0,   0,   0, 
+    102, 114,  97, 103,   0, 171, 
+    171, 171,   1,   0,   3,   0, 
+      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -5788,9 +5765,6 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    116, 101, 120,   0,   4,   0, 
-     12,   0,   1,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
       0,   0, 112, 115,  95,  51, 
      95,  48,   0,  77, 105,  99, 
     114, 111, 115, 111, 102, 116, 
@@ -5802,115 +5776,167 @@ const unsigned char g_main[] =
      46,  57,  53,  50,  46,  51, 
      49,  49,  49,   0,  81,   0, 
       0,   5,  11,   0,  15, 160, 
-      0,   0,   0,  63,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  81,   0, 
-      0,   5,  12,   0,  15, 160, 
       0,   0,   0,  64,   0,   0, 
     128, 191,   0,   0, 128,  63, 
       0,   0,   0, 128,  31,   0, 
       0,   2,   5,   0,   0, 128, 
-      0,   0,   3, 144,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      1,   0,   3, 144,  31,   0, 
-      0,   2,   0,   0,   0, 144, 
-      0,   8,  15, 160,   4,   0, 
+      0,   0,   3, 144,   4,   0, 
       0,   4,   0,   0,   1, 128, 
-      0,   0,   0, 144,  12,   0, 
-      0, 160,  12,   0,  85, 160, 
+      0,   0,   0, 144,  11,   0, 
+      0, 160,  11,   0,  85, 160, 
       2,   0,   0,   3,   0,   0, 
       1, 128,   0,   0,   0, 140, 
-     12,   0, 170, 160,   5,   0, 
+     11,   0, 170, 160,   5,   0, 
       0,   3,   0,   0,   1, 128, 
       0,   0,   0, 128,  10,   0, 
       0, 160,  10,   0,   0,   3, 
       1,   0,   1, 128,   0,   0, 
-      0, 128,  12,   0, 170, 160, 
+      0, 128,  11,   0, 170, 160, 
      10,   0,   0,   3,   0,   0, 
       1, 128,   0,   0,  85, 144, 
-     12,   0, 170, 160,   5,   0, 
-      0,   3,   0,   0,   2, 128, 
-      0,   0,   0, 128,   1,   0, 
-      0, 128,   4,   0,   0,   4, 
-      0,   0,   1, 128,   1,   0, 
-      0, 128,   0,   0,   0, 128, 
-     10,   0,  85, 161,  88,   0, 
-      0,   4,   1,   0,  15, 128, 
-      0,   0,   0, 128,  12,   0, 
-    255, 160,  12,   0,  85, 160, 
-     65,   0,   0,   1,   1,   0, 
-     15, 128,   5,   0,   0,   3, 
-      0,   0,   5, 128,   1,   0, 
-    212, 160,   1,   0,  85, 144, 
-      4,   0,   0,   4,   0,   0, 
-      5, 128,   0,   0, 212, 160, 
-      1,   0,   0, 144,   0,   0, 
-    228, 128,   2,   0,   0,   3, 
-      0,   0,   5, 128,   0,   0, 
-    228, 128,   2,   0, 212, 160, 
-      2,   0,   0,   3,   0,   0, 
-      5, 128,   0,   0, 228, 139, 
-      8,   0, 212, 161,   1,   0, 
-      0,   2,   1,   0,  12, 128, 
-      8,   0, 228, 160,   4,   0, 
-      0,   4,   0,   0,  21, 128, 
-      0,   0, 228, 128,   1,   0, 
-    246, 129,  11,   0,   0, 160, 
-      5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0, 170, 128, 
-      0,   0,   0, 128,   5,   0, 
-      0,   3,   0,   0,  12, 128, 
-      4,   0,  68, 160,   1,   0, 
-     85, 144,   4,   0,   0,   4, 
-      0,   0,  12, 128,   3,   0, 
-     68, 160,   1,   0,   0, 144, 
-      0,   0, 228, 128,   2,   0, 
-      0,   3,   0,   0,  12, 128, 
-      0,   0, 228, 128,   5,   0, 
-     68, 160,   6,   0,   0,   2, 
-      1,   0,   1, 128,   9,   0, 
-      0, 160,   6,   0,   0,   2, 
-      1,   0,   2, 128,   9,   0, 
-     85, 160,   5,   0,   0,   3, 
-      0,   0,  12, 128,   0,   0, 
-    228, 128,   1,   0,  68, 128, 
-     66,   0,   0,   3,   1,   0, 
-     15, 128,   0,   0, 238, 128, 
-      0,   8, 228, 160,   5,   0, 
-      0,   3,   1,   0,   7, 128, 
-      1,   0, 255, 128,   1,   0, 
-    228, 128,   5,   0,   0,   3, 
-      1,   0,  15, 128,   1,   0, 
-    228, 128,   6,   0, 228, 160, 
+     11,   0, 170, 160,   4,   0, 
+      0,   4,   0,   0,   1, 128, 
+      1,   0,   0, 128,   0,   0, 
+      0, 128,  10,   0,  85, 161, 
+     88,   0,   0,   4,   0,   0, 
+     15, 128,   0,   0,   0, 128, 
+     11,   0, 255, 160,  11,   0, 
+     85, 160,  65,   0,   0,   1, 
+      0,   0,  15, 128,   1,   0, 
+      0,   2,   0,   8,  15, 128, 
+     11,   0, 170, 160, 255, 255, 
+      0,   0,   7,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
+      0,   0,   0,   3, 254, 255, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
       5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 128, 
-      0,   0,  85, 128,   5,   0, 
-      0,   3,   0,   8,  15, 128, 
-      0,   0,   0, 128,   1,   0, 
-    228, 128, 255, 255,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
+      1,   0,   0,   2,   0,   0, 
+     12, 224,   3,   0, 180, 160, 
+      1,   0,   0,   2,   1,   0, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,   6,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
-      0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+    244,   1,   0,   0,   0,   3, 
+    255, 255, 254, 255,  77,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 255,   0,   0,   0, 
+      0,   3, 255, 255,   1,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 248,   0, 
+      0,   0,  48,   0,   0,   0, 
+      2,   0,   0,   0,  11,   0, 
+      0,   0,  56,   0,   0,   0, 
+     72,   0,   0,   0, 102, 114, 
+     97, 103,   0, 171, 171, 171, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,  11,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    112, 115,  95,  51,  95,  48, 
       0,  77, 105,  99, 114, 111, 
     115, 111, 102, 116,  32,  40, 
      82,  41,  32,  72,  76,  83, 
@@ -5920,36 +5946,120 @@ const unsigned char g_main[] =
      57,  46,  50,  57,  46,  57, 
      53,  50,  46,  51,  49,  49, 
      49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
+     11,   0,  15, 160,   0,   0, 
       0,  64,   0,   0, 128, 191, 
       0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
+      0, 128,  31,   0,   0,   2, 
+      5,   0,   0, 128,   0,   0, 
+      3, 144,   4,   0,   0,   4, 
+      0,   0,   1, 128,   0,   0, 
+      0, 144,  11,   0,   0, 160, 
+     11,   0,  85, 160,   2,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,   0, 140,  11,   0, 
+    170, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+      0, 128,  10,   0,   0, 160, 
+     10,   0,   0,   3,   1,   0, 
+      1, 128,   0,   0,   0, 128, 
+     11,   0, 170, 160,  10,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,  85, 144,  11,   0, 
+    170, 160,   4,   0,   0,   4, 
+      0,   0,   1, 128,   1,   0, 
+      0, 128,   0,   0,   0, 128, 
+     10,   0,  85, 161,  88,   0, 
+      0,   4,   0,   0,  15, 128, 
+      0,   0,   0, 128,  11,   0, 
+    255, 160,  11,   0,  85, 160, 
+     65,   0,   0,   1,   0,   0, 
+     15, 128,   1,   0,   0,   2, 
+      0,   8,  15, 128,  11,   0, 
+    170, 160, 255, 255,   0,   0, 
+      6,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
+      0,   3, 254, 255, 254, 255, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
+      0,   0,   0,   3, 254, 255, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+    176,   0,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
+      0,   0, 105, 110, 118, 101, 
+    114, 115, 101,  86, 105, 101, 
+    119,  83, 105, 122, 101,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   3,   0,  15, 160, 
+      0,   0,   0,  64,   0,   0, 
+    128, 191,   0,   0, 128,  63, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 144,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,  15, 144,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 224,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,   3, 224,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      2,   0,   3, 224,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
       0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
+    228, 128,   0,   0, 228, 160, 
       4,   0,   0,   4,   0,   0, 
       1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
+      3,   0,   0, 160,   3,   0, 
      85, 160,   4,   0,   0,   4, 
       0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
       0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
+      3,   0, 180, 160,   1,   0, 
       0,   2,   1,   0,   3, 224, 
       1,   0, 228, 144,   1,   0, 
       0,   2,   2,   0,   3, 224, 
       0,   0, 228, 144, 255, 255, 
-      0,   0,   3,   0,   0,   0, 
+      0,   0,   5,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   1,   0,   0,   0, 
       0,   0,   0,   0,  96,   3, 
@@ -6090,93 +6200,117 @@ const unsigned char g_main[] =
      15, 128,   0,   0, 238, 128, 
       0,   8, 228, 160,   5,   0, 
       0,   3,   1,   0,  15, 128, 
-      1,   0, 228, 128,   6,   0, 
+      1,   0, 255, 128,   6,   0, 
     228, 160,   5,   0,   0,   3, 
       0,   0,   1, 128,   0,   0, 
       0, 128,   0,   0,  85, 128, 
       5,   0,   0,   3,   0,   8, 
      15, 128,   0,   0,   0, 128, 
       1,   0, 228, 128, 255, 255, 
-      0,   0,   3,   0,   0,   0, 
+      0,   0,   5,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
+      0,   0,   0,   0, 220,   1, 
       0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
+    254, 255,  59,   0,  67,  84, 
      65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
      28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
       0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
       0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
       0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
       1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
+     12, 224,   3,   0, 180, 160, 
       1,   0,   0,   2,   1,   0, 
       3, 224,   1,   0, 228, 144, 
       1,   0,   0,   2,   2,   0, 
       3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0,   2,   0, 
+    255, 255,   0,   0,   4,   0, 
       0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    236,   3,   0,   0,   0,   3, 
-    255, 255, 254, 255,  77,   0, 
+    112,   3,   0,   0,   0,   3, 
+    255, 255, 254, 255,  87,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0, 255,   0,   0,   0, 
-      0,   3, 255, 255,   1,   0, 
+      0,   0,  39,   1,   0,   0, 
+      0,   3, 255, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32, 248,   0, 
-      0,   0,  48,   0,   0,   0, 
+      0,   1,   0,  32,  32,   1, 
+      0,   0,  68,   0,   0,   0, 
       2,   0,   0,   0,  11,   0, 
-      0,   0,  56,   0,   0,   0, 
-     72,   0,   0,   0, 102, 114, 
-     97, 103,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,  11,   0,   0,   0, 
+      0,   0,  76,   0,   0,   0, 
+     92,   0,   0,   0,  12,   1, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   2,   0,  16,   1, 
       0,   0,   0,   0,   0,   0, 
+    102, 114,  97, 103,   0, 171, 
+    171, 171,   1,   0,   3,   0, 
+      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -6206,209 +6340,212 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    112, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-     11,   0,  15, 160,   0,   0, 
-      0,  63,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  81,   0,   0,   5, 
-     12,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0, 128,  31,   0,   0,   2, 
-      5,   0,   0, 128,   0,   0, 
-      3, 144,  31,   0,   0,   2, 
-      3,   0,   0, 128,   1,   0, 
-      3, 144,   4,   0,   0,   4, 
-      0,   0,   1, 128,   0,   0, 
-      0, 144,  12,   0,   0, 160, 
-     12,   0,  85, 160,   2,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,   0, 140,  12,   0, 
-    170, 160,   5,   0,   0,   3, 
+      0,   0, 116, 101, 120,   0, 
+      4,   0,  12,   0,   1,   0, 
+      1,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  11,   0, 
+     15, 160,   0,   0,   0,  63, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+     81,   0,   0,   5,  12,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0, 128, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   0,   0,   3, 144, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   1,   0,   3, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 144,   0,   8,  15, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   0,   0,   0, 144, 
+     12,   0,   0, 160,  12,   0, 
+     85, 160,   2,   0,   0,   3, 
       0,   0,   1, 128,   0,   0, 
-      0, 128,  10,   0,   0, 160, 
-     10,   0,   0,   3,   1,   0, 
+      0, 140,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
       1, 128,   0,   0,   0, 128, 
-     12,   0, 170, 160,  10,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0,  85, 144,  12,   0, 
-    170, 160,   5,   0,   0,   3, 
-      0,   0,   2, 128,   0,   0, 
-      0, 128,   1,   0,   0, 128, 
+     10,   0,   0, 160,  10,   0, 
+      0,   3,   1,   0,   1, 128, 
+      0,   0,   0, 128,  12,   0, 
+    170, 160,  10,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 144,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
+      2, 128,   0,   0,   0, 128, 
+      1,   0,   0, 128,   4,   0, 
+      0,   4,   0,   0,   1, 128, 
+      1,   0,   0, 128,   0,   0, 
+      0, 128,  10,   0,  85, 161, 
+     88,   0,   0,   4,   1,   0, 
+     15, 128,   0,   0,   0, 128, 
+     12,   0, 255, 160,  12,   0, 
+     85, 160,  65,   0,   0,   1, 
+      1,   0,  15, 128,   5,   0, 
+      0,   3,   0,   0,   5, 128, 
+      1,   0, 212, 160,   1,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   5, 128,   0,   0, 
+    212, 160,   1,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   5, 128, 
+      0,   0, 228, 128,   2,   0, 
+    212, 160,   2,   0,   0,   3, 
+      0,   0,   5, 128,   0,   0, 
+    228, 139,   8,   0, 212, 161, 
+      1,   0,   0,   2,   1,   0, 
+     12, 128,   8,   0, 228, 160, 
       4,   0,   0,   4,   0,   0, 
-      1, 128,   1,   0,   0, 128, 
-      0,   0,   0, 128,  10,   0, 
-     85, 161,  88,   0,   0,   4, 
-      1,   0,  15, 128,   0,   0, 
-      0, 128,  12,   0, 255, 160, 
-     12,   0,  85, 160,  65,   0, 
-      0,   1,   1,   0,  15, 128, 
+     21, 128,   0,   0, 228, 128, 
+      1,   0, 246, 129,  11,   0, 
+      0, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+    170, 128,   0,   0,   0, 128, 
       5,   0,   0,   3,   0,   0, 
-      5, 128,   1,   0, 212, 160, 
+     12, 128,   4,   0,  68, 160, 
       1,   0,  85, 144,   4,   0, 
-      0,   4,   0,   0,   5, 128, 
-      0,   0, 212, 160,   1,   0, 
+      0,   4,   0,   0,  12, 128, 
+      3,   0,  68, 160,   1,   0, 
       0, 144,   0,   0, 228, 128, 
       2,   0,   0,   3,   0,   0, 
-      5, 128,   0,   0, 228, 128, 
-      2,   0, 212, 160,   2,   0, 
-      0,   3,   0,   0,   5, 128, 
-      0,   0, 228, 139,   8,   0, 
-    212, 161,   1,   0,   0,   2, 
-      1,   0,  12, 128,   8,   0, 
-    228, 160,   4,   0,   0,   4, 
-      0,   0,  21, 128,   0,   0, 
-    228, 128,   1,   0, 246, 129, 
-     11,   0,   0, 160,   5,   0, 
-      0,   3,   0,   0,   1, 128, 
-      0,   0, 170, 128,   0,   0, 
-      0, 128,   5,   0,   0,   3, 
-      0,   0,  12, 128,   4,   0, 
-     68, 160,   1,   0,  85, 144, 
-      4,   0,   0,   4,   0,   0, 
-     12, 128,   3,   0,  68, 160, 
-      1,   0,   0, 144,   0,   0, 
-    228, 128,   2,   0,   0,   3, 
-      0,   0,  12, 128,   0,   0, 
-    228, 128,   5,   0,  68, 160, 
-      2,   0,   0,   3,   1,   0, 
-      3, 128,   9,   0, 170, 161, 
-      9,   0, 228, 160,   2,   0, 
+     12, 128,   0,   0, 228, 128, 
+      5,   0,  68, 160,   6,   0, 
+      0,   2,   1,   0,   1, 128, 
+      9,   0,   0, 160,   6,   0, 
+      0,   2,   1,   0,   2, 128, 
+      9,   0,  85, 160,   5,   0, 
       0,   3,   0,   0,  12, 128, 
-      0,   0, 228, 139,   1,   0, 
-     68, 129,  11,   0,   0,   3, 
-      1,   0,   1, 128,   0,   0, 
-    170, 128,   0,   0, 255, 128, 
-     10,   0,   0,   3,   2,   0, 
-      1, 128,   1,   0,   0, 128, 
-     12,   0, 255, 161,  11,   0, 
-      0,   3,   1,   0,   3, 128, 
-      0,   0, 238, 128,  12,   0, 
-    255, 161,  90,   0,   0,   4, 
-      0,   0,   4, 128,   1,   0, 
-    228, 128,   1,   0, 228, 128, 
-     12,   0, 255, 161,   7,   0, 
-      0,   2,   0,   0,   4, 128, 
-      0,   0, 170, 128,   6,   0, 
-      0,   2,   0,   0,   4, 128, 
-      0,   0, 170, 128,   2,   0, 
-      0,   3,   0,   0,   4, 128, 
-      0,   0, 170, 128,   2,   0, 
-      0, 128,   2,   0,   0,   3, 
-      0,   0,   4, 128,   0,   0, 
-    170, 128,   9,   0, 170, 161, 
+      0,   0, 228, 128,   1,   0, 
+     68, 128,  66,   0,   0,   3, 
+      1,   0,  15, 128,   0,   0, 
+    238, 128,   0,   8, 228, 160, 
+      5,   0,   0,   3,   1,   0, 
+      7, 128,   1,   0, 255, 128, 
+      1,   0, 228, 128,   5,   0, 
+      0,   3,   1,   0,  15, 128, 
+      1,   0, 228, 128,   6,   0, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+      0, 128,   0,   0,  85, 128, 
+      5,   0,   0,   3,   0,   8, 
+     15, 128,   0,   0,   0, 128, 
+      1,   0, 228, 128, 255, 255, 
+      0,   0,   4,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0, 220,   1, 
+      0,   0,   0,   3, 254, 255, 
+    254, 255,  59,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
+      0,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,   1, 224,   0,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
+      0,   4,   0,   0,   2, 224, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
       1,   0,   0,   2,   0,   0, 
-      8, 128,   9,   0, 255, 160, 
-      4,   0,   0,   4,   0,   0, 
-      4, 128,   0,   0, 255, 128, 
-     11,   0,   0, 160,   0,   0, 
-    170, 128,   6,   0,   0,   2, 
-      0,   0,   8, 128,   9,   0, 
-    255, 160,   5,   0,   0,   3, 
-      0,   0,  20, 128,   0,   0, 
-    255, 128,   0,   0, 170, 128, 
+     12, 224,   3,   0, 180, 160, 
       1,   0,   0,   2,   1,   0, 
-     15, 128,   6,   0, 228, 160, 
-      2,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 228, 129, 
-      7,   0, 228, 160,   4,   0, 
-      0,   4,   1,   0,  15, 128, 
-      0,   0, 170, 128,   1,   0, 
-    228, 128,   6,   0, 228, 160, 
-      5,   0,   0,   3,   0,   0, 
-      1, 128,   0,   0,   0, 128, 
-      0,   0,  85, 128,   5,   0, 
-      0,   3,   0,   8,  15, 128, 
-      0,   0,   0, 128,   1,   0, 
-    228, 128, 255, 255,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
+      3, 224,   1,   0, 228, 144, 
+      1,   0,   0,   2,   2,   0, 
+      3, 224,   0,   0, 228, 144, 
+    255, 255,   0,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  88,   1,   0,   0, 
-      0,   3, 254, 255, 254, 255, 
-     39,   0,  67,  84,  65,  66, 
-     28,   0,   0,   0, 103,   0, 
-      0,   0,   0,   3, 254, 255, 
-      1,   0,   0,   0,  28,   0, 
-      0,   0,   0,   1,   0,  32, 
-     96,   0,   0,   0,  48,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  64,   0, 
-      0,   0,  80,   0,   0,   0, 
-    105, 110, 118, 101, 114, 115, 
-    101,  86, 105, 101, 119,  83, 
-    105, 122, 101,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
-      1,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
       0,   0,   0,   0,   0,   0, 
+     96,   3,   0,   0,   0,   3, 
+    255, 255, 254, 255,  87,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0,  39,   1,   0,   0, 
+      0,   3, 255, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32,  32,   1, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,  11,   0, 
+      0,   0,  76,   0,   0,   0, 
+     92,   0,   0,   0,  12,   1, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   2,   0,  16,   1, 
       0,   0,   0,   0,   0,   0, 
+    102, 114,  97, 103,   0, 171, 
+    171, 171,   1,   0,   3,   0, 
+      1,   0,   4,   0,  11,   0, 
       0,   0,   0,   0,   0,   0, 
-    118, 115,  95,  51,  95,  48, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     57,  46,  50,  57,  46,  57, 
-     53,  50,  46,  51,  49,  49, 
-     49,   0,  81,   0,   0,   5, 
-      1,   0,  15, 160,   0,   0, 
-      0,  64,   0,   0, 128, 191, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 144,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-     15, 144,  31,   0,   0,   2, 
-      0,   0,   0, 128,   0,   0, 
-     15, 224,  31,   0,   0,   2, 
-      5,   0,   0, 128,   1,   0, 
-      3, 224,  31,   0,   0,   2, 
-      3,   0,   0, 128,   2,   0, 
-      3, 224,   5,   0,   0,   3, 
-      0,   0,   3, 128,   0,   0, 
-    228, 160,   0,   0, 228, 144, 
-      4,   0,   0,   4,   0,   0, 
-      1, 224,   0,   0,   0, 128, 
-      1,   0,   0, 160,   1,   0, 
-     85, 160,   4,   0,   0,   4, 
-      0,   0,   2, 224,   0,   0, 
-     85, 128,   1,   0,   0, 161, 
-      1,   0, 170, 160,   1,   0, 
-      0,   2,   0,   0,  12, 224, 
-      1,   0, 180, 160,   1,   0, 
-      0,   2,   1,   0,   3, 224, 
-      1,   0, 228, 144,   1,   0, 
-      0,   2,   2,   0,   3, 224, 
-      0,   0, 228, 144, 255, 255, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      0,   0,   0,   0, 236,   3, 
-      0,   0,   0,   3, 255, 255, 
-    254, 255,  77,   0,  67,  84, 
-     65,  66,  28,   0,   0,   0, 
-    255,   0,   0,   0,   0,   3, 
-    255, 255,   1,   0,   0,   0, 
-     28,   0,   0,   0,   0,   1, 
-      0,  32, 248,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
-      0,   0,  11,   0,   0,   0, 
-     56,   0,   0,   0,  72,   0, 
-      0,   0, 102, 114,  97, 103, 
-      0, 171, 171, 171,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-     11,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -6438,6 +6575,9 @@ const unsigned char g_main[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0, 116, 101, 120,   0, 
+      4,   0,  12,   0,   1,   0, 
+      1,   0,   1,   0,   0,   0, 
       0,   0,   0,   0, 112, 115, 
      95,  51,  95,  48,   0,  77, 
     105,  99, 114, 111, 115, 111, 
@@ -6460,6 +6600,8 @@ const unsigned char g_main[] =
       0, 128,   0,   0,   3, 144, 
      31,   0,   0,   2,   3,   0, 
       0, 128,   1,   0,   3, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 144,   0,   8,  15, 160, 
       4,   0,   0,   4,   0,   0, 
       1, 128,   0,   0,   0, 144, 
      12,   0,   0, 160,  12,   0, 
@@ -6512,119 +6654,109 @@ const unsigned char g_main[] =
       0, 144,   0,   0, 228, 128, 
       2,   0,   0,   3,   0,   0, 
      12, 128,   0,   0, 228, 128, 
-      5,   0,  68, 160,   2,   0, 
-      0,   3,   1,   0,   3, 128, 
-      9,   0, 170, 161,   9,   0, 
-    228, 160,   2,   0,   0,   3, 
-      0,   0,  12, 128,   0,   0, 
-    228, 139,   1,   0,  68, 129, 
-     11,   0,   0,   3,   1,   0, 
-      1, 128,   0,   0, 170, 128, 
-      0,   0, 255, 128,  10,   0, 
-      0,   3,   2,   0,   1, 128, 
-      1,   0,   0, 128,  12,   0, 
-    255, 161,  11,   0,   0,   3, 
-      1,   0,   3, 128,   0,   0, 
-    238, 128,  12,   0, 255, 161, 
-     90,   0,   0,   4,   0,   0, 
-      4, 128,   1,   0, 228, 128, 
-      1,   0, 228, 128,  12,   0, 
-    255, 161,   7,   0,   0,   2, 
-      0,   0,   4, 128,   0,   0, 
-    170, 128,   6,   0,   0,   2, 
-      0,   0,   4, 128,   0,   0, 
-    170, 128,   2,   0,   0,   3, 
-      0,   0,   4, 128,   0,   0, 
-    170, 128,   2,   0,   0, 128, 
-      2,   0,   0,   3,   0,   0, 
-      4, 128,   0,   0, 170, 128, 
-      9,   0, 170, 161,   1,   0, 
-      0,   2,   0,   0,   8, 128, 
-      9,   0, 255, 160,   4,   0, 
-      0,   4,   0,   0,   4, 128, 
-      0,   0, 255, 128,  11,   0, 
-      0, 160,   0,   0, 170, 128, 
-      6,   0,   0,   2,   0,   0, 
-      8, 128,   9,   0, 255, 160, 
-      5,   0,   0,   3,   0,   0, 
-     20, 128,   0,   0, 255, 128, 
-      0,   0, 170, 128,   1,   0, 
-      0,   2,   1,   0,  15, 128, 
-      6,   0, 228, 160,   2,   0, 
-      0,   3,   1,   0,  15, 128, 
-      1,   0, 228, 129,   7,   0, 
-    228, 160,   4,   0,   0,   4, 
+      5,   0,  68, 160,   6,   0, 
+      0,   2,   1,   0,   1, 128, 
+      9,   0,   0, 160,   6,   0, 
+      0,   2,   1,   0,   2, 128, 
+      9,   0,  85, 160,   5,   0, 
+      0,   3,   0,   0,  12, 128, 
+      0,   0, 228, 128,   1,   0, 
+     68, 128,  66,   0,   0,   3, 
       1,   0,  15, 128,   0,   0, 
-    170, 128,   1,   0, 228, 128, 
+    238, 128,   0,   8, 228, 160, 
+      5,   0,   0,   3,   1,   0, 
+     15, 128,   1,   0, 228, 128, 
       6,   0, 228, 160,   5,   0, 
       0,   3,   0,   0,   1, 128, 
       0,   0,   0, 128,   0,   0, 
      85, 128,   5,   0,   0,   3, 
       0,   8,  15, 128,   0,   0, 
       0, 128,   1,   0, 228, 128, 
-    255, 255,   0,   0,   1,   0, 
+    255, 255,   0,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     88,   1,   0,   0,   0,   3, 
-    254, 255, 254, 255,  39,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
      67,  84,  65,  66,  28,   0, 
-      0,   0, 103,   0,   0,   0, 
-      0,   3, 254, 255,   1,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
       0,   0,  28,   0,   0,   0, 
-      0,   1,   0,  32,  96,   0, 
-      0,   0,  48,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
       2,   0,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     80,   0,   0,   0, 105, 110, 
-    118, 101, 114, 115, 101,  86, 
-    105, 101, 119,  83, 105, 122, 
-    101,   0,   1,   0,   3,   0, 
-      1,   0,   2,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 118, 115, 
-     95,  51,  95,  48,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  57,  46, 
-     50,  57,  46,  57,  53,  50, 
-     46,  51,  49,  49,  49,   0, 
-     81,   0,   0,   5,   1,   0, 
-     15, 160,   0,   0,   0,  64, 
-      0,   0, 128, 191,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,  15, 144, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,  15, 224, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   1,   0,   3, 224, 
-     31,   0,   0,   2,   3,   0, 
-      0, 128,   2,   0,   3, 224, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
       5,   0,   0,   3,   0,   0, 
-      3, 128,   0,   0, 228, 160, 
-      0,   0, 228, 144,   4,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
       0,   4,   0,   0,   1, 224, 
-      0,   0,   0, 128,   1,   0, 
-      0, 160,   1,   0,  85, 160, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
       4,   0,   0,   4,   0,   0, 
       2, 224,   0,   0,  85, 128, 
-      1,   0,   0, 161,   1,   0, 
+      3,   0,   0, 161,   3,   0, 
     170, 160,   1,   0,   0,   2, 
-      0,   0,  12, 224,   1,   0, 
+      0,   0,  12, 224,   3,   0, 
     180, 160,   1,   0,   0,   2, 
       1,   0,   3, 224,   1,   0, 
     228, 144,   1,   0,   0,   2, 
       2,   0,   3, 224,   0,   0, 
     228, 144, 255, 255,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      2,   0,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
       1,   0,   0,   0,   0,   0, 
       0,   0, 236,   3,   0,   0, 
@@ -6795,66 +6927,597 @@ const unsigned char g_main[] =
       5,   0,   0,   3,   0,   8, 
      15, 128,   0,   0,   0, 128, 
       1,   0, 228, 128, 255, 255, 
-      0,   0,   0,   0,   0,   0, 
+      0,   0,   2,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
+      0,   0,   0,   0, 220,   1, 
       0,   0,   0,   3, 254, 255, 
-    254, 255,  39,   0,  67,  84, 
+    254, 255,  59,   0,  67,  84, 
      65,  66,  28,   0,   0,   0, 
-    103,   0,   0,   0,   0,   3, 
-    254, 255,   1,   0,   0,   0, 
+    183,   0,   0,   0,   0,   3, 
+    254, 255,   2,   0,   0,   0, 
      28,   0,   0,   0,   0,   1, 
-      0,  32,  96,   0,   0,   0, 
-     48,   0,   0,   0,   2,   0, 
+      0,  32, 176,   0,   0,   0, 
+     68,   0,   0,   0,   2,   0, 
       0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  80,   0, 
-      0,   0, 105, 110, 118, 101, 
-    114, 115, 101,  86, 105, 101, 
-    119,  83, 105, 122, 101,   0, 
-      1,   0,   3,   0,   1,   0, 
-      2,   0,   1,   0,   0,   0, 
+     84,   0,   0,   0, 100,   0, 
+      0,   0, 116,   0,   0,   0, 
+      2,   0,   1,   0,   2,   0, 
+      0,   0, 128,   0,   0,   0, 
+    144,   0,   0,   0, 105, 110, 
+    118, 101, 114, 115, 101,  86, 
+    105, 101, 119,  83, 105, 122, 
+    101,   0,   1,   0,   3,   0, 
+      1,   0,   2,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  51, 
-     95,  48,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  57,  46,  50,  57, 
-     46,  57,  53,  50,  46,  51, 
-     49,  49,  49,   0,  81,   0, 
-      0,   5,   1,   0,  15, 160, 
-      0,   0,   0,  64,   0,   0, 
-    128, 191,   0,   0, 128,  63, 
-      0,   0,   0,   0,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 144,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,  15, 144,  31,   0, 
-      0,   2,   0,   0,   0, 128, 
-      0,   0,  15, 224,  31,   0, 
-      0,   2,   5,   0,   0, 128, 
-      1,   0,   3, 224,  31,   0, 
-      0,   2,   3,   0,   0, 128, 
-      2,   0,   3, 224,   5,   0, 
+      0,   0,   0,   0, 118, 101, 
+    114, 116, 101, 120,  88, 102, 
+    111, 114, 109,   0,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 118, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,   3,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0,   0, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 144, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,  15, 144, 
+     31,   0,   0,   2,   0,   0, 
+      0, 128,   0,   0,  15, 224, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   1,   0,   3, 224, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   2,   0,   3, 224, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   1,   0, 238, 160, 
+      0,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   3, 128, 
+      1,   0, 228, 160,   0,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      2,   0, 228, 160,   5,   0, 
       0,   3,   0,   0,   3, 128, 
-      0,   0, 228, 160,   0,   0, 
-    228, 144,   4,   0,   0,   4, 
+      0,   0, 228, 128,   0,   0, 
+    228, 160,   4,   0,   0,   4, 
       0,   0,   1, 224,   0,   0, 
-      0, 128,   1,   0,   0, 160, 
-      1,   0,  85, 160,   4,   0, 
+      0, 128,   3,   0,   0, 160, 
+      3,   0,  85, 160,   4,   0, 
       0,   4,   0,   0,   2, 224, 
-      0,   0,  85, 128,   1,   0, 
-      0, 161,   1,   0, 170, 160, 
+      0,   0,  85, 128,   3,   0, 
+      0, 161,   3,   0, 170, 160, 
       1,   0,   0,   2,   0,   0, 
-     12, 224,   1,   0, 180, 160, 
+     12, 224,   3,   0, 180, 160, 
       1,   0,   0,   2,   1,   0, 
       3, 224,   1,   0, 228, 144, 
       1,   0,   0,   2,   2,   0, 
       3, 224,   0,   0, 228, 144, 
-    255, 255,   0,   0
+    255, 255,   0,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+    236,   3,   0,   0,   0,   3, 
+    255, 255, 254, 255,  77,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 255,   0,   0,   0, 
+      0,   3, 255, 255,   1,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 248,   0, 
+      0,   0,  48,   0,   0,   0, 
+      2,   0,   0,   0,  11,   0, 
+      0,   0,  56,   0,   0,   0, 
+     72,   0,   0,   0, 102, 114, 
+     97, 103,   0, 171, 171, 171, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,  11,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    112, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+     11,   0,  15, 160,   0,   0, 
+      0,  63,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,  81,   0,   0,   5, 
+     12,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0, 128,  31,   0,   0,   2, 
+      5,   0,   0, 128,   0,   0, 
+      3, 144,  31,   0,   0,   2, 
+      3,   0,   0, 128,   1,   0, 
+      3, 144,   4,   0,   0,   4, 
+      0,   0,   1, 128,   0,   0, 
+      0, 144,  12,   0,   0, 160, 
+     12,   0,  85, 160,   2,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,   0, 140,  12,   0, 
+    170, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+      0, 128,  10,   0,   0, 160, 
+     10,   0,   0,   3,   1,   0, 
+      1, 128,   0,   0,   0, 128, 
+     12,   0, 170, 160,  10,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,  85, 144,  12,   0, 
+    170, 160,   5,   0,   0,   3, 
+      0,   0,   2, 128,   0,   0, 
+      0, 128,   1,   0,   0, 128, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   1,   0,   0, 128, 
+      0,   0,   0, 128,  10,   0, 
+     85, 161,  88,   0,   0,   4, 
+      1,   0,  15, 128,   0,   0, 
+      0, 128,  12,   0, 255, 160, 
+     12,   0,  85, 160,  65,   0, 
+      0,   1,   1,   0,  15, 128, 
+      5,   0,   0,   3,   0,   0, 
+      5, 128,   1,   0, 212, 160, 
+      1,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,   5, 128, 
+      0,   0, 212, 160,   1,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+      5, 128,   0,   0, 228, 128, 
+      2,   0, 212, 160,   2,   0, 
+      0,   3,   0,   0,   5, 128, 
+      0,   0, 228, 139,   8,   0, 
+    212, 161,   1,   0,   0,   2, 
+      1,   0,  12, 128,   8,   0, 
+    228, 160,   4,   0,   0,   4, 
+      0,   0,  21, 128,   0,   0, 
+    228, 128,   1,   0, 246, 129, 
+     11,   0,   0, 160,   5,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0, 170, 128,   0,   0, 
+      0, 128,   5,   0,   0,   3, 
+      0,   0,  12, 128,   4,   0, 
+     68, 160,   1,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+     12, 128,   3,   0,  68, 160, 
+      1,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,  12, 128,   0,   0, 
+    228, 128,   5,   0,  68, 160, 
+      2,   0,   0,   3,   1,   0, 
+      3, 128,   9,   0, 170, 161, 
+      9,   0, 228, 160,   2,   0, 
+      0,   3,   0,   0,  12, 128, 
+      0,   0, 228, 139,   1,   0, 
+     68, 129,  11,   0,   0,   3, 
+      1,   0,   1, 128,   0,   0, 
+    170, 128,   0,   0, 255, 128, 
+     10,   0,   0,   3,   2,   0, 
+      1, 128,   1,   0,   0, 128, 
+     12,   0, 255, 161,  11,   0, 
+      0,   3,   1,   0,   3, 128, 
+      0,   0, 238, 128,  12,   0, 
+    255, 161,  90,   0,   0,   4, 
+      0,   0,   4, 128,   1,   0, 
+    228, 128,   1,   0, 228, 128, 
+     12,   0, 255, 161,   7,   0, 
+      0,   2,   0,   0,   4, 128, 
+      0,   0, 170, 128,   6,   0, 
+      0,   2,   0,   0,   4, 128, 
+      0,   0, 170, 128,   2,   0, 
+      0,   3,   0,   0,   4, 128, 
+      0,   0, 170, 128,   2,   0, 
+      0, 128,   2,   0,   0,   3, 
+      0,   0,   4, 128,   0,   0, 
+    170, 128,   9,   0, 170, 161, 
+      1,   0,   0,   2,   0,   0, 
+      8, 128,   9,   0, 255, 160, 
+      4,   0,   0,   4,   0,   0, 
+      4, 128,   0,   0, 255, 128, 
+     11,   0,   0, 160,   0,   0, 
+    170, 128,   6,   0,   0,   2, 
+      0,   0,   8, 128,   9,   0, 
+    255, 160,   5,   0,   0,   3, 
+      0,   0,  20, 128,   0,   0, 
+    255, 128,   0,   0, 170, 128, 
+      1,   0,   0,   2,   1,   0, 
+     15, 128,   6,   0, 228, 160, 
+      2,   0,   0,   3,   1,   0, 
+     15, 128,   1,   0, 228, 129, 
+      7,   0, 228, 160,   4,   0, 
+      0,   4,   1,   0,  15, 128, 
+      0,   0, 170, 128,   1,   0, 
+    228, 128,   6,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      1, 128,   0,   0,   0, 128, 
+      0,   0,  85, 128,   5,   0, 
+      0,   3,   0,   8,  15, 128, 
+      0,   0,   0, 128,   1,   0, 
+    228, 128, 255, 255,   0,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 220,   1,   0,   0, 
+      0,   3, 254, 255, 254, 255, 
+     59,   0,  67,  84,  65,  66, 
+     28,   0,   0,   0, 183,   0, 
+      0,   0,   0,   3, 254, 255, 
+      2,   0,   0,   0,  28,   0, 
+      0,   0,   0,   1,   0,  32, 
+    176,   0,   0,   0,  68,   0, 
+      0,   0,   2,   0,   0,   0, 
+      1,   0,   0,   0,  84,   0, 
+      0,   0, 100,   0,   0,   0, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   2,   0,   0,   0, 
+    128,   0,   0,   0, 144,   0, 
+      0,   0, 105, 110, 118, 101, 
+    114, 115, 101,  86, 105, 101, 
+    119,  83, 105, 122, 101,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 101, 114, 116, 
+    101, 120,  88, 102, 111, 114, 
+    109,   0,   1,   0,   3,   0, 
+      1,   0,   4,   0,   2,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 118, 115,  95,  51, 
+     95,  48,   0,  77, 105,  99, 
+    114, 111, 115, 111, 102, 116, 
+     32,  40,  82,  41,  32,  72, 
+     76,  83,  76,  32,  83, 104, 
+     97, 100, 101, 114,  32,  67, 
+    111, 109, 112, 105, 108, 101, 
+    114,  32,  57,  46,  50,  57, 
+     46,  57,  53,  50,  46,  51, 
+     49,  49,  49,   0,  81,   0, 
+      0,   5,   3,   0,  15, 160, 
+      0,   0,   0,  64,   0,   0, 
+    128, 191,   0,   0, 128,  63, 
+      0,   0,   0,   0,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 144,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,  15, 144,  31,   0, 
+      0,   2,   0,   0,   0, 128, 
+      0,   0,  15, 224,  31,   0, 
+      0,   2,   5,   0,   0, 128, 
+      1,   0,   3, 224,  31,   0, 
+      0,   2,   3,   0,   0, 128, 
+      2,   0,   3, 224,   5,   0, 
+      0,   3,   0,   0,   3, 128, 
+      1,   0, 238, 160,   0,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   3, 128,   1,   0, 
+    228, 160,   0,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   3, 128, 
+      0,   0, 228, 128,   2,   0, 
+    228, 160,   5,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   0,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+      1, 224,   0,   0,   0, 128, 
+      3,   0,   0, 160,   3,   0, 
+     85, 160,   4,   0,   0,   4, 
+      0,   0,   2, 224,   0,   0, 
+     85, 128,   3,   0,   0, 161, 
+      3,   0, 170, 160,   1,   0, 
+      0,   2,   0,   0,  12, 224, 
+      3,   0, 180, 160,   1,   0, 
+      0,   2,   1,   0,   3, 224, 
+      1,   0, 228, 144,   1,   0, 
+      0,   2,   2,   0,   3, 224, 
+      0,   0, 228, 144, 255, 255, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   1,   0,   0,   0, 
+      0,   0,   0,   0, 236,   3, 
+      0,   0,   0,   3, 255, 255, 
+    254, 255,  77,   0,  67,  84, 
+     65,  66,  28,   0,   0,   0, 
+    255,   0,   0,   0,   0,   3, 
+    255, 255,   1,   0,   0,   0, 
+     28,   0,   0,   0,   0,   1, 
+      0,  32, 248,   0,   0,   0, 
+     48,   0,   0,   0,   2,   0, 
+      0,   0,  11,   0,   0,   0, 
+     56,   0,   0,   0,  72,   0, 
+      0,   0, 102, 114,  97, 103, 
+      0, 171, 171, 171,   1,   0, 
+      3,   0,   1,   0,   4,   0, 
+     11,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 112, 115, 
+     95,  51,  95,  48,   0,  77, 
+    105,  99, 114, 111, 115, 111, 
+    102, 116,  32,  40,  82,  41, 
+     32,  72,  76,  83,  76,  32, 
+     83, 104,  97, 100, 101, 114, 
+     32,  67, 111, 109, 112, 105, 
+    108, 101, 114,  32,  57,  46, 
+     50,  57,  46,  57,  53,  50, 
+     46,  51,  49,  49,  49,   0, 
+     81,   0,   0,   5,  11,   0, 
+     15, 160,   0,   0,   0,  63, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+     81,   0,   0,   5,  12,   0, 
+     15, 160,   0,   0,   0,  64, 
+      0,   0, 128, 191,   0,   0, 
+    128,  63,   0,   0,   0, 128, 
+     31,   0,   0,   2,   5,   0, 
+      0, 128,   0,   0,   3, 144, 
+     31,   0,   0,   2,   3,   0, 
+      0, 128,   1,   0,   3, 144, 
+      4,   0,   0,   4,   0,   0, 
+      1, 128,   0,   0,   0, 144, 
+     12,   0,   0, 160,  12,   0, 
+     85, 160,   2,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+      0, 140,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
+      1, 128,   0,   0,   0, 128, 
+     10,   0,   0, 160,  10,   0, 
+      0,   3,   1,   0,   1, 128, 
+      0,   0,   0, 128,  12,   0, 
+    170, 160,  10,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+     85, 144,  12,   0, 170, 160, 
+      5,   0,   0,   3,   0,   0, 
+      2, 128,   0,   0,   0, 128, 
+      1,   0,   0, 128,   4,   0, 
+      0,   4,   0,   0,   1, 128, 
+      1,   0,   0, 128,   0,   0, 
+      0, 128,  10,   0,  85, 161, 
+     88,   0,   0,   4,   1,   0, 
+     15, 128,   0,   0,   0, 128, 
+     12,   0, 255, 160,  12,   0, 
+     85, 160,  65,   0,   0,   1, 
+      1,   0,  15, 128,   5,   0, 
+      0,   3,   0,   0,   5, 128, 
+      1,   0, 212, 160,   1,   0, 
+     85, 144,   4,   0,   0,   4, 
+      0,   0,   5, 128,   0,   0, 
+    212, 160,   1,   0,   0, 144, 
+      0,   0, 228, 128,   2,   0, 
+      0,   3,   0,   0,   5, 128, 
+      0,   0, 228, 128,   2,   0, 
+    212, 160,   2,   0,   0,   3, 
+      0,   0,   5, 128,   0,   0, 
+    228, 139,   8,   0, 212, 161, 
+      1,   0,   0,   2,   1,   0, 
+     12, 128,   8,   0, 228, 160, 
+      4,   0,   0,   4,   0,   0, 
+     21, 128,   0,   0, 228, 128, 
+      1,   0, 246, 129,  11,   0, 
+      0, 160,   5,   0,   0,   3, 
+      0,   0,   1, 128,   0,   0, 
+    170, 128,   0,   0,   0, 128, 
+      5,   0,   0,   3,   0,   0, 
+     12, 128,   4,   0,  68, 160, 
+      1,   0,  85, 144,   4,   0, 
+      0,   4,   0,   0,  12, 128, 
+      3,   0,  68, 160,   1,   0, 
+      0, 144,   0,   0, 228, 128, 
+      2,   0,   0,   3,   0,   0, 
+     12, 128,   0,   0, 228, 128, 
+      5,   0,  68, 160,   2,   0, 
+      0,   3,   1,   0,   3, 128, 
+      9,   0, 170, 161,   9,   0, 
+    228, 160,   2,   0,   0,   3, 
+      0,   0,  12, 128,   0,   0, 
+    228, 139,   1,   0,  68, 129, 
+     11,   0,   0,   3,   1,   0, 
+      1, 128,   0,   0, 170, 128, 
+      0,   0, 255, 128,  10,   0, 
+      0,   3,   2,   0,   1, 128, 
+      1,   0,   0, 128,  12,   0, 
+    255, 161,  11,   0,   0,   3, 
+      1,   0,   3, 128,   0,   0, 
+    238, 128,  12,   0, 255, 161, 
+     90,   0,   0,   4,   0,   0, 
+      4, 128,   1,   0, 228, 128, 
+      1,   0, 228, 128,  12,   0, 
+    255, 161,   7,   0,   0,   2, 
+      0,   0,   4, 128,   0,   0, 
+    170, 128,   6,   0,   0,   2, 
+      0,   0,   4, 128,   0,   0, 
+    170, 128,   2,   0,   0,   3, 
+      0,   0,   4, 128,   0,   0, 
+    170, 128,   2,   0,   0, 128, 
+      2,   0,   0,   3,   0,   0, 
+      4, 128,   0,   0, 170, 128, 
+      9,   0, 170, 161,   1,   0, 
+      0,   2,   0,   0,   8, 128, 
+      9,   0, 255, 160,   4,   0, 
+      0,   4,   0,   0,   4, 128, 
+      0,   0, 255, 128,  11,   0, 
+      0, 160,   0,   0, 170, 128, 
+      6,   0,   0,   2,   0,   0, 
+      8, 128,   9,   0, 255, 160, 
+      5,   0,   0,   3,   0,   0, 
+     20, 128,   0,   0, 255, 128, 
+      0,   0, 170, 128,   1,   0, 
+      0,   2,   1,   0,  15, 128, 
+      6,   0, 228, 160,   2,   0, 
+      0,   3,   1,   0,  15, 128, 
+      1,   0, 228, 129,   7,   0, 
+    228, 160,   4,   0,   0,   4, 
+      1,   0,  15, 128,   0,   0, 
+    170, 128,   1,   0, 228, 128, 
+      6,   0, 228, 160,   5,   0, 
+      0,   3,   0,   0,   1, 128, 
+      0,   0,   0, 128,   0,   0, 
+     85, 128,   5,   0,   0,   3, 
+      0,   8,  15, 128,   0,   0, 
+      0, 128,   1,   0, 228, 128, 
+    255, 255,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    220,   1,   0,   0,   0,   3, 
+    254, 255, 254, 255,  59,   0, 
+     67,  84,  65,  66,  28,   0, 
+      0,   0, 183,   0,   0,   0, 
+      0,   3, 254, 255,   2,   0, 
+      0,   0,  28,   0,   0,   0, 
+      0,   1,   0,  32, 176,   0, 
+      0,   0,  68,   0,   0,   0, 
+      2,   0,   0,   0,   1,   0, 
+      0,   0,  84,   0,   0,   0, 
+    100,   0,   0,   0, 116,   0, 
+      0,   0,   2,   0,   1,   0, 
+      2,   0,   0,   0, 128,   0, 
+      0,   0, 144,   0,   0,   0, 
+    105, 110, 118, 101, 114, 115, 
+    101,  86, 105, 101, 119,  83, 
+    105, 122, 101,   0,   1,   0, 
+      3,   0,   1,   0,   2,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 101, 114, 116, 101, 120, 
+     88, 102, 111, 114, 109,   0, 
+      1,   0,   3,   0,   1,   0, 
+      4,   0,   2,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    118, 115,  95,  51,  95,  48, 
+      0,  77, 105,  99, 114, 111, 
+    115, 111, 102, 116,  32,  40, 
+     82,  41,  32,  72,  76,  83, 
+     76,  32,  83, 104,  97, 100, 
+    101, 114,  32,  67, 111, 109, 
+    112, 105, 108, 101, 114,  32, 
+     57,  46,  50,  57,  46,  57, 
+     53,  50,  46,  51,  49,  49, 
+     49,   0,  81,   0,   0,   5, 
+      3,   0,  15, 160,   0,   0, 
+      0,  64,   0,   0, 128, 191, 
+      0,   0, 128,  63,   0,   0, 
+      0,   0,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 144,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+     15, 144,  31,   0,   0,   2, 
+      0,   0,   0, 128,   0,   0, 
+     15, 224,  31,   0,   0,   2, 
+      5,   0,   0, 128,   1,   0, 
+      3, 224,  31,   0,   0,   2, 
+      3,   0,   0, 128,   2,   0, 
+      3, 224,   5,   0,   0,   3, 
+      0,   0,   3, 128,   1,   0, 
+    238, 160,   0,   0,  85, 144, 
+      4,   0,   0,   4,   0,   0, 
+      3, 128,   1,   0, 228, 160, 
+      0,   0,   0, 144,   0,   0, 
+    228, 128,   2,   0,   0,   3, 
+      0,   0,   3, 128,   0,   0, 
+    228, 128,   2,   0, 228, 160, 
+      5,   0,   0,   3,   0,   0, 
+      3, 128,   0,   0, 228, 128, 
+      0,   0, 228, 160,   4,   0, 
+      0,   4,   0,   0,   1, 224, 
+      0,   0,   0, 128,   3,   0, 
+      0, 160,   3,   0,  85, 160, 
+      4,   0,   0,   4,   0,   0, 
+      2, 224,   0,   0,  85, 128, 
+      3,   0,   0, 161,   3,   0, 
+    170, 160,   1,   0,   0,   2, 
+      0,   0,  12, 224,   3,   0, 
+    180, 160,   1,   0,   0,   2, 
+      1,   0,   3, 224,   1,   0, 
+    228, 144,   1,   0,   0,   2, 
+      2,   0,   3, 224,   0,   0, 
+    228, 144, 255, 255,   0,   0
 };